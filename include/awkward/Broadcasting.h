@@ -0,0 +1,95 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_BROADCASTING_H_
+#define AWKWARD_BROADCASTING_H_
+
+#include "awkward/common.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class BroadcastFunction
+  ///
+  /// @brief Abstract function that #broadcast_and_apply calls at each level
+  /// of its inputs, which computes the outputs when it recognizes them.
+  ///
+  /// In Python, this is implemented by a `getfunction` callback.
+  class LIBAWKWARD_EXPORT_SYMBOL BroadcastFunction {
+  public:
+    /// @brief Empty destructor; required for some C++ reason.
+    virtual ~BroadcastFunction();
+
+    /// @brief Computes the outputs for a set of broadcasted inputs, or
+    /// returns `false` to let #broadcast_and_apply descend into them.
+    ///
+    /// @param inputs The inputs at this level, all of the same length;
+    /// nullptr stands for an input that is not an array (such as a scalar),
+    /// which is passed through unchanged.
+    /// @param depth The number of list dimensions above this level.
+    /// @param outputs Where to put the outputs if this function returns
+    /// `true`; every level must return the same number of outputs.
+    virtual bool
+      apply(const ContentPtrVec& inputs,
+            int64_t depth,
+            ContentPtrVec& outputs) = 0;
+
+    /// @brief Returns `true` if `input` has a custom rule for being
+    /// broadcasted to lists of other lengths (#custom_broadcast); the
+    /// default is `false`.
+    ///
+    /// In Python, this is a `"__broadcast__"` behavior for the input's
+    /// `"__array__"` or `"__record__"` parameter.
+    virtual bool
+      has_custom_broadcast(const ContentPtr& input);
+
+    /// @brief Broadcasts `input`, for which #has_custom_broadcast is `true`,
+    /// to lists with `offsets`, returning the content of those lists.
+    virtual const ContentPtr
+      custom_broadcast(const ContentPtr& input, const Index64& offsets);
+  };
+
+  /// @brief Options for #broadcast_and_apply.
+  struct LIBAWKWARD_EXPORT_SYMBOL BroadcastOptions {
+    BroadcastOptions();
+
+    /// @brief If `false`, raise an error instead of broadcasting through
+    /// records.
+    bool allow_records;
+    /// @brief If `true`, arrays with fewer dimensions are broadcasted to
+    /// the lists of the others from the left (unlike NumPy).
+    bool left_broadcast;
+    /// @brief If `true` and all arrays are regular, arrays with fewer
+    /// dimensions are broadcasted from the right (like NumPy).
+    bool right_broadcast;
+    /// @brief If `true`, NumpyArrays are converted into RegularArrays
+    /// before broadcasting.
+    bool numpy_to_regular;
+    /// @brief If `true`, RegularArrays are converted into
+    /// {@link ListOffsetArrayOf ListOffsetArrays} before broadcasting.
+    bool regular_to_jagged;
+    /// @brief If `true`, the BroadcastFunction is only called at the
+    /// leaves: where all arrays are NumpyArrays (or RegularArrays of them),
+    /// or where some array has an `"__array__"` or `"__record__"`
+    /// parameter that may have custom behavior.
+    bool leaves_only;
+  };
+
+  /// @brief Broadcasts `inputs` against each other, level by level, and
+  /// calls `function` to compute the outputs where it can, then rebuilds
+  /// the structure of the inputs around them.
+  ///
+  /// This is the traversal behind `ak._util.broadcast_and_apply`: option
+  /// types, unions, and records are broadcasted into each level's outputs
+  /// and lists of different lengths are broadcasted to the same offsets.
+  ///
+  /// @param inputs The arrays to broadcast (nullptr for non-arrays).
+  /// @param function Called at each level (see BroadcastOptions#leaves_only).
+  /// @param options See BroadcastOptions.
+  /// @param depth The number of list dimensions above `inputs`.
+  LIBAWKWARD_EXPORT_SYMBOL const ContentPtrVec
+    broadcast_and_apply(const ContentPtrVec& inputs,
+                        BroadcastFunction& function,
+                        const BroadcastOptions& options,
+                        int64_t depth);
+}
+
+#endif // AWKWARD_BROADCASTING_H_
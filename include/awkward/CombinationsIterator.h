@@ -0,0 +1,138 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_COMBINATIONSITERATOR_H_
+#define AWKWARD_COMBINATIONSITERATOR_H_
+
+#include <string>
+#include <utility>
+
+#include "awkward/common.h"
+#include "awkward/util.h"
+#include "awkward/Index.h"
+
+namespace awkward {
+  class Content;
+  using ContentPtr    = std::shared_ptr<Content>;
+
+  /// @class CombinationsIterator
+  ///
+  /// @brief Produces the `n`-combinations of each list in an array (the
+  /// same as Content#combinations at `axis=1`) a fixed number at a time,
+  /// so that only one chunk of the carry arrays is in memory at once.
+  ///
+  /// Each call to #next returns the parents of the combinations (the index
+  /// of the list each came from) and a RecordArray of them, in the same
+  /// order as Content#combinations. A consumer that immediately reduces or
+  /// filters them never holds the full combinatorial carry.
+  class LIBAWKWARD_EXPORT_SYMBOL CombinationsIterator {
+  public:
+    /// @brief Creates a CombinationsIterator from a full set of parameters.
+    ///
+    /// @param array The lists to choose from: a
+    /// {@link ListArrayOf ListArray},
+    /// {@link ListOffsetArrayOf ListOffsetArray}, or RegularArray (possibly
+    /// in a VirtualArray).
+    /// @param n The number of items in each combination.
+    /// @param replacement If `true`, combinations may repeat items.
+    /// @param recordlookup Field names of the output records, or nullptr for
+    /// tuples.
+    /// @param parameters Parameters of the output records.
+    /// @param chunksize The maximum number of combinations returned by each
+    /// call to #next.
+    CombinationsIterator(const ContentPtr& array,
+                         int64_t n,
+                         bool replacement,
+                         const util::RecordLookupPtr& recordlookup,
+                         const util::Parameters& parameters,
+                         int64_t chunksize);
+
+    /// @brief The lists to choose from, as a ListOffsetArray64 starting at
+    /// zero.
+    const ContentPtr
+      array() const;
+
+    /// @brief The number of items in each combination.
+    int64_t
+      n() const;
+
+    /// @brief If `true`, combinations may repeat items.
+    bool
+      replacement() const;
+
+    /// @brief The maximum number of combinations returned by #next.
+    int64_t
+      chunksize() const;
+
+    /// @brief Offsets of the combinations of each list, as they would be in
+    /// the output of Content#combinations.
+    const Index64
+      offsets() const;
+
+    /// @brief Total number of combinations in all lists.
+    int64_t
+      length() const;
+
+    /// @brief Number of combinations already returned by #next.
+    int64_t
+      at() const;
+
+    /// @brief If `true`, all combinations have been returned and calling
+    /// #next again would raise an error.
+    bool
+      isdone() const;
+
+    /// @brief Returns the next (at most #chunksize) combinations: an index
+    /// of the list each one came from and a RecordArray of their items.
+    const std::pair<Index64, ContentPtr>
+      next();
+
+    /// @brief Internal function to build an output string for #tostring.
+    ///
+    /// @param indent Indentation depth as a string of spaces.
+    /// @param pre Prefix string, usually an opening XML tag.
+    /// @param post Postfix string, usually a closing XML tag and carriage
+    /// return.
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const;
+
+    /// @brief Returns a string representation of this iterator (single-line
+    /// XML).
+    const std::string
+      tostring() const;
+
+  private:
+    /// @brief See #array.
+    const ContentPtr array_;
+    /// @brief The content of #array.
+    const ContentPtr content_;
+    /// @brief Starts of the lists in #array.
+    const Index64 starts_;
+    /// @brief Stops of the lists in #array.
+    const Index64 stops_;
+    /// @brief See #offsets.
+    const Index64 offsets_;
+    /// @brief See #n.
+    const int64_t n_;
+    /// @brief See #replacement.
+    const bool replacement_;
+    /// @brief Field names of the output records.
+    const util::RecordLookupPtr recordlookup_;
+    /// @brief Parameters of the output records.
+    const util::Parameters parameters_;
+    /// @brief See #chunksize.
+    const int64_t chunksize_;
+    /// @brief See #length.
+    int64_t length_;
+    /// @brief See #at.
+    int64_t at_;
+    /// @brief The list that #next resumes from.
+    int64_t position_;
+    /// @brief The next combination of that list (negative if it hasn't been
+    /// started).
+    Index64 index_;
+  };
+}
+
+#endif // AWKWARD_COMBINATIONSITERATOR_H_
@@ -0,0 +1,48 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_FUSEDELEMENTWISE_H_
+#define AWKWARD_FUSEDELEMENTWISE_H_
+
+#include <string>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @brief Returns the opcode of a fused elementwise operation, named after
+  /// the NumPy ufunc that it computes (`"add"`, `"sqrt"`, etc.), or of
+  /// `"input"` and `"constant"`, which push an input or a constant; returns
+  /// `-1` if the name is not recognized.
+  LIBAWKWARD_EXPORT_SYMBOL int64_t
+    fused_opcode(const std::string& name);
+
+  /// @brief Names of all the ufuncs that #fused_elementwise can compute.
+  LIBAWKWARD_EXPORT_SYMBOL const std::vector<std::string>
+    fused_operations();
+
+  /// @brief Evaluates a chain of elementwise operations on arrays that have
+  /// the same list structure in one pass over their flat contents, without
+  /// materializing intermediate arrays.
+  ///
+  /// The program is in postfix order, as a sequence of (opcode, argument)
+  /// pairs (see #fused_opcode): `"input"` and `"constant"` push
+  /// `inputs[argument]` or `constants[argument]`, and every other opcode
+  /// replaces its one or two operands with its result. All values are
+  /// computed as float64.
+  ///
+  /// Returns nullptr if the inputs can't be fused, so that the caller can
+  /// evaluate the operations one by one instead: if they are not all lists
+  /// (or regular dimensions) with identical offsets over 1-dimensional
+  /// numbers, or if any of them has parameters.
+  ///
+  /// @param inputs The arrays referred to by `"input"` instructions.
+  /// @param program The (opcode, argument) pairs, flattened.
+  /// @param constants The numbers referred to by `"constant"` instructions.
+  LIBAWKWARD_EXPORT_SYMBOL const ContentPtr
+    fused_elementwise(const ContentPtrVec& inputs,
+                      const std::vector<int64_t>& program,
+                      const std::vector<double>& constants);
+}
+
+#endif // AWKWARD_FUSEDELEMENTWISE_H_
@@ -203,6 +203,222 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of boolean
+    /// values, delimited by `offsets`.
+    ///
+    /// The default implementation expands `offsets` into a `parents`
+    /// array and calls #apply_bool. Reducers that have a kernel for
+    /// contiguous groups override it to avoid that intermediate array.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_bool(const bool* data,
+                         const Index64& offsets,
+                         int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of signed 8-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of unsigned 8-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of signed 16-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of unsigned 16-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of signed 32-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of unsigned 32-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of signed 64-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of unsigned 64-bit
+    /// integer values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of 32-bit
+    /// floating-point values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of 64-bit
+    /// floating-point values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of complex 32-bit
+    /// floating-point values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_complex64(const std::complex<float>* data,
+                              const Index64& offsets,
+                              int64_t outlength) const;
+
+    /// @brief Apply the reducer algorithm to contiguous groups of complex 64-bit
+    /// floating-point values, delimited by `offsets`.
+    ///
+    /// See #apply_offsets_bool.
+    ///
+    /// @param data The array to reduce. Positions in `offsets` are
+    /// relative to this pointer.
+    /// @param offsets Starting and stopping positions of each group in
+    /// `data`; its length is `outlength + 1`.
+    /// @param outlength The length of the output array (equal to the number
+    /// of groups).
+    virtual const std::shared_ptr<void>
+      apply_offsets_complex128(const std::complex<double>* data,
+                               const Index64& offsets,
+                               int64_t outlength) const;
+
+  protected:
+    /// @brief Expands `offsets` into a `parents` array (relative to
+    /// `offsets[0]`), for the default implementations of `apply_offsets_*`.
+    const Index64
+      offsets_to_parents(const Index64& offsets, int64_t outlength) const;
   };
 
   /// @class ReducerCount
@@ -294,6 +510,71 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_bool(const bool* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_complex64(const std::complex<float>* data,
+                              const Index64& offsets,
+                              int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_complex128(const std::complex<double>* data,
+                               const Index64& offsets,
+                               int64_t outlength) const override;
   };
 
   /// @class ReducerCountNonzero
@@ -385,6 +666,61 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_bool(const bool* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerSum
@@ -477,6 +813,56 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerProd
@@ -569,6 +955,56 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerAny
@@ -850,6 +1286,56 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
   private:
     double initial_f64_;
     uint64_t initial_u64_;
@@ -952,6 +1438,56 @@ namespace awkward {
       apply_complex128(const std::complex<double>* data,
                        const Index64& parents,
                        int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int8(const int8_t* data,
+                         const Index64& offsets,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint8(const uint8_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int16(const int16_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint16(const uint16_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int32(const int32_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint32(const uint32_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_int64(const int64_t* data,
+                          const Index64& offsets,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_uint64(const uint64_t* data,
+                           const Index64& offsets,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float32(const float* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_offsets_float64(const double* data,
+                            const Index64& offsets,
+                            int64_t outlength) const override;
   private:
     double initial_f64_;
     uint64_t initial_u64_;
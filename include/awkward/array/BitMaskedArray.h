@@ -222,6 +222,11 @@ namespace awkward {
     const std::shared_ptr<IndexedArrayOf<int64_t, true>>
       toIndexedOptionArray64() const;
 
+    /// @brief Number of missing values, counted directly from the bits of
+    /// the #mask.
+    int64_t
+      numnull() const;
+
     /// @brief User-friendly name of this class: `"BitMaskedArray"`.
     const std::string
       classname() const override;
@@ -484,6 +489,12 @@ namespace awkward {
     bool
       is_subrange_equal(const Index64& start, const Index64& stop) const override;
 
+    /// @brief Positions of the valid items (to carry the #content) and an
+    /// index into them with `-1` for missing items, computed directly from
+    /// the bits of the #mask.
+    const std::pair<Index64, Index64>
+      nextcarry_outindex(int64_t& numnull) const;
+
   private:
     /// @brief See #mask.
     const IndexU8 mask_;
@@ -465,6 +465,25 @@ namespace awkward {
                   bool mask,
                   bool keepdims) const override;
 
+    /// @brief Reduces contiguous groups of this one-dimensional array,
+    /// delimited by `offsets`, without building a `parents`
+    /// {@link IndexOf Index}.
+    ///
+    /// This is the path that {@link ListOffsetArrayOf#reduce_next
+    /// ListOffsetArray::reduce_next} takes when the reduced axis is the
+    /// innermost dimension of numbers; it is only valid for a Reducer that
+    /// does not return positions.
+    ///
+    /// @param offsets Positions in this array where each group starts and
+    /// stops; the output has `offsets.length() - 1` items.
+    /// @param mask See #reduce_next.
+    /// @param keepdims See #reduce_next.
+    const ContentPtr
+      reduce_offsets_next(const Reducer& reducer,
+                          const Index64& offsets,
+                          bool mask,
+                          bool keepdims) const;
+
     const ContentPtr
       sort_next(int64_t negaxis,
                 const Index64& starts,
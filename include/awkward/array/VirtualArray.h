@@ -158,6 +158,21 @@ namespace awkward {
     const ContentPtr
       array() const;
 
+    /// @brief Starts generating the array on a background thread (see
+    /// kernel::background) and puts it in the #cache when it is done.
+    ///
+    /// This returns immediately, so that the array can be generated while
+    /// the calling thread works on something else. If #array is called
+    /// first, it waits for the background thread instead of generating the
+    /// array again. If the background thread fails, #array generates the
+    /// array itself, which raises the error in the calling thread.
+    ///
+    /// This does nothing if there is no #cache (there would be nowhere to
+    /// put the array), if the array is already in it, or if it is already
+    /// being generated.
+    void
+      prefetch() const;
+
     /// @brief The key this VirtualArray will use when filling a #cache.
     const std::string
       cache_key() const;
@@ -8,6 +8,7 @@
 #include "awkward/Index.h"
 
 #include <memory>
+#include <vector>
 
 namespace awkward {
   /// @class GrowableBuffer
@@ -38,6 +39,12 @@ namespace awkward {
   /// delete or take advantage of. However, many operations require buffers
   /// to be rewritten; under normal circumstances, it would soon be replaced
   /// by a more appropriately sized buffer.
+  ///
+  /// Once the reservation exceeds #chunk_threshold bytes, growing no longer
+  /// copies: the filled buffer is kept as a chunk and new elements go into
+  /// a freshly allocated one. The chunks are concatenated only when a
+  /// contiguous #ptr is requested (e.g. by a snapshot), so a buffer that
+  /// grows to many gigabytes is copied once, rather than at every resize.
   template <typename T>
   class LIBAWKWARD_EXPORT_SYMBOL GrowableBuffer {
   public:
@@ -100,7 +107,14 @@ namespace awkward {
     /// {@link ArrayBuilderOptions#initial ArrayBuilderOptions::initial}.
     GrowableBuffer(const ArrayBuilderOptions& options);
 
+    /// @brief Size in bytes above which the buffer grows by adding chunks
+    /// instead of reallocating and copying.
+    static const int64_t chunk_threshold = 16777216;
+
     /// @brief Reference-counted pointer to the array buffer.
+    ///
+    /// If the buffer has grown in chunks, they are concatenated into one
+    /// contiguous buffer first (the only time chunked data are copied).
     const std::shared_ptr<T>
       ptr() const;
 
@@ -151,19 +165,38 @@ namespace awkward {
     void
       append(T datum);
 
+    /// @brief Inserts `length` elements from `data` into the array with a
+    /// single copy, possibly triggering a reallocation.
+    ///
+    /// Unlike writing through #ptr, this does not concatenate chunks.
+    void
+      extend(const T* data, int64_t length);
+
     /// @brief Returns the element at a given position in the array, without
     /// handling negative indexing or bounds-checking.
     T
       getitem_at_nowrap(int64_t at) const;
 
   private:
+    /// @brief Concatenates #chunks_ and the current #ptr_ into one
+    /// buffer of #reserved elements.
+    void
+      concatenate() const;
+
     const ArrayBuilderOptions options_;
-    // @brief See #ptr.
-    std::shared_ptr<T> ptr_;
+    // @brief The buffer being filled: the whole array if there are no
+    // #chunks_, otherwise only the elements from #offset_ onward.
+    mutable std::shared_ptr<T> ptr_;
     // @brief See #length.
     int64_t length_;
     // @brief See #reserved.
     int64_t reserved_;
+    // @brief Index of the first element in #ptr_.
+    mutable int64_t offset_;
+    // @brief Filled buffers that precede #ptr_.
+    mutable std::vector<std::shared_ptr<T>> chunks_;
+    // @brief Index one past the last element of each of the #chunks_.
+    mutable std::vector<int64_t> chunkstops_;
   };
 }
 
@@ -0,0 +1,314 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_TYPEDARRAYBUILDER_H_
+#define AWKWARD_TYPEDARRAYBUILDER_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/util.h"
+#include "awkward/builder/ArrayBuilderOptions.h"
+#include "awkward/builder/GrowableBuffer.h"
+
+namespace awkward {
+  class Content;
+  using ContentPtr    = std::shared_ptr<Content>;
+  class Form;
+  using FormPtr = std::shared_ptr<Form>;
+
+  /// @class TypedArrayBuilder
+  ///
+  /// @brief Builds an array of a known Form, checking each call against it.
+  ///
+  /// Unlike ArrayBuilder, which discovers the type as data arrive (replacing
+  /// its Builder nodes as the type widens), this makes one node per Form
+  /// node when it is constructed, each with its own GrowableBuffer, and
+  /// never replaces them. Record fields are selected by their index in the
+  /// Form, without comparing strings.
+  ///
+  /// Supported Forms are NumpyForm (one-dimensional booleans and numbers),
+  /// ListOffsetForm (with 64-bit offsets), RegularForm, RecordForm (records
+  /// and tuples), and IndexedOptionForm (with a 64-bit index), nested in any
+  /// way. A ListOffsetForm of 8-bit integers can be filled with #string.
+  class LIBAWKWARD_EXPORT_SYMBOL TypedArrayBuilder {
+  public:
+    /// @brief Creates a TypedArrayBuilder for a given `form`.
+    ///
+    /// @param form The Form of the arrays that #snapshot will return.
+    /// @param options Initial size and growth factor of every buffer.
+    TypedArrayBuilder(const FormPtr& form,
+                      const ArrayBuilderOptions& options);
+
+    /// @brief The Form of the arrays that this builds.
+    const FormPtr
+      form() const;
+
+    /// @brief Returns a string representation of this builder (single-line
+    /// XML indicating the length and form).
+    const std::string
+      tostring() const;
+
+    /// @brief Number of complete items in the accumulated array.
+    int64_t
+      length() const;
+
+    /// @brief Removes all accumulated data, including any unfinished lists
+    /// or records.
+    void
+      clear();
+
+    /// @brief Turns the complete items of the accumulated data into a
+    /// Content array with the Form's parameters.
+    ///
+    /// As with ArrayBuilder, the buffers are shared, not copied.
+    const ContentPtr
+      snapshot() const;
+
+    /// @brief Adds a `null` value; the Form must be an IndexedOptionForm
+    /// here.
+    void
+      null();
+
+    /// @brief Adds a boolean value `x`; the Form must be a boolean
+    /// NumpyForm (possibly optional) here.
+    void
+      boolean(bool x);
+
+    /// @brief Adds an integer value `x`; the Form must be a numeric
+    /// NumpyForm (possibly optional) here.
+    void
+      integer(int64_t x);
+
+    /// @brief Adds a real value `x`; the Form must be a floating-point
+    /// NumpyForm (possibly optional) here.
+    void
+      real(double x);
+
+    /// @brief Adds a string of `length` bytes as one list; the Form must be
+    /// a ListOffsetForm of 8-bit integers (possibly optional) here.
+    void
+      string(const char* x, int64_t length);
+
+    /// @brief Adds an STL string as one list; see above.
+    void
+      string(const std::string& x);
+
+    /// @brief Begins a list; the Form must be a ListOffsetForm or a
+    /// RegularForm (possibly optional) here.
+    void
+      beginlist();
+
+    /// @brief Ends the current list, which must have exactly `size` items
+    /// for a RegularForm.
+    void
+      endlist();
+
+    /// @brief Begins a tuple; the Form must be a RecordForm without keys
+    /// and with `numfields` fields (possibly optional) here.
+    void
+      begintuple(int64_t numfields);
+
+    /// @brief Sets the tuple slot that the next command fills.
+    void
+      index(int64_t index);
+
+    /// @brief Ends the current tuple, checking that every slot was filled.
+    void
+      endtuple();
+
+    /// @brief Begins a record; the Form must be a RecordForm (possibly
+    /// optional) here.
+    void
+      beginrecord();
+
+    /// @brief Sets the record field that the next command fills, by its
+    /// index in the RecordForm.
+    void
+      field(int64_t fieldindex);
+
+    /// @brief Sets the record field that the next command fills, by its
+    /// key (looked up in a hash table made from the RecordForm).
+    void
+      field(const std::string& key);
+
+    /// @brief Ends the current record, checking that every field was
+    /// filled.
+    void
+      endrecord();
+
+  private:
+    enum class Kind {
+      numpy,
+      listoffset,
+      regular,
+      record,
+      indexedoption
+    };
+
+    /// @brief Builder state for one Form node.
+    struct Node {
+      Node(const FormPtr& form, Kind kind, const ArrayBuilderOptions& options);
+
+      FormPtr form;
+      Kind kind;
+      /// @brief Number of items, including one that has begun for
+      /// Kind::indexedoption.
+      int64_t length;
+      /// @brief Type of #data, for Kind::numpy.
+      util::dtype dtype;
+      /// @brief A `GrowableBuffer<T>` of #dtype, for Kind::numpy.
+      std::shared_ptr<void> data;
+      /// @brief Offsets for Kind::listoffset, index for Kind::indexedoption.
+      GrowableBuffer<int64_t> index;
+      /// @brief Positions of the child nodes in #nodes_.
+      std::vector<int64_t> contents;
+      /// @brief List size for Kind::regular, number of fields for
+      /// Kind::record.
+      int64_t size;
+      /// @brief True for a Kind::record without keys.
+      bool istuple;
+      /// @brief Field index of each key, for Kind::record.
+      std::unordered_map<std::string, int64_t> keys;
+    };
+
+    /// @brief A list or record that has begun but not ended.
+    struct Frame {
+      /// @brief Position of the list or record node in #nodes_.
+      int64_t node;
+      /// @brief The selected field of a record (-1 for none yet), or the
+      /// length of a RegularForm's content when it began.
+      int64_t at;
+    };
+
+    /// @brief Appends a node for `form` and its descendants to #nodes_,
+    /// returning its position.
+    int64_t
+      add_node(const FormPtr& form);
+
+    /// @brief The node that the next value goes into, checking that a
+    /// record field has been selected and not yet filled.
+    int64_t
+      next_node(const char* command);
+
+    /// @brief The first node below `node` that is not an option.
+    int64_t
+      content_node(int64_t node) const;
+
+    /// @brief Marks the option nodes from `node` down to #content_node as
+    /// valid; called only after the command has been checked, so that a
+    /// failed command changes nothing.
+    void
+      fill_options(int64_t node);
+
+    /// @brief Counts a top-level item if no list or record is unfinished.
+    void
+      maybe_complete();
+
+    /// @brief Error message for a `command` that does not fit `node`.
+    const std::string
+      wrong_form(const char* command, int64_t node) const;
+
+    /// @brief Ends the current tuple or record.
+    void
+      endrecord_or_tuple(bool istuple);
+
+    /// @brief Snapshot of the first `length` items of `node`.
+    const ContentPtr
+      snapshot_node(int64_t node, int64_t length) const;
+
+    /// @brief Initial size and growth factor of every buffer.
+    const ArrayBuilderOptions options_;
+    /// @brief See #form.
+    const FormPtr form_;
+    /// @brief All nodes, the root first, made once by the constructor.
+    std::vector<Node> nodes_;
+    /// @brief The unfinished lists and records, innermost last.
+    std::vector<Frame> frames_;
+    /// @brief See #length.
+    int64_t length_;
+  };
+}
+
+extern "C" {
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#length TypedArrayBuilder::length}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_length(void* typedarraybuilder,
+                                     int64_t* result);
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#clear TypedArrayBuilder::clear}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_clear(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#null TypedArrayBuilder::null}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_null(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#boolean TypedArrayBuilder::boolean}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_boolean(void* typedarraybuilder,
+                                      bool x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#integer TypedArrayBuilder::integer}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_integer(void* typedarraybuilder,
+                                      int64_t x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#real TypedArrayBuilder::real}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_real(void* typedarraybuilder,
+                                   double x);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#beginlist TypedArrayBuilder::beginlist}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_beginlist(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endlist TypedArrayBuilder::endlist}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endlist(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#begintuple TypedArrayBuilder::begintuple}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_begintuple(void* typedarraybuilder,
+                                         int64_t numfields);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#index TypedArrayBuilder::index}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_index(void* typedarraybuilder,
+                                    int64_t index);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endtuple TypedArrayBuilder::endtuple}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endtuple(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#beginrecord TypedArrayBuilder::beginrecord}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_beginrecord(void* typedarraybuilder);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#field TypedArrayBuilder::field}
+  /// with a field index.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_field(void* typedarraybuilder,
+                                    int64_t fieldindex);
+
+  /// @brief C interface to
+  /// {@link awkward::TypedArrayBuilder#endrecord TypedArrayBuilder::endrecord}.
+  LIBAWKWARD_EXPORT_SYMBOL uint8_t
+    awkward_TypedArrayBuilder_endrecord(void* typedarraybuilder);
+}
+
+#endif // AWKWARD_TYPEDARRAYBUILDER_H_
@@ -45,6 +45,16 @@
   #define LIBAWKWARD_EXPORT_SYMBOL
 #endif
 
+// Data-parallel CPU kernels marked TARGET_CLONES are compiled once for each
+// x86-64 instruction set listed here, and the dynamic loader picks the widest
+// one that the running CPU supports (GNU ifunc). A single build therefore uses
+// AVX-512 or AVX2 where available and still runs on baseline (SSE2) machines.
+#if defined __GNUC__  &&  !defined __clang__  &&  defined __x86_64__  &&  defined __linux__  &&  !defined AWKWARD_NO_TARGET_CLONES
+  #define TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+  #define TARGET_CLONES
+#endif
+
 #include <iostream>
 #include <algorithm>
 #include <map>
@@ -69,6 +79,7 @@ extern "C" {
   const int64_t  kMaxInt64  = 9223372036854775806;   // 2**63 - 2: see below
   const int64_t  kSliceNone = kMaxInt64 + 1;         // for Slice::none()
   const int64_t  kMaxLevels =                  48;
+  const int64_t  kReduceLanes =                 8;   // accumulators per vector
 
   inline struct Error
     success() {
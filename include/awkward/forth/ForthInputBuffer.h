@@ -3,7 +3,10 @@
 #ifndef AWKWARD_FORTHINPUTBUFFER_H_
 #define AWKWARD_FORTHINPUTBUFFER_H_
 
+#include <exception>
+#include <functional>
 #include <memory>
+#include <string>
 
 #include "awkward/common.h"
 #include "awkward/util.h"
@@ -21,6 +24,39 @@ namespace awkward {
                      int64_t offset,
                      int64_t length);
 
+    /// @brief Maps `length` bytes of the file named `filename`, starting at
+    /// byte `offset`, into memory instead of copying them; if `length` is
+    /// negative, everything from `offset` to the end of the file.
+    ///
+    /// Pages are mapped copy-on-write (so the input may be modified without
+    /// changing the file) and hinted for sequential access; they are only
+    /// read from disk when the program reaches them. On platforms without
+    /// `mmap`, the byte range is read into memory.
+    ForthInputBuffer(const std::string& filename,
+                     int64_t offset,
+                     int64_t length);
+
+    /// @brief Streams bytes from `source` in a window of at least
+    /// `chunk_size` bytes, so that inputs larger than memory can be read with
+    /// a bounded working set.
+    ///
+    /// `source(buffer, num_bytes)` must copy up to `num_bytes` bytes into
+    /// `buffer` and return how many it copied, returning 0 (or less) once
+    /// there is nothing more. If a read needs more than what is left in the
+    /// window, the unread bytes are moved to its front and the rest is
+    /// refilled, so reads that straddle two chunks are contiguous; the window
+    /// only grows if a single read, or a forward #seek or #skip, is larger
+    /// than it. (The skipped bytes are kept until the target is known to
+    /// exist, so a seek or skip beyond the end leaves the position unchanged.)
+    ///
+    /// Bytes before the window are dropped, so #seek and #skip can only go
+    /// backward within it. #len is -1 until the source is exhausted. An
+    /// exception thrown by `source` ends the input and is rethrown by
+    /// #maybe_throw.
+    ForthInputBuffer(
+      const std::function<int64_t(void* buffer, int64_t num_bytes)>& source,
+      int64_t chunk_size);
+
     /// @brief HERE
     void*
       read(int64_t num_bytes, util::ForthError& err) noexcept;
@@ -35,7 +71,7 @@ namespace awkward {
 
     /// @brief HERE
     bool
-      end() const noexcept;
+      end() noexcept;
 
     /// @brief HERE
     int64_t
@@ -45,11 +81,39 @@ namespace awkward {
     int64_t
       len() const noexcept;
 
+    /// @brief If true, this input is read from a `source` function and
+    /// cannot be restarted from the beginning.
+    bool
+      is_streaming() const noexcept;
+
+    /// @brief Rethrows the exception, if any, that stopped a streaming
+    /// input's `source`.
+    void
+      maybe_throw() const;
+
   private:
+    /// @brief Makes `num_bytes` bytes starting at #pos available in the
+    /// window, if the source has them.
+    bool
+      refill(int64_t num_bytes) noexcept;
+
+    /// @brief Reads bytes until position `to` is in the window, without
+    /// moving #pos.
+    bool
+      advance(int64_t to) noexcept;
+
     std::shared_ptr<void> ptr_;
     int64_t offset_;
     int64_t length_;
     int64_t pos_;
+
+    // Only used by streaming inputs: the first byte in ptr_ is at position
+    // base_ of the stream, and length_ is the end of what has been read.
+    std::function<int64_t(void* buffer, int64_t num_bytes)> source_;
+    int64_t capacity_;
+    int64_t base_;
+    bool exhausted_;
+    std::exception_ptr source_error_;
   };
 }
 
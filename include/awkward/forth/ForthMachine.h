@@ -31,10 +31,19 @@ namespace awkward {
                    int64_t stack_max_depth=1024,
                    int64_t recursion_max_depth=1024,
                    int64_t output_initial_size=1024,
-                   double output_resize_factor=1.5);
+                   double output_resize_factor=1.5,
+                   bool threaded=false);
 
     ~ForthMachineOf();
 
+    /// @brief Returns a new machine with this machine's compiled program and
+    /// settings, but none of its state, without compiling the source again.
+    ///
+    /// This machine is not changed, so it can serve as the program for any
+    /// number of copies, such as one per thread.
+    const std::shared_ptr<ForthMachineOf<T, I>>
+      copy_program() const;
+
     /// @brief HERE
     const std::string
       source() const noexcept;
@@ -75,6 +84,23 @@ namespace awkward {
     double
       output_resize_factor() const noexcept;
 
+    /// @brief If true, #run, #resume, and #call use threaded code: the
+    /// bytecodes are translated once, at construction, into a table of
+    /// instructions. On GCC and Clang, this becomes direct-threaded code
+    /// (each instruction jumps straight to the code of the next, through its
+    /// label address), and only `do` loops and the ends of calls go through
+    /// the interpreter's bookkeeping; other compilers decode the table.
+    /// Common sequences are fused into superinstructions:
+    ///
+    ///   - `x X-> stack  y <- stack` reads and writes one value;
+    ///   - `do x X-> y loop` with a fixed-width, native-endian read is one
+    ///     bulk read, like `x #X-> y`.
+    ///
+    /// The results, errors, and counts are the same as with the bytecode
+    /// interpreter, which #step always uses.
+    bool
+      threaded() const noexcept;
+
     /// @brief HERE
     const std::vector<T>
       stack() const;
@@ -242,6 +268,18 @@ namespace awkward {
     util::ForthError
       resume();
 
+    /// @brief Runs this machine's program once for each set of `inputs`,
+    /// each in its own #copy_program, on up to `num_threads` threads at a
+    /// time (0 means one per hardware thread).
+    ///
+    /// Returns the machines in the order of `inputs`, each with its own
+    /// outputs, stack, variables, and error (see #maybe_throw). This
+    /// machine is not changed.
+    const std::vector<std::shared_ptr<ForthMachineOf<T, I>>>
+      run_many(const std::vector<std::map<std::string,
+                                          std::shared_ptr<ForthInputBuffer>>>& inputs,
+               int64_t num_threads) const;
+
     /// @brief HERE
     util::ForthError
       call(const std::string& name);
@@ -336,6 +374,9 @@ namespace awkward {
     }
 
   private:
+    /// @brief Used by #copy_program.
+    ForthMachineOf(const ForthMachineOf<T, I>* program);
+
     /// @brief HERE
     bool
     segment_nonempty(int64_t segment_position) const;
@@ -373,10 +414,38 @@ namespace awkward {
             int64_t exitdepth,
             int64_t dodepth);
 
+    /// @brief Fills #threaded_bytecodes_ with the threaded-code instruction
+    /// for each bytecode position, and one to end each segment.
+    void
+      thread_bytecodes();
+
     /// @brief HERE
     void
       internal_run(bool single_step, int64_t recursion_target_depth_top); // noexcept
 
+    /// @brief Superinstruction for `x X-> stack  y <- stack` at bytecode
+    /// `position`; returns false (having done nothing) if it must be run as
+    /// two instructions.
+    bool
+      read_write_fused(int64_t position) noexcept;
+
+    /// @brief Superinstruction for `do x X-> y loop` at bytecode
+    /// `position`; returns false (having done nothing) if it must be run as a
+    /// loop.
+    bool
+      do_read_fused(int64_t position) noexcept;
+
+    /// @brief Runs a bulk parser (`#+*->`, `#%*->`, or `#@*->`, given as
+    /// its positive `parser` flags) from input `in_num` into output
+    /// `out_num`, without touching the stack.
+    void
+      read_bulk(I parser,
+                I in_num,
+                I out_num,
+                I dict_num,
+                int64_t num_items,
+                bool byteswap) noexcept;
+
     /// @brief HERE
     void
       write_from_stack(int64_t num, T* top) noexcept;
@@ -553,6 +622,20 @@ namespace awkward {
     std::vector<I> dictionary_bytecodes_;
     std::vector<int64_t> bytecodes_offsets_;
     std::vector<I> bytecodes_;
+    /// @brief Threaded-code instructions: each segment's bytecode positions,
+    /// then an end-of-segment instruction, so that segment `which`'s
+    /// position `where` is at `bytecodes_offsets_[which] + which + where`.
+    std::vector<I> threaded_bytecodes_;
+
+    /// @brief An instruction of direct-threaded code: the label address of
+    /// its code in internal_run and its bytecode (if any).
+    struct ThreadedInstruction {
+      const void* label;
+      I bytecode;
+    };
+    /// @brief #threaded_bytecodes_ as direct-threaded code, made by the
+    /// first threaded internal_run (with computed goto only).
+    std::vector<ThreadedInstruction> threaded_code_;
 
     std::vector<std::shared_ptr<ForthInputBuffer>> current_inputs_;
     std::vector<std::shared_ptr<ForthOutputBuffer>> current_outputs_;
@@ -570,6 +653,7 @@ namespace awkward {
     int64_t do_current_depth_;
 
     util::ForthError current_error_;
+    bool threaded_;
 
     int64_t count_instructions_;
     int64_t count_reads_;
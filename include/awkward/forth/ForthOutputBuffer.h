@@ -187,6 +187,23 @@ namespace awkward {
     virtual void
       write_add_int64(int64_t value) noexcept = 0;
 
+    /// @brief Writes the running sum of `num_items` values, continuing from
+    /// the last item (or 0 if empty), like `num_items` calls of the above.
+    virtual void
+      write_add_int64(int64_t num_items, int64_t* values) noexcept = 0;
+
+    /// @brief Writes `dictionary[index[i]]` for `num_items` indexes, where
+    /// `dictionary` has the same type as this buffer (and may be this
+    /// buffer).
+    ///
+    /// If any index is out of range, nothing is written and `err` is set to
+    /// `lookup_beyond`.
+    virtual void
+      write_lookup(int64_t num_items,
+                   int64_t* index,
+                   const ForthOutputBuffer& dictionary,
+                   util::ForthError& err) noexcept = 0;
+
   protected:
     int64_t length_;
     int64_t reserved_;
@@ -306,6 +323,15 @@ namespace awkward {
     void
       write_add_int64(int64_t value) noexcept override;
 
+    void
+      write_add_int64(int64_t num_items, int64_t* values) noexcept override;
+
+    void
+      write_lookup(int64_t num_items,
+                   int64_t* index,
+                   const ForthOutputBuffer& dictionary,
+                   util::ForthError& err) noexcept override;
+
   private:
 
     /// @brief HERE
@@ -13,6 +13,10 @@
 namespace awkward {
   class Content;
   using ContentPtr    = std::shared_ptr<Content>;
+  class Form;
+  using FormPtr       = std::shared_ptr<Form>;
+  class PartitionedArray;
+  using PartitionedArrayPtr = std::shared_ptr<PartitionedArray>;
 
   /// @class ToJson
   ///
@@ -36,6 +40,18 @@ namespace awkward {
     /// @brief Append a real value `x`.
     virtual void
       real(double x) = 0;
+    /// @brief Append `length` integer values from `x`.
+    ///
+    /// The default calls #integer for each; writers may format them in
+    /// bulk instead.
+    virtual void
+      integers(const int64_t* x, int64_t length);
+    /// @brief Append `length` real values from `x`.
+    ///
+    /// The default calls #real for each; writers may format them in bulk
+    /// instead.
+    virtual void
+      reals(const double* x, int64_t length);
     /// @brief Append a complex value `x`.
     virtual void
       complex(std::complex<double> x) = 0;
@@ -103,6 +119,14 @@ namespace awkward {
       integer(int64_t x) override;
     void
       real(double x) override;
+    /// @brief Formats the integers into a local buffer and writes them
+    /// all at once.
+    void
+      integers(const int64_t* x, int64_t length) override;
+    /// @brief Formats the reals (as #real would) into a local buffer and
+    /// writes them all at once.
+    void
+      reals(const double* x, int64_t length) override;
     void
       complex(std::complex<double> x) override;
     void
@@ -235,6 +259,14 @@ namespace awkward {
       integer(int64_t x) override;
     void
       real(double x) override;
+    /// @brief Formats the integers into a local buffer and writes them
+    /// all at once.
+    void
+      integers(const int64_t* x, int64_t length) override;
+    /// @brief Formats the reals (as #real would) into a local buffer and
+    /// writes them all at once.
+    void
+      reals(const double* x, int64_t length) override;
     void
       complex(std::complex<double> x) override;
     void
@@ -329,6 +361,12 @@ namespace awkward {
   /// @brief Convert a JSON-encoded string into a Content array using an
   /// ArrayBuilder.
   ///
+  /// The JSON is read in two stages: the first indexes the positions of
+  /// structural characters and values in a block of text, and the second
+  /// checks the grammar and fills the ArrayBuilder from that index. The
+  /// string may contain several concatenated JSON documents, which become
+  /// items of the output array (a single document is returned as-is).
+  ///
   /// @param source Null-terminated string containing any valid JSON data.
   /// @param options Configuration options for building an array with an
   /// ArrayBuilder.
@@ -338,16 +376,28 @@ namespace awkward {
   /// representation in JSON format
   /// @param minus_infinity_string user-defined string for a negative
   /// infinity representation in JSON format
+  /// @param lines If true, the source is in JSON-lines format: each document
+  /// must be on its own line, and the output is always an array of them
+  /// (even if there is only one).
+  /// @param form If not `nullptr`, the Form of the output array, which is
+  /// filled by a TypedArrayBuilder instead of an ArrayBuilder. The source
+  /// must be one JSON array of items of this Form or, if `lines`, one item
+  /// per line; any value that does not fit the Form is an error.
   LIBAWKWARD_EXPORT_SYMBOL const ContentPtr
     FromJsonString(const char* source,
                    const ArrayBuilderOptions& options,
                    const char* nan_string = nullptr,
                    const char* infinity_string = nullptr,
-                   const char* minus_infinity_string = nullptr);
+                   const char* minus_infinity_string = nullptr,
+                   bool lines = false,
+                   const FormPtr& form = nullptr);
 
   /// @brief Convert a JSON-encoded file into a Content array using an
   /// ArrayBuilder.
   ///
+  /// See FromJsonString; the file is read in blocks of `buffersize` bytes
+  /// (more if one document doesn't fit).
+  ///
   /// @param source C file handle to a file containing any valid JSON data.
   /// @param options Configuration options for building an array with an
   /// ArrayBuilder.
@@ -358,13 +408,80 @@ namespace awkward {
   /// representation in JSON format
   /// @param minus_infinity_string user-defined string for a negative
   /// infinity representation in JSON format
+  /// @param lines If true, the file is in JSON-lines format (see
+  /// FromJsonString).
+  /// @param form If not `nullptr`, the Form of the output array (see
+  /// FromJsonString).
   LIBAWKWARD_EXPORT_SYMBOL const ContentPtr
     FromJsonFile(FILE* source,
                  const ArrayBuilderOptions& options,
                  int64_t buffersize,
                  const char* nan_string = nullptr,
                  const char* infinity_string = nullptr,
-                 const char* minus_infinity_string = nullptr);
+                 const char* minus_infinity_string = nullptr,
+                 bool lines = false,
+                 const FormPtr& form = nullptr);
+
+  /// @brief Convert a string in JSON-lines format into a PartitionedArray,
+  /// reading chunks of lines on separate threads.
+  ///
+  /// The string is cut at newlines into chunks of a few MiB or more, and
+  /// each chunk is read into its own builder. With a `form`, each chunk is
+  /// a partition of the output (all of that Form). Without one, chunks may
+  /// have different types, so they are merged into one partition (see
+  /// Content::mergemany); the type may differ from what FromJsonString
+  /// would make, since, for instance, records in different chunks with
+  /// different fields are merged as a union.
+  ///
+  /// @param source Null-terminated string with one JSON document per line.
+  /// @param options Configuration options for the builders.
+  /// @param num_threads Maximum number of threads; 0 means one per hardware
+  /// thread.
+  /// @param nan_string user-defined string for a not-a-number (NaN) value
+  /// representation in JSON format
+  /// @param infinity_string user-defined string for a positive infinity
+  /// representation in JSON format
+  /// @param minus_infinity_string user-defined string for a negative
+  /// infinity representation in JSON format
+  /// @param form If not `nullptr`, the Form of each line (see
+  /// FromJsonString).
+  LIBAWKWARD_EXPORT_SYMBOL const PartitionedArrayPtr
+    FromJsonLinesString(const char* source,
+                        const ArrayBuilderOptions& options,
+                        int64_t num_threads,
+                        const char* nan_string = nullptr,
+                        const char* infinity_string = nullptr,
+                        const char* minus_infinity_string = nullptr,
+                        const FormPtr& form = nullptr);
+
+  /// @brief Convert a file in JSON-lines format into a PartitionedArray,
+  /// reading chunks of lines on separate threads.
+  ///
+  /// See FromJsonLinesString; the file is read in rounds of up to one chunk
+  /// per thread, so memory use is bounded by the number of threads.
+  ///
+  /// @param source C file handle to a file with one JSON document per line.
+  /// @param options Configuration options for the builders.
+  /// @param buffersize Minimum number of bytes in a chunk.
+  /// @param num_threads Maximum number of threads; 0 means one per hardware
+  /// thread.
+  /// @param nan_string user-defined string for a not-a-number (NaN) value
+  /// representation in JSON format
+  /// @param infinity_string user-defined string for a positive infinity
+  /// representation in JSON format
+  /// @param minus_infinity_string user-defined string for a negative
+  /// infinity representation in JSON format
+  /// @param form If not `nullptr`, the Form of each line (see
+  /// FromJsonString).
+  LIBAWKWARD_EXPORT_SYMBOL const PartitionedArrayPtr
+    FromJsonLinesFile(FILE* source,
+                      const ArrayBuilderOptions& options,
+                      int64_t buffersize,
+                      int64_t num_threads,
+                      const char* nan_string = nullptr,
+                      const char* infinity_string = nullptr,
+                      const char* minus_infinity_string = nullptr,
+                      const FormPtr& form = nullptr);
 
 }
 
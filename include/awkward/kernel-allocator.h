@@ -0,0 +1,236 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_KERNEL_ALLOCATOR_H_
+#define AWKWARD_KERNEL_ALLOCATOR_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "awkward/common.h"
+
+namespace awkward {
+  namespace kernel {
+    /// @brief Counters kept by every Allocator.
+    struct LIBAWKWARD_EXPORT_SYMBOL AllocatorStats {
+      /// @brief Number of (non-empty) buffers allocated.
+      int64_t num_allocations;
+      /// @brief Number of buffers freed.
+      int64_t num_deallocations;
+      /// @brief Total number of bytes ever requested.
+      int64_t bytes_allocated;
+      /// @brief Number of bytes requested and not yet freed.
+      int64_t bytes_in_use;
+      /// @brief Highest #bytes_in_use so far.
+      int64_t peak_bytes_in_use;
+    };
+
+    /// @class Allocator
+    ///
+    /// @brief Abstract source of main-memory array buffers, which
+    /// kernel::malloc uses for `kernel::lib::cpu` when the calling thread
+    /// has selected one (see #set_thread_allocator).
+    ///
+    /// Subclasses implement #allocate_bytes and #deallocate_bytes; this class
+    /// counts what passes through them (see #stats). Buffers may be freed on
+    /// any thread, so both must be thread-safe.
+    ///
+    /// See also
+    ///   - #register_allocator to make one selectable by name.
+    class LIBAWKWARD_EXPORT_SYMBOL Allocator {
+    public:
+      Allocator();
+
+      /// @brief Empty destructor; required for some C++ reason.
+      virtual ~Allocator();
+
+      /// @brief Short description of the backend, such as `"arena"`.
+      virtual const std::string
+        classname() const = 0;
+
+      /// @brief Returns a buffer of at least `bytelength` bytes (or nullptr
+      /// if `bytelength` is zero).
+      void*
+        allocate(int64_t bytelength);
+
+      /// @brief Frees a buffer returned by #allocate with the same
+      /// `bytelength`.
+      void
+        deallocate(void* ptr, int64_t bytelength);
+
+      /// @brief Snapshot of this allocator's counters.
+      const AllocatorStats
+        stats() const;
+
+      /// @brief Sets all counters to zero, except that #bytes_in_use (and
+      /// the peak) continue to count buffers that have not been freed.
+      void
+        reset_stats();
+
+    protected:
+      /// @brief Returns a buffer of `bytelength > 0` bytes.
+      virtual void*
+        allocate_bytes(int64_t bytelength) = 0;
+
+      /// @brief Frees a buffer of `bytelength > 0` bytes.
+      virtual void
+        deallocate_bytes(void* ptr, int64_t bytelength) = 0;
+
+    private:
+      std::atomic<int64_t> num_allocations_;
+      std::atomic<int64_t> num_deallocations_;
+      std::atomic<int64_t> bytes_allocated_;
+      std::atomic<int64_t> bytes_in_use_;
+      std::atomic<int64_t> peak_bytes_in_use_;
+    };
+
+    using AllocatorPtr = std::shared_ptr<Allocator>;
+
+    /// @class MallocAllocator
+    ///
+    /// @brief Allocator that calls `awkward_malloc` and `awkward_free`, the
+    /// same as when no allocator is selected, but with #stats.
+    class LIBAWKWARD_EXPORT_SYMBOL MallocAllocator: public Allocator {
+    public:
+      const std::string
+        classname() const override;
+
+    protected:
+      void*
+        allocate_bytes(int64_t bytelength) override;
+
+      void
+        deallocate_bytes(void* ptr, int64_t bytelength) override;
+    };
+
+    /// @class ArenaAllocator
+    ///
+    /// @brief Allocator that carves small buffers out of large blocks by
+    /// advancing a pointer, for the many short-lived intermediate arrays
+    /// (carries, offsets, parents) of getitem and reducer chains.
+    ///
+    /// A block is freed when all of the buffers carved out of it have been
+    /// freed; the block being filled is rewound to its beginning instead. If
+    /// intermediates die in roughly the order they are made, the same block
+    /// is reused over and over without calling `malloc`. Buffers larger than
+    /// a quarter of a block are allocated directly with `awkward_malloc`.
+    class LIBAWKWARD_EXPORT_SYMBOL ArenaAllocator: public Allocator {
+    public:
+      /// @brief Creates an ArenaAllocator.
+      ///
+      /// @param blocksize Size of each block in bytes, rounded up to a power
+      /// of two (at least 4096).
+      ArenaAllocator(int64_t blocksize);
+
+      ~ArenaAllocator();
+
+      const std::string
+        classname() const override;
+
+      /// @brief Size of each block in bytes.
+      int64_t
+        blocksize() const;
+
+      /// @brief Number of blocks currently allocated.
+      int64_t
+        num_blocks() const;
+
+    protected:
+      void*
+        allocate_bytes(int64_t bytelength) override;
+
+      void
+        deallocate_bytes(void* ptr, int64_t bytelength) override;
+
+    private:
+      struct Impl;
+      std::unique_ptr<Impl> impl_;
+    };
+
+    /// @class HugePageAllocator
+    ///
+    /// @brief Allocator that maps large buffers (at least 2 MiB) directly
+    /// from the operating system in whole 2 MiB pages and asks for them to
+    /// be backed by transparent huge pages, reducing TLB misses when
+    /// kernels stream through them.
+    ///
+    /// Smaller buffers, and all buffers on systems other than Linux, are
+    /// allocated with `awkward_malloc`.
+    class LIBAWKWARD_EXPORT_SYMBOL HugePageAllocator: public Allocator {
+    public:
+      /// @brief Size of a huge page and smallest buffer that is mapped.
+      static const int64_t page_size = 2097152;
+
+      const std::string
+        classname() const override;
+
+    protected:
+      void*
+        allocate_bytes(int64_t bytelength) override;
+
+      void
+        deallocate_bytes(void* ptr, int64_t bytelength) override;
+    };
+
+    /// @brief Makes `allocator` selectable as `name`, replacing any
+    /// allocator with that name (buffers that it has already allocated
+    /// still free themselves through it).
+    ///
+    /// `"malloc"`, `"arena"` (4 MiB blocks), and `"hugepage"` are registered
+    /// from the start.
+    void
+      register_allocator(const std::string& name,
+                         const AllocatorPtr& allocator);
+
+    /// @brief Returns the allocator registered as `name`; raises an error if
+    /// there isn't one.
+    const AllocatorPtr
+      get_allocator(const std::string& name);
+
+    /// @brief Names of all registered allocators.
+    const std::vector<std::string>
+      allocator_names();
+
+    /// @brief The allocator that kernel::malloc uses on this thread, or
+    /// nullptr for plain `awkward_malloc` (the default).
+    const AllocatorPtr&
+      thread_allocator();
+
+    /// @brief Selects the allocator that kernel::malloc uses on this thread
+    /// (nullptr for plain `awkward_malloc`).
+    ///
+    /// The threads of #parallel_for and #parallel_tasks use the selection of
+    /// the thread that called them.
+    void
+      set_thread_allocator(const AllocatorPtr& allocator);
+
+    /// @brief Selects a registered allocator by name for this thread; an
+    /// empty `name` selects plain `awkward_malloc`.
+    void
+      set_thread_allocator(const std::string& name);
+
+    /// @class AllocatorScope
+    ///
+    /// @brief Selects an allocator for this thread until it goes out of
+    /// scope, then restores the previous selection.
+    class LIBAWKWARD_EXPORT_SYMBOL AllocatorScope {
+    public:
+      AllocatorScope(const AllocatorPtr& allocator);
+
+      AllocatorScope(const std::string& name);
+
+      ~AllocatorScope();
+
+      AllocatorScope(const AllocatorScope&) = delete;
+
+      AllocatorScope&
+        operator=(const AllocatorScope&) = delete;
+
+    private:
+      AllocatorPtr previous_;
+    };
+  }
+}
+
+#endif // AWKWARD_KERNEL_ALLOCATOR_H_
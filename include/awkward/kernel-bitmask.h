@@ -0,0 +1,62 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_KERNEL_BITMASK_H_
+#define AWKWARD_KERNEL_BITMASK_H_
+
+// Header-only helpers shared by the awkward_BitMaskedArray_* kernels that work
+// on Arrow-style validity bitmaps directly, without expanding them into one
+// byte (or one int64) per item. It is not part of the public kernel interface.
+//
+// Bit `i` of a bitmap is in byte `i / 8`, counting from the least significant
+// bit if `lsb_order` and from the most significant bit otherwise. Whether a
+// set bit means valid or missing is up to the caller (`validwhen`).
+
+#include <cstring>
+
+#include "awkward/common.h"
+
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+/// Returns bit `i` of a bitmap.
+inline bool
+bitmask_get(const uint8_t* bitmask, int64_t i, bool lsb_order) {
+  uint8_t byte = bitmask[i >> 3];
+  return lsb_order ? ((byte >> (i & 7)) & 1) != 0
+                   : ((byte << (i & 7)) & 128) != 0;
+}
+
+/// Sets bit `i` of a bitmap to `value`.
+inline void
+bitmask_set(uint8_t* bitmask, int64_t i, bool value, bool lsb_order) {
+  uint8_t bit = (uint8_t)(lsb_order ? (1 << (i & 7)) : (128 >> (i & 7)));
+  if (value) {
+    bitmask[i >> 3] |= bit;
+  }
+  else {
+    bitmask[i >> 3] &= (uint8_t)~bit;
+  }
+}
+
+/// Returns the 64 bits of items `[64*word, 64*word + 64)` as one word: all
+/// zeros or all ones mean that those items are all unset or all set,
+/// regardless of bit order and endianness.
+inline uint64_t
+bitmask_word(const uint8_t* bitmask, int64_t word) {
+  uint64_t out;
+  std::memcpy(&out, bitmask + word*8, sizeof(uint64_t));
+  return out;
+}
+
+/// Number of set bits in a word.
+inline int64_t
+bitmask_popcount(uint64_t word) {
+#ifdef _MSC_VER
+  return (int64_t)__popcnt64(word);
+#else
+  return (int64_t)__builtin_popcountll(word);
+#endif
+}
+
+#endif // AWKWARD_KERNEL_BITMASK_H_
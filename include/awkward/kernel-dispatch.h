@@ -7,6 +7,7 @@
 #include "awkward/util.h"
 #include "awkward/kernel-utils.h"
 #include "awkward/kernels.h"
+#include "awkward/kernel-allocator.h"
 
 #include <sstream>
 
@@ -108,6 +109,35 @@ namespace awkward {
         }
     };
 
+    /// @class allocator_deleter
+    ///
+    /// @brief Used as a `std::shared_ptr` deleter (second argument) to
+    /// return an array buffer to the Allocator that made it.
+    ///
+    /// The deleter keeps the Allocator alive and remembers the buffer's
+    /// size, which allocators like ArenaAllocator need to free it.
+    ///
+    /// See also
+    ///   - array_deleter, which frees buffers from `awkward_malloc`.
+    template <typename T>
+    class LIBAWKWARD_EXPORT_SYMBOL allocator_deleter {
+    public:
+        allocator_deleter(const AllocatorPtr& allocator, int64_t bytelength)
+            : allocator_(allocator)
+            , bytelength_(bytelength) { }
+
+        /// @brief Called by `std::shared_ptr` when its reference count reaches
+        /// zero.
+        void operator()(T const *ptr) {
+          allocator_.get()->deallocate(
+            reinterpret_cast<void*>(const_cast<T*>(ptr)), bytelength_);
+        }
+
+    private:
+        AllocatorPtr allocator_;
+        int64_t bytelength_;
+    };
+
     /// @class no_deleter
     ///
     /// @brief Used as a `std::shared_ptr` deleter (second argument) to
@@ -166,12 +196,21 @@ namespace awkward {
     /// with a given type. The `bytelength` parameter is the number of bytes,
     /// so be sure to multiply by sizeof(...) when using this function.
     ///
+    /// For `kernel::lib::cpu`, the buffer comes from the calling thread's
+    /// Allocator (see set_thread_allocator), if one has been selected.
+    ///
     /// @note This function has not been implemented to handle Multi-GPU setups.
     template <typename T>
     std::shared_ptr<T> malloc(
       kernel::lib ptr_lib,
       int64_t bytelength) {
       if (ptr_lib == lib::cpu) {
+        const AllocatorPtr& allocator = thread_allocator();
+        if (allocator.get() != nullptr) {
+          return std::shared_ptr<T>(
+            reinterpret_cast<T*>(allocator.get()->allocate(bytelength)),
+            kernel::allocator_deleter<T>(allocator, bytelength));
+        }
         return std::shared_ptr<T>(
           reinterpret_cast<T*>(awkward_malloc(bytelength)),
           kernel::array_deleter<T>());
@@ -375,6 +414,18 @@ namespace awkward {
       int64_t length,
       int64_t stride);
 
+    ERROR NumpyArray_fused_elementwise_64(
+      kernel::lib ptr_lib,
+      double* toptr,
+      const double** fromptrs,
+      const int64_t* program,
+      int64_t programlength,
+      const double* constants,
+      double* stack,
+      int64_t stackdepth,
+      int64_t blocksize,
+      int64_t length);
+
     template <typename T>
     ERROR ListArray_getitem_next_at_64(
       kernel::lib ptr_lib,
@@ -595,6 +646,14 @@ namespace awkward {
       int64_t lenindex,
       int64_t lencarry);
 
+    ERROR IndexedArray64_getitem_compose_64(
+      kernel::lib ptr_lib,
+      int64_t* toindex,
+      const int64_t* outerindex,
+      const int64_t* innerindex,
+      int64_t lenouter,
+      int64_t leninner);
+
     template <typename T>
     ERROR UnionArray_regular_index_getsize(
       kernel::lib ptr_lib,
@@ -1020,6 +1079,15 @@ namespace awkward {
       const T* fromstops,
       int64_t lencontent);
 
+    ERROR RecordArray_getitem_carry_fields_64(
+      kernel::lib ptr_lib,
+      uint8_t** toptrs,
+      const uint8_t** fromptrs,
+      const int64_t* strides,
+      int64_t numfields,
+      const int64_t* carry,
+      int64_t lencarry);
+
     ERROR RegularArray_broadcast_tooffsets_64(
       kernel::lib ptr_lib,
       const int64_t* fromoffsets,
@@ -1387,6 +1455,20 @@ namespace awkward {
       const T* stops,
       int64_t length);
 
+    ERROR ListArray_combinations_chunk_64(
+      kernel::lib ptr_lib,
+      int64_t** tocarry,
+      int64_t* toparents,
+      int64_t* tolength,
+      int64_t* index,
+      int64_t* position,
+      int64_t n,
+      bool replacement,
+      const int64_t* starts,
+      const int64_t* stops,
+      int64_t length,
+      int64_t maxlength);
+
     ERROR RegularArray_combinations_64(
       kernel::lib ptr_lib,
       int64_t** tocarry,
@@ -1405,6 +1487,68 @@ namespace awkward {
       int64_t length,
       bool validwhen);
 
+    ERROR BitMaskedArray_getitem_carry_64(
+      kernel::lib ptr_lib,
+      uint8_t* tobitmask,
+      const uint8_t* frombitmask,
+      int64_t length,
+      const int64_t* fromcarry,
+      int64_t lencarry,
+      bool lsb_order);
+
+    ERROR BitMaskedArray_getitem_nextcarry_64(
+      kernel::lib ptr_lib,
+      int64_t* tocarry,
+      const uint8_t* frombitmask,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+
+    ERROR BitMaskedArray_getitem_nextcarry_outindex_64(
+      kernel::lib ptr_lib,
+      int64_t* tocarry,
+      int64_t* outindex,
+      const uint8_t* frombitmask,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+
+    ERROR BitMaskedArray_getitem_range(
+      kernel::lib ptr_lib,
+      uint8_t* tobitmask,
+      const uint8_t* frombitmask,
+      int64_t start,
+      int64_t length,
+      bool lsb_order);
+
+    ERROR BitMaskedArray_numnull(
+      kernel::lib ptr_lib,
+      int64_t* numnull,
+      const uint8_t* frombitmask,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+
+    ERROR BitMaskedArray_overlay_mask(
+      kernel::lib ptr_lib,
+      uint8_t* tobitmask,
+      const uint8_t* outerbitmask,
+      bool outervalidwhen,
+      const uint8_t* innerbitmask,
+      bool innervalidwhen,
+      int64_t bitmasklength);
+
+    ERROR BitMaskedArray_reduce_next_64(
+      kernel::lib ptr_lib,
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* outindex,
+      const uint8_t* frombitmask,
+      const int64_t* parents,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order);
+
     ERROR BitMaskedArray_to_ByteMaskedArray(
       kernel::lib ptr_lib,
       int8_t* tobytemask,
@@ -1430,6 +1574,12 @@ namespace awkward {
       int64_t lenparents,
       int64_t outlength);
 
+    ERROR reduce_count_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t* toptr,
+      const int64_t* offsets,
+      int64_t outlength);
+
     template <typename IN>
     ERROR reduce_countnonzero_64(
       kernel::lib ptr_lib,
@@ -1439,6 +1589,14 @@ namespace awkward {
       int64_t lenparents,
       int64_t outlength);
 
+    template <typename IN>
+    ERROR reduce_countnonzero_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t* toptr,
+      const IN* fromptr,
+      const int64_t* offsets,
+      int64_t outlength);
+
     template <typename OUT, typename IN>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
@@ -1448,6 +1606,14 @@ namespace awkward {
       int64_t lenparents,
       int64_t outlength);
 
+    template <typename OUT, typename IN>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      OUT* toptr,
+      const IN* fromptr,
+      const int64_t* offsets,
+      int64_t outlength);
+
     template <typename IN>
     ERROR reduce_sum_bool_64(
       kernel::lib ptr_lib,
@@ -1466,6 +1632,14 @@ namespace awkward {
       int64_t lenparents,
       int64_t outlength);
 
+    template <typename OUT, typename IN>
+    ERROR reduce_prod_offsets_64(
+      kernel::lib ptr_lib,
+      OUT* toptr,
+      const IN* fromptr,
+      const int64_t* offsets,
+      int64_t outlength);
+
     template <typename IN>
     ERROR reduce_prod_bool_64(
       kernel::lib ptr_lib,
@@ -1485,6 +1659,15 @@ namespace awkward {
       int64_t outlength,
       OUT identity);
 
+    template <typename OUT, typename IN>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      OUT* toptr,
+      const IN* fromptr,
+      const int64_t* offsets,
+      int64_t outlength,
+      OUT identity);
+
     template <typename OUT, typename IN>
     ERROR reduce_max_64(
       kernel::lib ptr_lib,
@@ -1495,6 +1678,15 @@ namespace awkward {
       int64_t outlength,
       OUT identity);
 
+    template <typename OUT, typename IN>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      OUT* toptr,
+      const IN* fromptr,
+      const int64_t* offsets,
+      int64_t outlength,
+      OUT identity);
+
     template <typename OUT, typename IN>
     ERROR reduce_argmin_64(
       kernel::lib ptr_lib,
@@ -1654,6 +1846,12 @@ namespace awkward {
       int64_t lenparents,
       int64_t outlength);
 
+    ERROR NumpyArray_reduce_mask_ByteMaskedArray_offsets_64(
+      kernel::lib ptr_lib,
+      int8_t* toptr,
+      const int64_t* offsets,
+      int64_t outlength);
+
     ERROR ByteMaskedArray_reduce_next_64(
       kernel::lib ptr_lib,
       int64_t* nextcarry,
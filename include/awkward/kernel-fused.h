@@ -0,0 +1,51 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_KERNEL_FUSED_H_
+#define AWKWARD_KERNEL_FUSED_H_
+
+// Opcodes of the postfix programs evaluated by
+// awkward_NumpyArray_fused_elementwise_64. It is not part of the public kernel
+// interface: libawkward translates ufunc names into these numbers.
+//
+// A program is a sequence of (opcode, argument) pairs. FUSED_INPUT and
+// FUSED_CONSTANT push their argument-th input or constant onto the stack,
+// unary opcodes replace the top of the stack, and binary opcodes replace the
+// top two (left operand below right operand) with one.
+
+enum fused_opcode {
+  FUSED_INPUT = 0,
+  FUSED_CONSTANT = 1,
+
+  FUSED_NEGATIVE = 10,
+  FUSED_POSITIVE = 11,
+  FUSED_ABSOLUTE = 12,
+  FUSED_SQUARE = 13,
+  FUSED_SQRT = 14,
+  FUSED_CBRT = 15,
+  FUSED_EXP = 16,
+  FUSED_EXPM1 = 17,
+  FUSED_LOG = 18,
+  FUSED_LOG1P = 19,
+  FUSED_LOG10 = 20,
+  FUSED_SIN = 21,
+  FUSED_COS = 22,
+  FUSED_TAN = 23,
+  FUSED_ARCSIN = 24,
+  FUSED_ARCCOS = 25,
+  FUSED_ARCTAN = 26,
+  FUSED_SINH = 27,
+  FUSED_COSH = 28,
+  FUSED_TANH = 29,
+
+  FUSED_ADD = 100,
+  FUSED_SUBTRACT = 101,
+  FUSED_MULTIPLY = 102,
+  FUSED_DIVIDE = 103,
+  FUSED_POWER = 104,
+  FUSED_ARCTAN2 = 105,
+  FUSED_HYPOT = 106,
+  FUSED_MAXIMUM = 107,
+  FUSED_MINIMUM = 108
+};
+
+#endif // AWKWARD_KERNEL_FUSED_H_
@@ -0,0 +1,119 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_KERNEL_PARALLEL_H_
+#define AWKWARD_KERNEL_PARALLEL_H_
+
+#include <functional>
+
+#include "awkward/common.h"
+
+namespace awkward {
+  namespace kernel {
+    /// @brief Arrays shorter than this are never split across threads.
+    const int64_t kParallelMinLength = 65536;
+
+    /// @brief Number of threads that data-parallel CPU kernels may use.
+    ///
+    /// The default is 1, which runs every kernel on the calling thread, as
+    /// before. On first use, it is read from the `AWKWARD_NUM_THREADS`
+    /// environment variable, if set.
+    int64_t
+      num_threads();
+
+    /// @brief Sets the number of threads that data-parallel CPU kernels may
+    /// use; 0 means one per hardware thread.
+    ///
+    /// More worker threads are started on the next parallel call, if
+    /// needed.
+    void
+      set_num_threads(int64_t num_threads);
+
+    /// @brief Splits `[0, length)` into contiguous chunks and calls `chunk`
+    /// with each `start` and `stop`, in parallel if #num_threads is more
+    /// than 1 and `length` is at least #kParallelMinLength.
+    ///
+    /// Returns the first failure in index order, with its `identity`
+    /// shifted by the chunk's `start` (so that kernels which report their
+    /// loop index for a chunk report it for the whole array).
+    ///
+    /// Calls made from a worker thread run serially on that thread.
+    ERROR
+      parallel_for(int64_t length,
+                   const std::function<ERROR(int64_t start,
+                                             int64_t stop)>& chunk);
+
+    /// @brief Calls `task(i)` for each `i` in `[0, numtasks)`, spread over
+    /// up to #num_threads threads, which take the next unstarted task as they
+    /// become free.
+    ///
+    /// Unlike #parallel_for, there is no minimum size: each task is assumed
+    /// to be large (such as one partition of a PartitionedArray). Parallel
+    /// kernels called by the tasks run serially. The first exception thrown
+    /// by a task is rethrown after all tasks have finished or been skipped.
+    void
+      parallel_tasks(int64_t numtasks,
+                     const std::function<void(int64_t i)>& task);
+
+    /// @brief Same as above, but with up to `num_threads` threads instead of
+    /// #num_threads (0 means one per hardware thread).
+    void
+      parallel_tasks(int64_t numtasks,
+                     const std::function<void(int64_t i)>& task,
+                     int64_t num_threads);
+
+    /// @brief Two-pass parallel version of a kernel that fills
+    /// `tooffsets[0, length]` with a running sum, starting at 0.
+    ///
+    /// The `chunk` function must fill `chunkoffsets[0, stop - start]` with
+    /// the running sum for items `[start, stop)`, starting at 0. Each chunk
+    /// is computed independently, then shifted by the total of the chunks
+    /// before it.
+    ERROR
+      parallel_offsets(int64_t* tooffsets,
+                       int64_t length,
+                       const std::function<ERROR(int64_t* chunkoffsets,
+                                                 int64_t start,
+                                                 int64_t stop)>& chunk);
+
+    /// @brief Number of background threads for #background tasks; 4 by
+    /// default.
+    int64_t
+      num_background_threads();
+
+    /// @brief Sets the number of background threads; 0 means one per
+    /// hardware thread.
+    ///
+    /// The background pool only grows: lowering this setting does not stop
+    /// threads that have already started.
+    void
+      set_num_background_threads(int64_t num_threads);
+
+    /// @brief Runs `task` later on a background thread and returns
+    /// immediately.
+    ///
+    /// Background threads are separate from the ones that #parallel_for and
+    /// #parallel_tasks use, so tasks that spend their time waiting (such as
+    /// reading and decompressing data for VirtualArray::prefetch) do not
+    /// delay computations. Parallel kernels called by the tasks run
+    /// serially. The task must not throw.
+    ///
+    /// Background threads are never joined, so the process does not wait
+    /// for unfinished tasks when it exits.
+    void
+      background(const std::function<void()>& task);
+
+    /// @brief Calls `block`, which waits for a #background task, through the
+    /// function set by #set_background_wait (if any).
+    void
+      background_wait(const std::function<void()>& block);
+
+    /// @brief Sets a function that wraps every #background_wait, such as one
+    /// that releases a lock that the background task may need (the Python
+    /// GIL) while `block` runs.
+    void
+      set_background_wait(
+        const std::function<void(const std::function<void()>& block)>& wrap);
+  }
+}
+
+#endif // AWKWARD_KERNEL_PARALLEL_H_
@@ -0,0 +1,318 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARD_KERNEL_SORTING_H_
+#define AWKWARD_KERNEL_SORTING_H_
+
+// Header-only sorting engine shared by the awkward_sort and awkward_argsort
+// kernels. It is not part of the public kernel interface.
+//
+// Each sublist is sorted independently, directly on the values (or on its own
+// slice of the output index), choosing an algorithm by its length:
+//
+//   * short sublists (the common case for jagged data) use an insertion
+//     sort, which needs no scratch space and is stable;
+//   * long sublists of numbers use a least-significant-digit radix sort on
+//     an order-preserving unsigned key, skipping digits that all values
+//     share;
+//   * everything in between uses the standard library's comparison sorts
+//     (std::sort, unless a stable sort is requested).
+//
+// Both kinds of path order values the same way: -0.0 and +0.0 are equal,
+// and NaN comes after every number, in either direction (as in NumPy).
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+#include "awkward/common.h"
+
+const int64_t kSmallSortLength = 16;   // insertion sort at or below this
+const int64_t kRadixSortLength = 256;  // radix sort at or above this
+
+/// Maps a value to an unsigned integer with the same ordering.
+template <typename T>
+struct radix_key { };
+
+template <>
+struct radix_key<bool> {
+  typedef uint8_t type;
+  static type get(bool x) { return (type)x; }
+};
+
+template <>
+struct radix_key<uint8_t> {
+  typedef uint8_t type;
+  static type get(uint8_t x) { return x; }
+};
+
+template <>
+struct radix_key<uint16_t> {
+  typedef uint16_t type;
+  static type get(uint16_t x) { return x; }
+};
+
+template <>
+struct radix_key<uint32_t> {
+  typedef uint32_t type;
+  static type get(uint32_t x) { return x; }
+};
+
+template <>
+struct radix_key<uint64_t> {
+  typedef uint64_t type;
+  static type get(uint64_t x) { return x; }
+};
+
+template <>
+struct radix_key<int8_t> {
+  typedef uint8_t type;
+  static type get(int8_t x) { return (type)x ^ (type)0x80; }
+};
+
+template <>
+struct radix_key<int16_t> {
+  typedef uint16_t type;
+  static type get(int16_t x) { return (type)x ^ (type)0x8000; }
+};
+
+template <>
+struct radix_key<int32_t> {
+  typedef uint32_t type;
+  static type get(int32_t x) { return (type)x ^ (type)0x80000000; }
+};
+
+template <>
+struct radix_key<int64_t> {
+  typedef uint64_t type;
+  static type get(int64_t x) { return (type)x ^ (type)0x8000000000000000; }
+};
+
+// IEEE 754: flip all bits of negative numbers and only the sign bit of
+// positive numbers. Zeros of either sign get the key of +0.0, so that they
+// compare equal; NaN is handled by sorting_key.
+template <>
+struct radix_key<float> {
+  typedef uint32_t type;
+  static type get(float x) {
+    type bits = 0;
+    if (x != 0) {
+      std::memcpy(&bits, &x, sizeof(type));
+    }
+    return (bits & (type)0x80000000) ? ~bits : (bits | (type)0x80000000);
+  }
+};
+
+template <>
+struct radix_key<double> {
+  typedef uint64_t type;
+  static type get(double x) {
+    type bits = 0;
+    if (x != 0) {
+      std::memcpy(&bits, &x, sizeof(type));
+    }
+    return (bits & (type)0x8000000000000000)
+               ? ~bits : (bits | (type)0x8000000000000000);
+  }
+};
+
+template <typename T>
+bool
+sorting_isnan(T x) {
+  return x != x;
+}
+
+template <typename T>
+typename radix_key<T>::type
+sorting_key(T x, bool ascending) {
+  typedef typename radix_key<T>::type K;
+  // NaN gets the largest key in both directions. No number has that key:
+  // it would be the (complemented) key of a NaN bit pattern.
+  if (sorting_isnan(x)) {
+    return ~(K)0;
+  }
+  // Complementing the key reverses the order without giving up stability.
+  K key = radix_key<T>::get(x);
+  return ascending ? key : (K)~key;
+}
+
+/// The order that sorting_key encodes, for the comparison sorts.
+template <typename T>
+bool
+sorting_before(T left, T right, bool ascending) {
+  if (sorting_isnan(left)) {
+    return false;
+  }
+  if (sorting_isnan(right)) {
+    return true;
+  }
+  return ascending ? (left < right) : (left > right);
+}
+
+/// Stable insertion sort of `length` values, in place.
+template <typename T>
+void
+small_sort(T* values, int64_t length, bool ascending) {
+  for (int64_t i = 1;  i < length;  i++) {
+    T x = values[i];
+    int64_t j = i;
+    while (j > 0  &&  sorting_before(x, values[j - 1], ascending)) {
+      values[j] = values[j - 1];
+      j--;
+    }
+    values[j] = x;
+  }
+}
+
+/// Stable insertion sort of `length` local indexes into `values`, in place.
+template <typename T>
+void
+small_argsort(int64_t* index, const T* values, int64_t length, bool ascending) {
+  for (int64_t i = 1;  i < length;  i++) {
+    int64_t x = index[i];
+    int64_t j = i;
+    while (j > 0  &&  sorting_before(values[x], values[index[j - 1]], ascending)) {
+      index[j] = index[j - 1];
+      j--;
+    }
+    index[j] = x;
+  }
+}
+
+/// Stable LSD radix sort of `length` values, in place; `scratch` must hold
+/// at least `length` values.
+template <typename T>
+void
+radix_sort(T* values, T* scratch, int64_t length, bool ascending) {
+  typedef typename radix_key<T>::type K;
+  T* from = values;
+  T* to = scratch;
+  int64_t counts[256];
+  for (size_t shift = 0;  shift < 8*sizeof(K);  shift += 8) {
+    std::fill(counts, counts + 256, 0);
+    for (int64_t i = 0;  i < length;  i++) {
+      counts[(sorting_key(from[i], ascending) >> shift) & 0xff]++;
+    }
+    if (*std::max_element(counts, counts + 256) == length) {
+      continue;   // every value has the same digit: nothing to do
+    }
+    int64_t total = 0;
+    for (int64_t b = 0;  b < 256;  b++) {
+      int64_t count = counts[b];
+      counts[b] = total;
+      total += count;
+    }
+    for (int64_t i = 0;  i < length;  i++) {
+      to[counts[(sorting_key(from[i], ascending) >> shift) & 0xff]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != values) {
+    std::copy(from, from + length, values);
+  }
+}
+
+/// Stable LSD radix sort of `length` local indexes into `values`, in place;
+/// `scratch` must hold at least `length` indexes.
+template <typename T>
+void
+radix_argsort(int64_t* index,
+              int64_t* scratch,
+              const T* values,
+              int64_t length,
+              bool ascending) {
+  typedef typename radix_key<T>::type K;
+  int64_t* from = index;
+  int64_t* to = scratch;
+  int64_t counts[256];
+  for (size_t shift = 0;  shift < 8*sizeof(K);  shift += 8) {
+    std::fill(counts, counts + 256, 0);
+    for (int64_t i = 0;  i < length;  i++) {
+      counts[(sorting_key(values[from[i]], ascending) >> shift) & 0xff]++;
+    }
+    if (*std::max_element(counts, counts + 256) == length) {
+      continue;
+    }
+    int64_t total = 0;
+    for (int64_t b = 0;  b < 256;  b++) {
+      int64_t count = counts[b];
+      counts[b] = total;
+      total += count;
+    }
+    for (int64_t i = 0;  i < length;  i++) {
+      to[counts[(sorting_key(values[from[i]], ascending) >> shift) & 0xff]++] =
+          from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != index) {
+    std::copy(from, from + length, index);
+  }
+}
+
+/// Length of the longest sublist: the scratch space that sorting needs.
+inline int64_t
+sorting_scratch_length(const int64_t* offsets, int64_t offsetslength) {
+  int64_t out = 0;
+  for (int64_t i = 0;  i < offsetslength - 1;  i++) {
+    out = std::max(out, offsets[i + 1] - offsets[i]);
+  }
+  return out;
+}
+
+/// Sorts the `length` values of one sublist in place; `scratch` must hold
+/// at least `length` values.
+template <typename T>
+void
+sort_sublist(T* values,
+             int64_t length,
+             bool ascending,
+             bool stable,
+             T* scratch) {
+  auto before = [ascending](T left, T right) {
+    return sorting_before(left, right, ascending);
+  };
+  if (length <= kSmallSortLength) {
+    small_sort(values, length, ascending);
+  }
+  else if (length >= kRadixSortLength) {
+    radix_sort(values, scratch, length, ascending);
+  }
+  else if (stable) {
+    std::stable_sort(values, values + length, before);
+  }
+  else {
+    std::sort(values, values + length, before);
+  }
+}
+
+/// Writes the positions (relative to the start of the sublist) that would
+/// sort one sublist of `fromptr` into `toptr`; `scratch` must hold at least
+/// `length` indexes.
+template <typename T>
+void
+argsort_sublist(int64_t* toptr,
+                const T* fromptr,
+                int64_t length,
+                bool ascending,
+                bool stable,
+                int64_t* scratch) {
+  auto before = [fromptr, ascending](int64_t i1, int64_t i2) {
+    return sorting_before(fromptr[i1], fromptr[i2], ascending);
+  };
+  std::iota(toptr, toptr + length, 0);
+  if (length <= kSmallSortLength) {
+    small_argsort(toptr, fromptr, length, ascending);
+  }
+  else if (length >= kRadixSortLength) {
+    radix_argsort(toptr, scratch, fromptr, length, ascending);
+  }
+  else if (stable) {
+    std::stable_sort(toptr, toptr + length, before);
+  }
+  else {
+    std::sort(toptr, toptr + length, before);
+  }
+}
+
+#endif // AWKWARD_KERNEL_SORTING_H_
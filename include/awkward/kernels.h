@@ -7,6 +7,68 @@
 #include "awkward/common.h"
 
 extern "C" {
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_getitem_carry_64(
+    uint8_t* tobitmask,
+    const uint8_t* frombitmask,
+    int64_t length,
+    const int64_t* fromcarry,
+    int64_t lencarry,
+    bool lsb_order);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_getitem_nextcarry_64(
+    int64_t* tocarry,
+    const uint8_t* frombitmask,
+    int64_t length,
+    bool validwhen,
+    bool lsb_order);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_getitem_nextcarry_outindex_64(
+    int64_t* tocarry,
+    int64_t* outindex,
+    const uint8_t* frombitmask,
+    int64_t length,
+    bool validwhen,
+    bool lsb_order);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_getitem_range(
+    uint8_t* tobitmask,
+    const uint8_t* frombitmask,
+    int64_t start,
+    int64_t length,
+    bool lsb_order);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_numnull(
+    int64_t* numnull,
+    const uint8_t* frombitmask,
+    int64_t length,
+    bool validwhen,
+    bool lsb_order);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_overlay_mask(
+    uint8_t* tobitmask,
+    const uint8_t* outerbitmask,
+    bool outervalidwhen,
+    const uint8_t* innerbitmask,
+    bool innervalidwhen,
+    int64_t bitmasklength);
+
+  EXPORT_SYMBOL ERROR
+  awkward_BitMaskedArray_reduce_next_64(
+    int64_t* nextcarry,
+    int64_t* nextparents,
+    int64_t* outindex,
+    const uint8_t* frombitmask,
+    const int64_t* parents,
+    int64_t length,
+    bool validwhen,
+    bool lsb_order);
+
   EXPORT_SYMBOL ERROR
   awkward_BitMaskedArray_to_ByteMaskedArray(
     int8_t* tobytemask,
@@ -544,6 +606,14 @@ extern "C" {
     int64_t lenindex,
     int64_t lencarry);
 
+  EXPORT_SYMBOL ERROR
+  awkward_IndexedArray64_getitem_compose_64(
+    int64_t* toindex,
+    const int64_t* outerindex,
+    const int64_t* innerindex,
+    int64_t lenouter,
+    int64_t leninner);
+
   EXPORT_SYMBOL ERROR
   awkward_IndexedArray32_getitem_nextcarry_64(
     int64_t* tocarry,
@@ -929,6 +999,20 @@ extern "C" {
     const uint32_t* stops,
     int64_t length);
 
+  EXPORT_SYMBOL ERROR
+  awkward_ListArray_combinations_chunk_64(
+    int64_t** tocarry,
+    int64_t* toparents,
+    int64_t* tolength,
+    int64_t* index,
+    int64_t* position,
+    int64_t n,
+    bool replacement,
+    const int64_t* starts,
+    const int64_t* stops,
+    int64_t length,
+    int64_t maxlength);
+
   EXPORT_SYMBOL ERROR
   awkward_ListArray32_combinations_length_64(
     int64_t* totallen,
@@ -2723,6 +2807,18 @@ extern "C" {
     const double* fromptr,
     int64_t length);
 
+  EXPORT_SYMBOL ERROR
+  awkward_NumpyArray_fused_elementwise_64(
+    double* toptr,
+    const double** fromptrs,
+    const int64_t* program,
+    int64_t programlength,
+    const double* constants,
+    double* stack,
+    int64_t stackdepth,
+    int64_t blocksize,
+    int64_t length);
+
   EXPORT_SYMBOL ERROR
   awkward_NumpyArray_getitem_boolean_nonzero_64(
     int64_t* toptr,
@@ -2816,6 +2912,12 @@ extern "C" {
     int64_t lenparents,
     int64_t outlength);
 
+  EXPORT_SYMBOL ERROR
+  awkward_NumpyArray_reduce_mask_ByteMaskedArray_offsets_64(
+    int8_t* toptr,
+    const int64_t* offsets,
+    int64_t outlength);
+
   EXPORT_SYMBOL ERROR
   awkward_ListOffsetArray_argsort_strings(
     int64_t* tocarry,
@@ -2924,6 +3026,15 @@ extern "C" {
     int64_t length,
     bool* toequal);
 
+  EXPORT_SYMBOL ERROR
+  awkward_RecordArray_getitem_carry_fields_64(
+    uint8_t** toptrs,
+    const uint8_t** fromptrs,
+    const int64_t* strides,
+    int64_t numfields,
+    const int64_t* carry,
+    int64_t lencarry);
+
   EXPORT_SYMBOL ERROR
   awkward_RegularArray_broadcast_tooffsets_64(
     const int64_t* fromoffsets,
@@ -3971,6 +4082,12 @@ extern "C" {
     int64_t lenparents,
     int64_t outlength);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_count_offsets_64(
+    int64_t* toptr,
+    const int64_t* offsets,
+    int64_t outlength);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_countnonzero_bool_64(
     int64_t* toptr,
@@ -4049,6 +4166,73 @@ extern "C" {
     int64_t lenparents,
     int64_t outlength);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_bool_64(
+    int64_t* toptr,
+    const bool* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_int8_64(
+    int64_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_int16_64(
+    int64_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_int32_64(
+    int64_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_int64_64(
+    int64_t* toptr,
+    const int64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_uint8_64(
+    int64_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_uint16_64(
+    int64_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_uint32_64(
+    int64_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_uint64_64(
+    int64_t* toptr,
+    const uint64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_float32_64(
+    int64_t* toptr,
+    const float* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_countnonzero_offsets_float64_64(
+    int64_t* toptr,
+    const double* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_countnonzero_complex64_64(
     int64_t* toptr,
@@ -4145,6 +4329,77 @@ extern "C" {
     int64_t outlength,
     double identity);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_int8_int8_64(
+    int8_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int8_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_int16_int16_64(
+    int16_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int16_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_int32_int32_64(
+    int32_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int32_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_int64_int64_64(
+    int64_t* toptr,
+    const int64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int64_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_uint8_uint8_64(
+    uint8_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint8_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_uint16_uint16_64(
+    uint16_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint16_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_uint32_uint32_64(
+    uint32_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint32_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_uint64_uint64_64(
+    uint64_t* toptr,
+    const uint64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint64_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_float32_float32_64(
+    float* toptr,
+    const float* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    float identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_max_offsets_float64_float64_64(
+    double* toptr,
+    const double* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    double identity);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_max_complex64_complex64_64(
     float* toptr,
@@ -4243,6 +4498,77 @@ extern "C" {
     int64_t outlength,
     double identity);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_int8_int8_64(
+    int8_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int8_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_int16_int16_64(
+    int16_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int16_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_int32_int32_64(
+    int32_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int32_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_int64_int64_64(
+    int64_t* toptr,
+    const int64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    int64_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_uint8_uint8_64(
+    uint8_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint8_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_uint16_uint16_64(
+    uint16_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint16_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_uint32_uint32_64(
+    uint32_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint32_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_uint64_uint64_64(
+    uint64_t* toptr,
+    const uint64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    uint64_t identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_float32_float32_64(
+    float* toptr,
+    const float* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    float identity);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_min_offsets_float64_float64_64(
+    double* toptr,
+    const double* fromptr,
+    const int64_t* offsets,
+    int64_t outlength,
+    double identity);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_min_complex64_complex64_64(
     float* toptr,
@@ -4373,6 +4699,103 @@ extern "C" {
     int64_t lenparents,
     int64_t outlength);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int32_int8_64(
+    int32_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int32_int16_64(
+    int32_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int32_int32_64(
+    int32_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int64_int8_64(
+    int64_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int64_int16_64(
+    int64_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int64_int32_64(
+    int64_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_int64_int64_64(
+    int64_t* toptr,
+    const int64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint32_uint8_64(
+    uint32_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint32_uint16_64(
+    uint32_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint32_uint32_64(
+    uint32_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint64_uint8_64(
+    uint64_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint64_uint16_64(
+    uint64_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint64_uint32_64(
+    uint64_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_uint64_uint64_64(
+    uint64_t* toptr,
+    const uint64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_float32_float32_64(
+    float* toptr,
+    const float* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_prod_offsets_float64_float64_64(
+    double* toptr,
+    const double* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_prod_complex64_complex64_64(
     float* toptr,
@@ -4610,6 +5033,103 @@ extern "C" {
     int64_t lenparents,
     int64_t outlength);
 
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int32_int8_64(
+    int32_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int32_int16_64(
+    int32_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int32_int32_64(
+    int32_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int64_int8_64(
+    int64_t* toptr,
+    const int8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int64_int16_64(
+    int64_t* toptr,
+    const int16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int64_int32_64(
+    int64_t* toptr,
+    const int32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_int64_int64_64(
+    int64_t* toptr,
+    const int64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint32_uint8_64(
+    uint32_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint32_uint16_64(
+    uint32_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint32_uint32_64(
+    uint32_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint64_uint8_64(
+    uint64_t* toptr,
+    const uint8_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint64_uint16_64(
+    uint64_t* toptr,
+    const uint16_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint64_uint32_64(
+    uint64_t* toptr,
+    const uint32_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_uint64_uint64_64(
+    uint64_t* toptr,
+    const uint64_t* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_float32_float32_64(
+    float* toptr,
+    const float* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+  EXPORT_SYMBOL ERROR
+  awkward_reduce_sum_offsets_float64_float64_64(
+    double* toptr,
+    const double* fromptr,
+    const int64_t* offsets,
+    int64_t outlength);
+
   EXPORT_SYMBOL ERROR
   awkward_reduce_sum_complex64_complex64_64(
     float* toptr,
@@ -3,6 +3,8 @@
 #ifndef AWKWARD_PARTITIONEDARRAY_H_
 #define AWKWARD_PARTITIONEDARRAY_H_
 
+#include <functional>
+
 #include "awkward/Content.h"
 
 namespace awkward {
@@ -80,6 +82,8 @@ namespace awkward {
     /// (and therefore might not be safe to print to the screen), it
     /// does not preserve the type information of an array. In particular,
     /// the distinction between ListType and RegularType is lost.
+    ///
+    /// Compact JSON is rendered one partition per task (see #map_partitions).
     const std::string
       tojson(bool pretty, int64_t maxdecimals) const;
 
@@ -153,6 +157,18 @@ namespace awkward {
     const PartitionedArrayPtr
       getitem_range_nowrap(int64_t start, int64_t stop, int64_t step) const;
 
+    /// @brief Applies `function` to each partition and returns the results
+    /// as a new IrregularlyPartitionedArray.
+    ///
+    /// If kernel::num_threads is more than 1, partitions are processed
+    /// concurrently, one per task, so `function` must not touch Python
+    /// objects without holding the GIL. Kernels called within it run
+    /// serially.
+    const PartitionedArrayPtr
+      map_partitions(
+        const std::function<const ContentPtr(const ContentPtr&)>& function)
+      const;
+
     /// @brief Recursively copies components of the array from main memory to a
     /// GPU (if `ptr_lib == kernel::lib::cuda`) or to main memory (if
     /// `ptr_lib == kernel::lib::cpu`) if those components are not already there.
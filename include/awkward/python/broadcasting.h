@@ -0,0 +1,66 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#ifndef AWKWARDPY_BROADCASTING_H_
+#define AWKWARDPY_BROADCASTING_H_
+
+#include <string>
+
+#include <pybind11/pybind11.h>
+
+#include "awkward/Broadcasting.h"
+#include "awkward/FusedElementwise.h"
+
+namespace py = pybind11;
+namespace ak = awkward;
+
+/// @class PyBroadcastFunction
+///
+/// @brief BroadcastFunction that calls a Python function with the boxed
+/// inputs and depth, which returns a tuple of outputs or None.
+class PyBroadcastFunction: public ak::BroadcastFunction {
+public:
+  /// @brief Creates a PyBroadcastFunction.
+  ///
+  /// @param callable The Python function.
+  /// @param custom Python function that returns the `"__broadcast__"`
+  /// function `f(layout, offsets)` of a boxed input or None, or None if no
+  /// input can have one.
+  /// @param inputs The original inputs, whose non-arrays are passed to
+  /// `callable` in place of the nullptrs of the C++ inputs.
+  PyBroadcastFunction(const py::object& callable,
+                      const py::object& custom,
+                      const py::list& inputs);
+
+  bool
+    apply(const ak::ContentPtrVec& inputs,
+          int64_t depth,
+          ak::ContentPtrVec& outputs) override;
+
+  bool
+    has_custom_broadcast(const ak::ContentPtr& input) override;
+
+  const ak::ContentPtr
+    custom_broadcast(const ak::ContentPtr& input,
+                     const ak::Index64& offsets) override;
+
+private:
+  const py::object callable_;
+  const py::object custom_;
+  const py::list inputs_;
+};
+
+/// @brief Makes the C++ implementation of `ak._util.broadcast_and_apply`
+/// available in Python.
+void
+  make_broadcast_and_apply(py::module& m, const std::string& name);
+
+/// @brief Makes ak::fused_elementwise available in Python, with a program
+/// of `(name, argument)` tuples.
+void
+  make_fused_elementwise(py::module& m, const std::string& name);
+
+/// @brief Makes ak::fused_operations available in Python.
+void
+  make_fused_operations(py::module& m, const std::string& name);
+
+#endif // AWKWARDPY_BROADCASTING_H_
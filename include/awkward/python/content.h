@@ -7,7 +7,9 @@
 #include <pybind11/stl.h>
 
 #include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/TypedArrayBuilder.h"
 #include "awkward/Iterator.h"
+#include "awkward/CombinationsIterator.h"
 #include "awkward/Content.h"
 #include "awkward/array/EmptyArray.h"
 #include "awkward/array/IndexedArray.h"
@@ -62,10 +64,20 @@ ak::Slice
 py::class_<ak::ArrayBuilder>
   make_ArrayBuilder(const py::handle& m, const std::string& name);
 
+/// @brief Makes a TypedArrayBuilder class in Python that mirrors the one
+/// in C++.
+py::class_<ak::TypedArrayBuilder>
+  make_TypedArrayBuilder(const py::handle& m, const std::string& name);
+
 /// @brief Makes an Iterator class in Python that mirrors the one in C++.
 py::class_<ak::Iterator, std::shared_ptr<ak::Iterator>>
   make_Iterator(const py::handle& m, const std::string& name);
 
+/// @brief Makes a CombinationsIterator class in Python that mirrors the one
+/// in C++.
+py::class_<ak::CombinationsIterator, std::shared_ptr<ak::CombinationsIterator>>
+  make_CombinationsIterator(const py::handle& m, const std::string& name);
+
 /// @class PersistentSharedPtr
 ///
 /// @brief Array nodes are frequently copied, but for some applications
@@ -10,6 +10,9 @@
 namespace py = pybind11;
 namespace ak = awkward;
 
+py::class_<ak::ForthInputBuffer, std::shared_ptr<ak::ForthInputBuffer>>
+make_ForthInputBuffer(const py::handle& m, const std::string& name);
+
 template <typename T, typename I>
 py::class_<ak::ForthMachineOf<T, I>, std::shared_ptr<ak::ForthMachineOf<T, I>>>
 make_ForthMachineOf(const py::handle& m, const std::string& name);
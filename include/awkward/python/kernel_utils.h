@@ -7,7 +7,9 @@
 
 #include <pybind11/pybind11.h>
 
+#include "awkward/kernel-allocator.h"
 #include "awkward/kernel-dispatch.h"
+#include "awkward/kernel-parallel.h"
 
 namespace py = pybind11;
 namespace ak = awkward;
@@ -15,5 +17,18 @@ namespace ak = awkward;
 py::enum_<ak::kernel::lib>
   make_lib_enum(const py::handle& m, const std::string& name);
 
+void
+  make_num_threads(py::module& m, const std::string& name);
+
+void
+  make_num_background_threads(py::module& m, const std::string& name);
+
+void
+  make_allocator(py::module& m, const std::string& name);
+
+/// @brief Makes waits for background tasks release the GIL.
+void
+  install_background_wait();
+
 
 #endif //AWKWARD_KERNEL_UTILS_H
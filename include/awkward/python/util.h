@@ -34,9 +34,14 @@ public:
   }
   /// @brief Called by `std::shared_ptr` when its reference count reaches
   /// zero.
+  ///
+  /// This may happen on a thread that does not hold the GIL (such as one
+  /// processing a partition), so it takes the GIL first.
   void operator()(T const *p) {
     // std::cout << "pyobject DECREF of " << pyobj_ << std::endl;
+    PyGILState_STATE state = PyGILState_Ensure();
     Py_DECREF(pyobj_);
+    PyGILState_Release(state);
   }
 private:
   /// @brief The Python object that we hold a reference to.
@@ -62,7 +62,30 @@ public:
   virtual bool
     referentially_equal(const ak::ArrayGeneratorPtr& other) const override;
 
+  /// @brief Calls the callable's `getitem_range(start, stop)` method, if it
+  /// has one, for a callable that makes only those rows (with the same
+  /// arguments); `nullptr` if it has none or it returns None.
+  const std::shared_ptr<ak::ArrayGenerator>
+    getitem_range(int64_t start, int64_t stop) const override;
+
+  /// @brief Like #getitem_range, with the callable's `getitem_field(key)`.
+  const std::shared_ptr<ak::ArrayGenerator>
+    getitem_field(const std::string& key) const override;
+
+  /// @brief Like #getitem_range, with the callable's `getitem_fields(keys)`.
+  const std::shared_ptr<ak::ArrayGenerator>
+    getitem_fields(const std::vector<std::string>& keys) const override;
+
 private:
+  /// @brief A generator for the callable returned by its `method`, or
+  /// `nullptr`; `arg2` is not passed if it is None. Needs the GIL.
+  const std::shared_ptr<ak::ArrayGenerator>
+    projected(const char* method,
+              const py::object& arg1,
+              const py::object& arg2,
+              const ak::FormPtr& form,
+              int64_t length) const;
+
   const py::object callable_;
   const py::tuple args_;
   const py::dict kwargs_;
@@ -106,4 +129,19 @@ private:
 py::class_<PyArrayCache, std::shared_ptr<PyArrayCache>>
 make_PyArrayCache(const py::handle& m, const std::string& name);
 
+////////// LRUArrayCache
+
+py::class_<ak::LRUArrayCache, std::shared_ptr<ak::LRUArrayCache>>
+make_LRUArrayCache(const py::handle& m, const std::string& name);
+
+/// @brief Returns the Python object for a PyArrayCache or LRUArrayCache
+/// (None for `nullptr`).
+py::object
+box_cache(const ak::ArrayCachePtr& cache);
+
+/// @brief Returns the C++ cache of an ak.layout.ArrayCache or
+/// ak.layout.LRUArrayCache (`nullptr` for None).
+ak::ArrayCachePtr
+unbox_cache(const py::object& cache);
+
 #endif // AWKWARDPY_VIRTUAL_H_
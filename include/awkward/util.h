@@ -233,6 +233,7 @@ namespace awkward {
         rewind_beyond,
         division_by_zero,
         varint_too_big,
+        lookup_beyond,
 
         size
     };
@@ -3,6 +3,11 @@
 #ifndef AWKWARD_ARRAYCACHE_H_
 #define AWKWARD_ARRAYCACHE_H_
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 #include "awkward/Content.h"
 
 namespace awkward {
@@ -37,6 +42,18 @@ namespace awkward {
     virtual bool
       is_broken() const = 0;
 
+    /// @brief Keeps the array at `key` (or the one that will be #set there)
+    /// from being evicted until a matching #unpin, while it is being used.
+    ///
+    /// VirtualArray pins its key while it gets, generates, and sets an
+    /// array. This does nothing unless the cache evicts arrays by itself.
+    virtual void
+      pin(const std::string& key);
+
+    /// @brief Undoes one #pin.
+    virtual void
+      unpin(const std::string& key);
+
     virtual const std::string
       tostring_part(const std::string& indent,
                     const std::string& pre,
@@ -49,6 +66,146 @@ namespace awkward {
   // large), define it in this file and implement it in
   // src/libawkward/virtual/ArrayCache.cpp.
 
+  /// @class LRUArrayCache
+  ///
+  /// @brief Pure C++ cache that holds arrays up to a total of `max_bytes`
+  /// (as measured by {@link Content#nbytes Content::nbytes}), evicting the
+  /// least recently used first.
+  ///
+  /// Unlike PyArrayCache, #get and #set never take the Python GIL, so
+  /// VirtualArrays that share this cache can be materialized by several
+  /// threads at once. Keys are spread over `num_stripes` independently
+  /// locked stripes, each with its own recency list: eviction takes the
+  /// least recently used array of each stripe in turn, which approximates
+  /// a global LRU order without a global lock.
+  ///
+  /// Pinned keys (see #pin) are never evicted, even if that leaves the cache
+  /// over its budget. Arrays larger than `max_bytes` are not kept at all.
+  class LIBAWKWARD_EXPORT_SYMBOL LRUArrayCache: public ArrayCache {
+  public:
+    /// @brief Creates an empty LRUArrayCache.
+    ///
+    /// @param max_bytes The byte budget for all arrays together.
+    /// @param num_stripes The number of independently locked parts of the
+    /// cache; more stripes let more threads use it at once.
+    LRUArrayCache(int64_t max_bytes, int64_t num_stripes);
+
+    ContentPtr
+      get(const std::string& key) const override;
+
+    void
+      set(const std::string& key, const ContentPtr& value) override;
+
+    /// @brief Always false: a pure C++ cache has nothing to lose.
+    bool
+      is_broken() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    /// @brief Removes the array at `key`, if any, even if it is pinned.
+    ///
+    /// Returns true if there was one.
+    bool
+      erase(const std::string& key);
+
+    /// @brief Removes all arrays and pins (but not the counters).
+    void
+      clear();
+
+    /// @brief Prevents the array at `key` from being evicted until a
+    /// matching #unpin, such as while it is being used.
+    ///
+    /// Pins are counted and may be placed before the array is #set.
+    void
+      pin(const std::string& key) override;
+
+    /// @brief Undoes one #pin; when none remain, the array at `key` may be
+    /// evicted again (and is, if the cache is over its budget).
+    void
+      unpin(const std::string& key) override;
+
+    /// @brief Returns true if `key` has an array.
+    bool
+      contains(const std::string& key) const;
+
+    /// @brief The byte budget.
+    int64_t
+      max_bytes() const;
+
+    /// @brief The number of independently locked stripes.
+    int64_t
+      num_stripes() const;
+
+    /// @brief The number of bytes held now.
+    int64_t
+      nbytes() const;
+
+    /// @brief The number of arrays held now.
+    int64_t
+      length() const;
+
+    /// @brief The number of #get calls that found an array.
+    int64_t
+      hits() const;
+
+    /// @brief The number of #get calls that did not find an array.
+    int64_t
+      misses() const;
+
+    /// @brief The number of arrays removed to keep within the budget.
+    int64_t
+      evictions() const;
+
+  private:
+    /// @brief One array and its size.
+    struct Entry {
+      std::string key;
+      ContentPtr value;
+      int64_t nbytes;
+    };
+
+    /// @brief An independently locked part of the cache.
+    struct Stripe {
+      std::mutex mutex;
+      /// @brief Entries, most recently used first.
+      std::list<Entry> entries;
+      std::unordered_map<std::string, std::list<Entry>::iterator> lookup;
+      /// @brief Number of pins for each pinned key.
+      std::unordered_map<std::string, int64_t> pins;
+    };
+
+    /// @brief The stripe that holds `key`.
+    Stripe&
+      stripe(const std::string& key) const;
+
+    /// @brief Removes unpinned arrays until the cache is within its
+    /// budget or nothing more can be evicted.
+    void
+      evict();
+
+    /// @brief Removes the least recently used unpinned array of
+    /// `stripe`, moving it to `evicted` (to be released after the stripe
+    /// is unlocked); returns false if it has none.
+    bool
+      evict_one(Stripe& stripe, ContentPtr& evicted);
+
+    const int64_t max_bytes_;
+    /// @brief Mutable because #get updates the recency order.
+    mutable std::vector<std::unique_ptr<Stripe>> stripes_;
+    std::atomic<int64_t> nbytes_;
+    std::atomic<int64_t> length_;
+    mutable std::atomic<int64_t> hits_;
+    mutable std::atomic<int64_t> misses_;
+    std::atomic<int64_t> evictions_;
+    /// @brief The stripe that #evict tries first, so that evictions rotate
+    /// over all stripes.
+    std::atomic<int64_t> next_victim_;
+  };
+
+  using LRUArrayCachePtr = std::shared_ptr<LRUArrayCache>;
 }
 
 #endif // AWKWARD_ARRAYCACHE_H_
@@ -91,6 +91,35 @@ namespace awkward {
     virtual bool
       referentially_equal(const ArrayGeneratorPtr& other) const = 0;
 
+    /// @brief Returns a generator of only items `start` (inclusive) through
+    /// `stop` (exclusive) of this generator's array, without generating the
+    /// rest, or `nullptr` if this generator can't (the default).
+    ///
+    /// A SliceGenerator of a range of a VirtualArray uses it, if possible
+    /// and if the VirtualArray hasn't been generated yet, instead of
+    /// generating the whole array and slicing it. Generators that read from
+    /// columnar files can override it to read only the requested rows.
+    ///
+    /// The `start` and `stop` are non-negative and within #length.
+    virtual const std::shared_ptr<ArrayGenerator>
+      getitem_range(int64_t start, int64_t stop) const;
+
+    /// @brief Returns a generator of only one record field of this
+    /// generator's array, or `nullptr` if this generator can't (the
+    /// default).
+    ///
+    /// See #getitem_range; this is used for VirtualArray::getitem_field.
+    virtual const std::shared_ptr<ArrayGenerator>
+      getitem_field(const std::string& key) const;
+
+    /// @brief Returns a generator of only a subset of the record fields of
+    /// this generator's array, or `nullptr` if this generator can't (the
+    /// default).
+    ///
+    /// See #getitem_range; this is used for VirtualArray::getitem_fields.
+    virtual const std::shared_ptr<ArrayGenerator>
+      getitem_fields(const std::vector<std::string>& keys) const;
+
   protected:
     const FormPtr form_;
     FormPtr inferred_form_{nullptr};
@@ -141,6 +170,18 @@ namespace awkward {
       referentially_equal(const ArrayGeneratorPtr& other) const override;
 
   protected:
+    /// @brief The step-1 range that the #slice consists of, if it does
+    /// (`nullptr` otherwise).
+    const SliceRange*
+      simple_range() const;
+
+    /// @brief A generator of only the rows or fields that the #slice
+    /// selects, from the generator at the root of a chain of slices of
+    /// VirtualArrays, or `nullptr` if an array in the chain has already been
+    /// generated (it is sliced instead) or the root generator can't.
+    const std::shared_ptr<ArrayGenerator>
+      projected() const;
+
     const ContentPtr content_;
     const Slice slice_;
   };
@@ -29,6 +29,7 @@ import awkward.partition
 import awkward._cpu_kernels
 import awkward._libawkward
 import awkward._util
+import awkward.config
 
 # third-party connectors
 import awkward._connect._numpy
@@ -53,6 +54,9 @@ from awkward.operations.describe import *
 from awkward.operations.structure import *
 from awkward.operations.reducers import *
 
+# deferred, fused elementwise expressions
+import awkward.fused
+
 # version
 __version__ = awkward._ext.__version__
 
@@ -41,6 +41,7 @@ def register():
     import awkward._connect._numba.arrayview
     import awkward._connect._numba.layout
     import awkward._connect._numba.builder
+    import awkward._connect._numba.typedbuilder
 
     if hasattr(ak.numba, "ArrayViewType"):
         return
@@ -63,6 +64,10 @@ def register():
     n.UnionArrayType = awkward._connect._numba.layout.UnionArrayType
     n.ArrayBuilderType = awkward._connect._numba.builder.ArrayBuilderType
     n.ArrayBuilderModel = awkward._connect._numba.builder.ArrayBuilderModel
+    n.TypedArrayBuilderType = awkward._connect._numba.typedbuilder.TypedArrayBuilderType
+    n.TypedArrayBuilderModel = (
+        awkward._connect._numba.typedbuilder.TypedArrayBuilderModel
+    )
 
     @numba.extending.typeof_impl.register(ak.highlevel.Array)
     def typeof_Array(obj, c):
@@ -76,6 +81,10 @@ def register():
     def typeof_ArrayBuilder(obj, c):
         return obj.numba_type
 
+    @numba.extending.typeof_impl.register(ak.layout.TypedArrayBuilder)
+    def typeof_TypedArrayBuilder(obj, c):
+        return awkward._connect._numba.typedbuilder.TypedArrayBuilderType()
+
 
 def repr_behavior(behavior):
     return repr(behavior)
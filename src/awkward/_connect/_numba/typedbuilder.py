@@ -0,0 +1,202 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import numba
+import numba.core.typing
+import numba.core.typing.ctypes_utils
+
+import awkward as ak
+
+from awkward._connect._numba.builder import call
+
+
+class TypedArrayBuilderType(numba.types.Type):
+    def __init__(self):
+        super(TypedArrayBuilderType, self).__init__(name="ak.TypedArrayBuilderType()")
+
+
+@numba.extending.register_model(TypedArrayBuilderType)
+class TypedArrayBuilderModel(numba.core.datamodel.models.StructModel):
+    def __init__(self, dmm, fe_type):
+        members = [("rawptr", numba.types.voidptr), ("pyptr", numba.types.pyobject)]
+        super(TypedArrayBuilderModel, self).__init__(dmm, fe_type, members)
+
+
+@numba.extending.unbox(TypedArrayBuilderType)
+def unbox_TypedArrayBuilder(buildertype, builderobj, c):
+    rawptr_obj = c.pyapi.object_getattr_string(builderobj, "_ptr")
+
+    proxyout = c.context.make_helper(c.builder, buildertype)
+    proxyout.rawptr = c.pyapi.long_as_voidptr(rawptr_obj)
+    proxyout.pyptr = builderobj
+
+    c.pyapi.decref(rawptr_obj)
+
+    is_error = numba.core.cgutils.is_not_null(c.builder, c.pyapi.err_occurred())
+    return numba.extending.NativeValue(proxyout._getvalue(), is_error)
+
+
+@numba.extending.box(TypedArrayBuilderType)
+def box_TypedArrayBuilder(buildertype, builderval, c):
+    proxyin = c.context.make_helper(c.builder, buildertype, builderval)
+    c.pyapi.incref(proxyin.pyptr)
+    return proxyin.pyptr
+
+
+@numba.core.typing.templates.infer_global(len)
+class type_len(numba.core.typing.templates.AbstractTemplate):
+    def generic(self, args, kwargs):
+        if (
+            len(args) == 1
+            and len(kwargs) == 0
+            and isinstance(args[0], TypedArrayBuilderType)
+        ):
+            return numba.intp(args[0])
+
+
+@numba.extending.lower_builtin(len, TypedArrayBuilderType)
+def lower_len(context, builder, sig, args):
+    (buildertype,) = sig.args
+    (builderval,) = args
+    proxyin = context.make_helper(builder, buildertype, builderval)
+    result = numba.core.cgutils.alloca_once(
+        builder, context.get_value_type(numba.int64)
+    )
+    call(
+        context,
+        builder,
+        ak._libawkward.TypedArrayBuilder_length,
+        (proxyin.rawptr, result),
+    )
+    return ak._connect._numba.castint(
+        context, builder, numba.int64, numba.intp, builder.load(result)
+    )
+
+
+# Same method names as ak.layout.TypedArrayBuilder, so that a function filling
+# one runs the same way with and without Numba.
+noargs = [
+    "clear",
+    "null",
+    "beginlist",
+    "endlist",
+    "endtuple",
+    "beginrecord",
+    "endrecord",
+]
+intargs = ["begintuple", "index", "field"]
+
+
+def resolve_noargs(name):
+    def resolve(self, buildertype, args, kwargs):
+        if len(args) == 0 and len(kwargs) == 0:
+            return numba.types.none()
+        else:
+            raise TypeError(
+                "wrong number of arguments for TypedArrayBuilder." + name
+                + ak._util.exception_suffix(__file__)
+            )
+
+    return numba.core.typing.templates.bound_function(name)(resolve)
+
+
+def resolve_onearg(name, argtypes):
+    def resolve(self, buildertype, args, kwargs):
+        if len(args) == 1 and len(kwargs) == 0 and isinstance(args[0], argtypes):
+            return numba.types.none(args[0])
+        else:
+            raise TypeError(
+                "wrong number or types of arguments for TypedArrayBuilder." + name
+                + ak._util.exception_suffix(__file__)
+            )
+
+    return numba.core.typing.templates.bound_function(name)(resolve)
+
+
+@numba.core.typing.templates.infer_getattr
+class type_methods(numba.core.typing.templates.AttributeTemplate):
+    key = TypedArrayBuilderType
+
+    resolve_clear = resolve_noargs("clear")
+    resolve_null = resolve_noargs("null")
+    resolve_beginlist = resolve_noargs("beginlist")
+    resolve_endlist = resolve_noargs("endlist")
+    resolve_endtuple = resolve_noargs("endtuple")
+    resolve_beginrecord = resolve_noargs("beginrecord")
+    resolve_endrecord = resolve_noargs("endrecord")
+
+    resolve_boolean = resolve_onearg("boolean", numba.types.Boolean)
+    resolve_integer = resolve_onearg("integer", numba.types.Integer)
+    resolve_real = resolve_onearg("real", (numba.types.Integer, numba.types.Float))
+    resolve_begintuple = resolve_onearg("begintuple", numba.types.Integer)
+    resolve_index = resolve_onearg("index", numba.types.Integer)
+    resolve_field = resolve_onearg("field", numba.types.Integer)
+
+
+def lower_noargs(name):
+    fcn = getattr(ak._libawkward, "TypedArrayBuilder_" + name)
+
+    @numba.extending.lower_builtin(name, TypedArrayBuilderType)
+    def lower(context, builder, sig, args):
+        (buildertype,) = sig.args
+        (builderval,) = args
+        proxyin = context.make_helper(builder, buildertype, builderval)
+        call(context, builder, fcn, (proxyin.rawptr,))
+        return context.get_dummy_value()
+
+    return lower
+
+
+def lower_intarg(name):
+    fcn = getattr(ak._libawkward, "TypedArrayBuilder_" + name)
+
+    @numba.extending.lower_builtin(name, TypedArrayBuilderType, numba.types.Integer)
+    def lower(context, builder, sig, args):
+        buildertype, xtype = sig.args
+        builderval, xval = args
+        proxyin = context.make_helper(builder, buildertype, builderval)
+        x = ak._connect._numba.castint(context, builder, xtype, numba.int64, xval)
+        call(context, builder, fcn, (proxyin.rawptr, x))
+        return context.get_dummy_value()
+
+    return lower
+
+
+for name in noargs:
+    lower_noargs(name)
+
+for name in intargs + ["integer"]:
+    lower_intarg(name)
+
+
+@numba.extending.lower_builtin("boolean", TypedArrayBuilderType, numba.types.Boolean)
+def lower_boolean(context, builder, sig, args):
+    buildertype, xtype = sig.args
+    builderval, xval = args
+    proxyin = context.make_helper(builder, buildertype, builderval)
+    x = builder.zext(xval, context.get_value_type(numba.uint8))
+    call(
+        context, builder, ak._libawkward.TypedArrayBuilder_boolean, (proxyin.rawptr, x)
+    )
+    return context.get_dummy_value()
+
+
+@numba.extending.lower_builtin("real", TypedArrayBuilderType, numba.types.Integer)
+@numba.extending.lower_builtin("real", TypedArrayBuilderType, numba.types.Float)
+def lower_real(context, builder, sig, args):
+    buildertype, xtype = sig.args
+    builderval, xval = args
+    proxyin = context.make_helper(builder, buildertype, builderval)
+    if isinstance(xtype, numba.types.Integer) and xtype.signed:
+        x = builder.sitofp(xval, context.get_value_type(numba.types.float64))
+    elif isinstance(xtype, numba.types.Integer):
+        x = builder.uitofp(xval, context.get_value_type(numba.types.float64))
+    elif xtype.bitwidth < 64:
+        x = builder.fpext(xval, context.get_value_type(numba.types.float64))
+    elif xtype.bitwidth > 64:
+        x = builder.fptrunc(xval, context.get_value_type(numba.types.float64))
+    else:
+        x = xval
+    call(context, builder, ak._libawkward.TypedArrayBuilder_real, (proxyin.rawptr, x))
+    return context.get_dummy_value()
@@ -40,6 +40,10 @@ def array_ufunc(ufunc, method, inputs, kwargs):
     if method != "__call__" or len(inputs) == 0 or "out" in kwargs:
         return NotImplemented
 
+    # let ak.fused.Deferred record the ufunc instead
+    if any(isinstance(x, ak.fused.Deferred) for x in inputs):
+        return NotImplemented
+
     behavior = ak._util.behaviorof(*inputs)
 
     nextinputs = []
@@ -203,8 +207,15 @@ def array_ufunc(ufunc, method, inputs, kwargs):
 
         return None
 
+    # getfunction only returns something at the leaves or at nodes with an
+    # "__array__"/"__record__" parameter, except for matmul's nested lists
     out = ak._util.broadcast_and_apply(
-        inputs, getfunction, behavior, allow_records=False, pass_depth=False
+        inputs,
+        getfunction,
+        behavior,
+        allow_records=False,
+        pass_depth=False,
+        leaves_only=(ufunc is not numpy.matmul),
     )
     assert isinstance(out, tuple) and len(out) == 1
     return ak._util.wrap(out[0], behavior)
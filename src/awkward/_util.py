@@ -510,6 +510,7 @@ def broadcast_and_apply(  # noqa: C901
     right_broadcast=True,
     numpy_to_regular=False,
     regular_to_jagged=False,
+    leaves_only=False,
 ):
     def checklength(inputs):
         length = len(inputs[0])
@@ -1016,6 +1017,45 @@ def broadcast_and_apply(  # noqa: C901
                 + exception_suffix(__file__)
             )
 
+    # the C++ traversal only calls back into Python where getfunction may
+    # return something or an input has custom broadcasting, but it can't
+    # thread user state
+    use_ext = not pass_user
+
+    def ext_function(inputs, depth):
+        args = ()
+        if pass_depth:
+            args = args + (depth,)
+        custom = getfunction(inputs, *args)
+        if callable(custom):
+            return custom()
+        else:
+            return None
+
+    def ext_custom_broadcast(layout):
+        custom = custom_broadcast(layout, behavior)
+        if callable(custom):
+            return custom
+        else:
+            return None
+
+    def apply_top(inputs, user):
+        if use_ext and isinstance(ak.nplike.of(*inputs), ak.nplike.Numpy):
+            return ak._ext.broadcast_and_apply(
+                inputs,
+                ext_function,
+                0,
+                allow_records,
+                left_broadcast,
+                right_broadcast,
+                numpy_to_regular,
+                regular_to_jagged,
+                leaves_only,
+                ext_custom_broadcast,
+            )
+        else:
+            return apply(inputs, 0, user)
+
     if any(isinstance(x, ak.partition.PartitionedArray) for x in inputs):
         purelist_isregular = True
         purelist_depths = set()
@@ -1035,7 +1075,7 @@ def broadcast_and_apply(  # noqa: C901
                     nextinputs.append(x)
 
             isscalar = []
-            out = apply(broadcast_pack(nextinputs, isscalar), 0, None)
+            out = apply_top(broadcast_pack(nextinputs, isscalar), None)
             assert isinstance(out, tuple)
             return tuple(broadcast_unpack(x, isscalar) for x in out)
 
@@ -1050,7 +1090,7 @@ def broadcast_and_apply(  # noqa: C901
             outputs = []
             for part_inputs in ak.partition.iterate(sample.numpartitions, nextinputs):
                 isscalar = []
-                part = apply(broadcast_pack(part_inputs, isscalar), 0, None)
+                part = apply_top(broadcast_pack(part_inputs, isscalar), None)
                 assert isinstance(part, tuple)
                 outputs.append(tuple(broadcast_unpack(x, isscalar) for x in part))
 
@@ -1063,7 +1103,7 @@ def broadcast_and_apply(  # noqa: C901
 
     else:
         isscalar = []
-        out = apply(broadcast_pack(inputs, isscalar), 0, user)
+        out = apply_top(broadcast_pack(inputs, isscalar), user)
         assert isinstance(out, tuple)
         return tuple(broadcast_unpack(x, isscalar) for x in out)
 
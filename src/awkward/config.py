@@ -4,9 +4,120 @@ from __future__ import absolute_import
 
 import sys
 import argparse
-import pkg_resources
+
+
+def num_threads():
+    """
+    Returns the number of threads that data-parallel kernels may use.
+
+    The default, 1, runs every kernel on the calling thread. It can be set
+    with the `AWKWARD_NUM_THREADS` environment variable (read when Awkward
+    Array is first imported) or with #ak.config.set_num_threads.
+    """
+    import awkward._ext
+
+    return awkward._ext.kernel_num_threads()
+
+
+def set_num_threads(num_threads):
+    """
+    Args:
+        num_threads (int): Number of threads that data-parallel kernels may
+            use; 0 means one per hardware thread.
+
+    Only large arrays (at least 65536 items) are split across threads; the
+    results are identical to single-threaded execution.
+    """
+    import awkward._ext
+
+    awkward._ext.set_kernel_num_threads(num_threads)
+
+
+def num_background_threads():
+    """
+    Returns the number of background threads that generate prefetched
+    virtual arrays (see #ak.prefetch); 4 by default.
+    """
+    import awkward._ext
+
+    return awkward._ext.kernel_num_background_threads()
+
+
+def set_num_background_threads(num_threads):
+    """
+    Args:
+        num_threads (int): Number of background threads that generate
+            prefetched virtual arrays; 0 means one per hardware thread.
+
+    These threads are separate from the ones used by data-parallel kernels.
+    Lowering the number does not stop threads that have already started.
+    """
+    import awkward._ext
+
+    awkward._ext.set_kernel_num_background_threads(num_threads)
+
+
+def allocator():
+    """
+    Returns the name of the allocator that new arrays are allocated with on
+    this thread, or None for the default (plain `malloc`).
+    """
+    import awkward._ext
+
+    return awkward._ext.kernel_allocator()
+
+
+def set_allocator(name):
+    """
+    Args:
+        name (None or str): Name of the allocator for new arrays on this
+            thread (see #ak.config.allocator_names); None for the default.
+
+    The allocators are
+
+       * `"malloc"`: the default, but with #ak.config.allocator_stats.
+       * `"arena"`: carves small arrays out of 4 MiB blocks, which is faster
+         for the many short-lived intermediate arrays of deep slicing and
+         reducing.
+       * `"hugepage"`: maps arrays of 2 MiB or more in whole 2 MiB pages and
+         asks Linux to back them with transparent huge pages.
+
+    The selection applies to the thread that sets it and to the threads of
+    data-parallel kernels that it starts (see #ak.config.set_num_threads).
+    Arrays are always freed by the allocator that made them.
+    """
+    import awkward._ext
+
+    awkward._ext.set_kernel_allocator(name)
+
+
+def allocator_names():
+    """
+    Returns the names of all registered allocators.
+    """
+    import awkward._ext
+
+    return awkward._ext.kernel_allocator_names()
+
+
+def allocator_stats(name, reset=False):
+    """
+    Args:
+        name (str): Name of the allocator.
+        reset (bool): If True, start counting again after this call.
+
+    Returns a dict of the number of allocations and deallocations, total bytes
+    allocated, bytes currently in use, and the peak of bytes in use through
+    the allocator named `name`.
+    """
+    import awkward._ext
+
+    return awkward._ext.kernel_allocator_stats(name, reset)
+
 
 if __name__ == "__main__":
+    import pkg_resources
+
     argparser = argparse.ArgumentParser(
         description="Print out compilation arguments to use Awkward Array as a C++ dependency"
     )
@@ -78,7 +189,7 @@ if __name__ == "__main__":
 
         if arg == "--static-libs":
             output.append(
-                "-L{0} -l{1}-static -l{2}-static -ldl".format(
+                "-L{0} -l{1}-static -l{2}-static -ldl -lpthread".format(
                     libdir, libawkward, cpu_kernels
                 )
             )
@@ -88,7 +199,7 @@ if __name__ == "__main__":
 
         if arg == "--static-libs-only-l":
             output.append(
-                "-l{0}-static -l{1}-static -ldl".format(libawkward, cpu_kernels)
+                "-l{0}-static -l{1}-static -ldl -lpthread".format(libawkward, cpu_kernels)
             )
 
         if arg == "--cflags-only-I":
@@ -2,5 +2,6 @@
 
 from __future__ import absolute_import
 
+from awkward._ext import ForthInputBuffer
 from awkward._ext import ForthMachine32
 from awkward._ext import ForthMachine64
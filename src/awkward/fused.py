@@ -0,0 +1,252 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import numbers
+
+import numpy
+
+import awkward as ak
+
+np = ak.nplike.NumpyMetadata.instance()
+
+
+_fused_operations = None
+
+
+def fused_operations():
+    global _fused_operations
+    if _fused_operations is None:
+        _fused_operations = frozenset(ak._ext.fused_operations())
+    return _fused_operations
+
+
+class Deferred(ak._connect._numpy.NDArrayOperatorsMixin):
+    """
+    An elementwise expression of arrays whose evaluation has been deferred:
+    NumPy ufuncs and operators applied to it are recorded, rather than
+    computed, until #ak.fused.evaluate is called.
+
+    Create them with #ak.fused.defer, rather than this constructor.
+
+    If all of the arrays in the expression have the same list structure
+    (identical offsets), numeric contents, and the expression would be
+    computed in float64, the whole expression is computed in one pass over
+    the flat contents, without allocating the intermediate arrays. Otherwise,
+    #ak.fused.evaluate applies the ufuncs one at a time, the same way as
+    without deferral.
+    """
+
+    def __init__(self, ufunc, args, array=None):
+        self._ufunc = ufunc
+        self._args = args
+        self._array = array
+
+    @property
+    def ufunc(self):
+        """
+        The ufunc computed by this node of the expression, or None if this is
+        an array.
+        """
+        return self._ufunc
+
+    @property
+    def args(self):
+        """
+        The arguments of #ufunc: Deferred expressions or numbers.
+        """
+        return self._args
+
+    @property
+    def array(self):
+        """
+        The array at this node of the expression, or None if it is a ufunc.
+        """
+        return self._array
+
+    def __repr__(self):
+        return "<Deferred {0}>".format(self._str({}))
+
+    def _str(self, names):
+        if self._ufunc is None:
+            if id(self._array) not in names:
+                names[id(self._array)] = "#{0}".format(len(names))
+            return names[id(self._array)]
+        else:
+            return "{0}({1})".format(
+                self._ufunc.__name__,
+                ", ".join(
+                    x._str(names) if isinstance(x, Deferred) else repr(x)
+                    for x in self._args
+                ),
+            )
+
+    def __array_ufunc__(self, ufunc, method, *inputs, **kwargs):
+        if method != "__call__" or len(kwargs) != 0 or ufunc.nout != 1:
+            return getattr(ufunc, method)(
+                *[evaluate(x) if isinstance(x, Deferred) else x for x in inputs],
+                **kwargs
+            )
+        args = []
+        for x in inputs:
+            if isinstance(x, Deferred):
+                args.append(x)
+            elif isinstance(x, (numbers.Number, np.generic)):
+                args.append(x)
+            else:
+                args.append(defer(x))
+        return Deferred(ufunc, tuple(args))
+
+    def evaluate(self, highlevel=True, behavior=None):
+        """
+        Computes the expression; see #ak.fused.evaluate.
+        """
+        return evaluate(self, highlevel=highlevel, behavior=behavior)
+
+
+def defer(*arrays):
+    """
+    Args:
+        arrays: Arrays to use in a deferred elementwise expression.
+
+    Returns a #ak.fused.Deferred for each of the `arrays` (one, if only one
+    is given), so that the NumPy ufuncs and operators applied to them are
+    recorded and fused when they are evaluated. For instance,
+
+        >>> px, py = ak.fused.defer(events.px, events.py)
+        >>> pt = ak.fused.evaluate(np.sqrt(px**2 + py**2))
+
+    computes `pt` without the three intermediate arrays that
+
+        >>> pt = np.sqrt(events.px**2 + events.py**2)
+
+    would allocate (if `px` and `py` have the same offsets).
+
+    See also #ak.fused.evaluate.
+    """
+    out = []
+    for array in arrays:
+        if isinstance(array, Deferred):
+            out.append(array)
+        else:
+            out.append(Deferred(None, (), array))
+    if len(out) == 1:
+        return out[0]
+    else:
+        return tuple(out)
+
+
+def _leaf_dtype(layout):
+    while True:
+        if isinstance(layout, ak.layout.VirtualArray):
+            layout = layout.array
+        elif isinstance(layout, ak._util.listtypes):
+            layout = layout.content
+        elif isinstance(layout, ak.layout.NumpyArray):
+            return numpy.asarray(layout).dtype
+        else:
+            return None
+
+
+def evaluate(expression, highlevel=True, behavior=None):
+    """
+    Args:
+        expression: A #ak.fused.Deferred expression (or anything else, which
+            is returned as-is).
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+        behavior (None or dict): Custom #ak.behavior for the output array, if
+            high-level.
+
+    Computes a deferred expression, in one pass over the flat contents of its
+    arrays if possible, and otherwise by applying its ufuncs one at a time.
+
+    The fused computation requires all of the arrays to have the same list
+    structure (lists and regular dimensions with identical offsets, without
+    missing values, records, or parameters) over numbers, and every
+    operation in the expression to be one that NumPy would compute in
+    float64. The result is the same either way.
+
+    See also #ak.fused.defer.
+    """
+    if not isinstance(expression, Deferred):
+        return expression
+
+    arrays = []
+    layouts = []
+    ids = {}
+    program = []
+    constants = []
+    fusable = [True]
+
+    # builds the postfix program and checks, by applying each ufunc to empty
+    # arrays of the right dtypes, that NumPy would compute it in float64
+    def compile(node):
+        if isinstance(node, Deferred) and node._ufunc is None:
+            if id(node._array) not in ids:
+                ids[id(node._array)] = len(layouts)
+                arrays.append(node._array)
+                layouts.append(
+                    ak.operations.convert.to_layout(
+                        node._array, allow_record=False, allow_other=False
+                    )
+                )
+            index = ids[id(node._array)]
+            program.append(("input", index))
+            dtype = _leaf_dtype(layouts[index])
+            if dtype is None:
+                fusable[0] = False
+                dtype = np.float64
+            return numpy.empty(0, dtype)
+
+        elif isinstance(node, Deferred):
+            operands = [compile(x) for x in node._args]
+            name = node._ufunc.__name__
+            program.append((name, 0))
+            try:
+                result = node._ufunc(*operands)
+            except TypeError:
+                # it can't be computed at all; let replay raise the error
+                fusable[0] = False
+                return numpy.empty(0, np.float64)
+            if name not in fused_operations() or result.dtype != np.dtype(
+                np.float64
+            ):
+                fusable[0] = False
+            return result
+
+        else:
+            program.append(("constant", len(constants)))
+            if isinstance(node, (bool, np.bool_, numbers.Real)):
+                constants.append(float(node))
+            else:
+                fusable[0] = False
+                constants.append(0.0)
+            return node
+
+    def replay(node):
+        if isinstance(node, Deferred) and node._ufunc is None:
+            return ak._util.wrap(layouts[ids[id(node._array)]], behavior)
+        elif isinstance(node, Deferred):
+            return node._ufunc(*[replay(x) for x in node._args])
+        else:
+            return node
+
+    compile(expression)
+
+    if behavior is None:
+        behavior = ak._util.behaviorof(*arrays)
+
+    out = None
+    if fusable[0] and all(
+        isinstance(ak.nplike.of(x), ak.nplike.Numpy) for x in layouts
+    ):
+        out = ak._ext.fused_elementwise(layouts, program, constants)
+
+    if out is None:
+        out = ak.operations.convert.to_layout(replay(expression))
+
+    if highlevel:
+        return ak._util.wrap(out, behavior)
+    else:
+        return out
@@ -12,7 +12,9 @@ from awkward._ext import Identities32
 from awkward._ext import Identities64
 
 from awkward._ext import Iterator
+from awkward._ext import CombinationsIterator
 from awkward._ext import ArrayBuilder
+from awkward._ext import TypedArrayBuilder
 from awkward._ext import _PersistentSharedPtr
 
 from awkward._ext import Content
@@ -52,5 +54,6 @@ from awkward._ext import VirtualArray
 from awkward._ext import ArrayGenerator
 from awkward._ext import SliceGenerator
 from awkward._ext import ArrayCache
+from awkward._ext import LRUArrayCache
 
 from awkward._ext import kernel_lib
@@ -987,10 +987,14 @@ def from_json(
     initial=1024,
     resize=1.5,
     buffersize=65536,
+    lines=False,
+    form=None,
+    num_threads=1,
 ):
     """
     Args:
-        source (str): JSON-formatted string to convert into an array.
+        source (str): JSON-formatted string or file name to convert into an
+            array.
         nan_string (None or str): If not None, strings with this value will be
             interpreted as floating-point NaN values.
         infinity_string (None or str): If not None, strings with this value will
@@ -1010,9 +1014,38 @@ def from_json(
             should be strictly greater than 1.
         buffersize (int): Size (in bytes) of the buffer used by the JSON
             parser.
+        lines (bool): If True, the source is in JSON-lines format: one JSON
+            document per line, which become the items of the output array
+            (even if there is only one line).
+        form (None, #ak.forms.Form, or str/dict equivalent): If not None, the
+            Form of the output array. The JSON must then be one array of items
+            of this Form (or one item per line, if `lines`).
+        num_threads (None or int): Number of threads to read JSON lines with
+            (only if `lines`); None means #ak.config.num_threads and 0 means
+            one per hardware thread.
 
     Converts a JSON string into an Awkward Array.
 
+    A string or file with several concatenated JSON documents is converted
+    into an array of them.
+
+    If a `form` is given, values are written directly into buffers for each
+    node of the Form, rather than discovering the type as they are read
+    (see #ak.layout.TypedArrayBuilder for the Forms that are supported).
+    This is faster and the output type is predictable: a value that does not
+    fit the Form is an error, as is a record without all of the Form's
+    fields or with fields that are not in it. Strings must be described as
+    a ListOffsetForm of `uint8`, with `"__array__": "string"` and
+    `"__array__": "char"` parameters for them to be recognized as strings.
+
+    If `lines` and `num_threads` is not 1, the source is cut at newlines into
+    chunks of a few megabytes, which are read on separate threads. With a
+    `form`, the output is partitioned, one partition per chunk. Without one,
+    the chunks are concatenated, and since each chunk's type is discovered
+    separately, the type may differ from a single-threaded read (for
+    instance, records with different fields in different chunks become a
+    union).
+
     Internally, this function uses #ak.layout.ArrayBuilder (see the high-level
     #ak.ArrayBuilder documentation for a more complete description), so it
     has the same flexibility and the same constraints. Any heterogeneous
@@ -1033,7 +1066,41 @@ def from_json(
     ):
         complex_real_string, complex_imag_string = complex_record_fields
 
-    if os.path.isfile(source):
+    if isinstance(form, str) or (ak._util.py27 and isinstance(form, ak._util.unicode)):
+        form = ak.forms.Form.fromjson(form)
+    elif isinstance(form, dict):
+        form = ak.forms.Form.fromjson(json.dumps(form))
+
+    if num_threads != 1 and not lines:
+        raise ValueError(
+            "num_threads can only be used with lines=True"
+            + ak._util.exception_suffix(__file__)
+        )
+
+    if num_threads != 1 and os.path.isfile(source):
+        layout = ak._ext.fromjsonlinesfile(
+            source,
+            nan_string=nan_string,
+            infinity_string=infinity_string,
+            minus_infinity_string=minus_infinity_string,
+            initial=initial,
+            resize=resize,
+            buffersize=buffersize,
+            num_threads=num_threads,
+            form=form,
+        )
+    elif num_threads != 1:
+        layout = ak._ext.fromjsonlines(
+            source,
+            nan_string=nan_string,
+            infinity_string=infinity_string,
+            minus_infinity_string=minus_infinity_string,
+            initial=initial,
+            resize=resize,
+            num_threads=num_threads,
+            form=form,
+        )
+    elif os.path.isfile(source):
         layout = ak._ext.fromjsonfile(
             source,
             nan_string=nan_string,
@@ -1042,6 +1109,8 @@ def from_json(
             initial=initial,
             resize=resize,
             buffersize=buffersize,
+            lines=lines,
+            form=form,
         )
     else:
         layout = ak._ext.fromjson(
@@ -1052,8 +1121,16 @@ def from_json(
             initial=initial,
             resize=resize,
             buffersize=buffersize,
+            lines=lines,
+            form=form,
         )
 
+    if isinstance(layout, ak._ext.IrregularlyPartitionedArray):
+        if layout.numpartitions == 1:
+            layout = layout.partitions[0]
+        else:
+            layout = ak.partition.PartitionedArray.from_ext(layout)
+
     def getfunction(recordnode):
         if isinstance(recordnode, ak.layout.RecordArray):
             keys = recordnode.keys()
@@ -3617,7 +3694,7 @@ def from_parquet(
             hold_cache = ak._util.MappingProxy({})
             lazy_cache = ak.layout.ArrayCache(hold_cache)
         elif lazy_cache is not None and not isinstance(
-            lazy_cache, ak.layout.ArrayCache
+            lazy_cache, (ak.layout.ArrayCache, ak.layout.LRUArrayCache)
         ):
             hold_cache = ak._util.MappingProxy.maybe_wrap(lazy_cache)
             if not isinstance(hold_cache, MutableMapping):
@@ -4801,7 +4878,7 @@ def from_buffers(
             hold_cache = ak._util.MappingProxy({})
             lazy_cache = ak.layout.ArrayCache(hold_cache)
         elif lazy_cache is not None and not isinstance(
-            lazy_cache, ak.layout.ArrayCache
+            lazy_cache, (ak.layout.ArrayCache, ak.layout.LRUArrayCache)
         ):
             hold_cache = ak._util.MappingProxy.maybe_wrap(lazy_cache)
             if not isinstance(hold_cache, MutableMapping):
@@ -3451,6 +3451,99 @@ def argcombinations(
             return out
 
 
+def iter_combinations(
+    array,
+    n,
+    chunksize=65536,
+    replacement=False,
+    fields=None,
+    parameters=None,
+    with_name=None,
+    highlevel=True,
+    behavior=None,
+):
+    """
+    Args:
+        array: Array of lists from which to choose `n` items without
+            replacement.
+        n (int): The number of items to choose from each list: `2` chooses
+            unique pairs, `3` chooses unique triples, etc.
+        chunksize (int): The maximum number of combinations in each chunk.
+        replacement (bool): If True, combinations that include the same
+            item more than once are allowed; otherwise each item in a
+            combinations is strictly unique.
+        fields (None or list of str): If None, the pairs/triples/etc. are
+            tuples with unnamed fields; otherwise, these `fields` name the
+            fields. The number of `fields` must be equal to `n`.
+        parameters (None or dict): Parameters for the new
+            #ak.layout.RecordArray nodes that are created by this operation.
+        with_name (None or str): Assigns a `"__record__"` name to the new
+            #ak.layout.RecordArray nodes that are created by this operation
+            (overriding `parameters`, if necessary).
+        highlevel (bool): If True, yield #ak.Array chunks; otherwise, yield
+            low-level #ak.layout.Content subclasses.
+        behavior (None or dict): Custom #ak.behavior for the output arrays,
+            if high-level.
+
+    Yields the same combinations as #ak.combinations with `axis=1`, in the
+    same order, but as `(parents, chunk)` pairs of at most `chunksize`
+    combinations: `chunk` is a flat array of tuples/records and `parents` is
+    a NumPy array of the index in `array` of the list each one came from.
+
+        >>> array = ak.Array([[1, 2, 3, 4], [], [5], [6, 7, 8]])
+        >>> for parents, chunk in ak.iter_combinations(array, 2, chunksize=4):
+        ...     print(parents.tolist(), ak.to_list(chunk))
+        ...
+        [0, 0, 0, 0] [(1, 2), (1, 3), (1, 4), (2, 3)]
+        [0, 0, 3, 3] [(2, 4), (3, 4), (6, 7), (6, 8)]
+        [3] [(7, 8)]
+
+    The full set of carry arrays for #ak.combinations grows as the `n`th
+    power of the list lengths; here, only one chunk's worth is in memory at
+    a time, so a search that immediately selects or reduces the
+    combinations (for instance, with `np.bincount(parents, ...)` or a
+    Numba-compiled loop over each chunk) has bounded memory use.
+    """
+    if parameters is None:
+        parameters = {}
+    else:
+        parameters = dict(parameters)
+    if with_name is not None:
+        parameters["__record__"] = with_name
+
+    layout = ak.operations.convert.to_layout(
+        array, allow_record=False, allow_other=False
+    )
+    if isinstance(layout, ak.partition.PartitionedArray):
+        partitions = layout.partitions
+        starts = [layout.start(i) for i in range(len(partitions))]
+    else:
+        partitions = [layout]
+        starts = [0]
+
+    if highlevel:
+        behavior = ak._util.behaviorof(array, behavior=behavior)
+
+    nplike = ak.nplike.of(layout)
+    for partition, start in zip(partitions, starts):
+        iterator = ak.layout.CombinationsIterator(
+            partition,
+            n,
+            replacement=replacement,
+            keys=fields,
+            parameters=parameters,
+            chunksize=chunksize,
+        )
+        for parents, chunk in iterator:
+            parents = nplike.asarray(parents)
+            if start != 0:
+                parents = parents + start
+            if highlevel:
+                yield parents, ak._util.wrap(chunk, behavior=behavior)
+            else:
+                yield parents, chunk
+
+
 def partitions(array):
     """
     Args:
@@ -3621,7 +3714,9 @@ def virtual(
             be generated earlier than intended; if a non-negative int, use this
             to predict the length and verify that the generated array complies.
         cache (None, "new", or MutableMapping): If "new", a new dict (keep-forever
-            cache) is created. If None, no cache is used.
+            cache) is created. If None, no cache is used. An
+            #ak.layout.LRUArrayCache is used directly, without calling back
+            into Python.
         cache_key (None or str): If None, a unique string is generated for this
             virtual array for use with the `cache` (unique per Python process);
             otherwise, the explicitly provided key is used (which ought to
@@ -3748,6 +3843,23 @@ def virtual(
     Functions with a `lazy` option, such as #ak.from_parquet and #ak.from_buffers,
     construct #ak.layout.RecordArray of #ak.layout.VirtualArray in this way.
 
+    Slicing a virtual array by a range of entries or by fields normally
+    generates the whole array and then slices it. If `generate` can make only
+    part of the array (for instance, by reading only some rows or columns of
+    a file), it can say so with any of these methods, each returning a new
+    callable that takes the same `args` and `kwargs`, or None if it can't:
+
+       * `generate.getitem_range(start, stop)`: makes only entries `start`
+         (inclusive) through `stop` (exclusive), which are non-negative;
+       * `generate.getitem_field(key)`: makes only one record field;
+       * `generate.getitem_fields(keys)`: makes only a list of fields.
+
+    These are also applied through chains of slices, such as
+    `array[1000:2000].x`, which generates only entries 1000 through 2000 of
+    field `"x"`. They are called when the slice is generated, and only if
+    the array it was sliced from is not in the `cache` by then; otherwise,
+    the slice is taken from the cached array.
+
     See also #ak.materialized.
     """
     if isinstance(form, str) and form in (
@@ -3779,7 +3891,9 @@ def virtual(
     if cache == "new":
         hold_cache = ak._util.MappingProxy({})
         cache = ak.layout.ArrayCache(hold_cache)
-    elif cache is not None and not isinstance(cache, ak.layout.ArrayCache):
+    elif cache is not None and not isinstance(
+        cache, (ak.layout.ArrayCache, ak.layout.LRUArrayCache)
+    ):
         hold_cache = ak._util.MappingProxy.maybe_wrap(cache)
         cache = ak.layout.ArrayCache(hold_cache)
 
@@ -3822,6 +3936,43 @@ def materialized(array, highlevel=True, behavior=None):
         return out
 
 
+def prefetch(array):
+    """
+    Args:
+        array: The possibly virtual array whose virtual nodes should start
+            generating.
+
+    Starts generating every #ak.layout.VirtualArray node in `array` that has
+    a cache on a background thread (see #ak.config.set_num_background_threads)
+    and returns immediately. Each array is put in its cache when it is done,
+    so that reading several columns overlaps with working on the ones that
+    have already been read:
+
+        >>> ak.prefetch(events[["muons", "jets"]])
+        >>> ak.num(events.electrons)   # while muons and jets are read
+        >>> ak.num(events.muons)       # waits only if muons is not done yet
+
+    A column that is used before its background thread finishes waits for
+    that thread instead of being generated again. Virtual arrays without a
+    cache are not prefetched (there would be nowhere to put them).
+
+    Virtual nodes inside other virtual nodes are only reached when the outer
+    ones have been generated.
+
+    See also #ak.virtual and #ak.materialized.
+    """
+
+    def getfunction(layout):
+        if isinstance(layout, ak.layout.VirtualArray):
+            layout.prefetch()
+            return lambda: layout
+        else:
+            return None
+
+    layout = ak.operations.convert.to_layout(array)
+    ak._util.recursively_apply(layout, getfunction, pass_depth=False, pass_user=False)
+
+
 def with_cache(array, cache, highlevel=True, behavior=None):
     """
     Args:
@@ -3832,6 +3983,8 @@ def with_cache(array, cache, highlevel=True, behavior=None):
             re-generated if `__getitem__` raises a `KeyError`. This mapping may
             evict elements according to any caching algorithm (LRU, LFR, RR,
             TTL, etc.). If "new", a new dict (keep-forever cache) is created.
+            An #ak.layout.LRUArrayCache is used directly, without calling back
+            into Python.
         highlevel (bool): If True, return an #ak.Array; otherwise, return
             a low-level #ak.layout.Content subclass.
         behavior (None or dict): Custom #ak.behavior for the output array, if
@@ -3868,7 +4021,9 @@ def with_cache(array, cache, highlevel=True, behavior=None):
     if cache == "new":
         hold_cache = ak._util.MappingProxy({})
         cache = ak.layout.ArrayCache(hold_cache)
-    elif cache is not None and not isinstance(cache, ak.layout.ArrayCache):
+    elif cache is not None and not isinstance(
+        cache, (ak.layout.ArrayCache, ak.layout.LRUArrayCache)
+    ):
         hold_cache = ak._util.MappingProxy.maybe_wrap(cache)
         cache = ak.layout.ArrayCache(hold_cache)
 
@@ -109,6 +109,12 @@ class PartitionedArray(object):
     def __repr__(self):
         return repr(self._ext)
 
+    def map_partitions(self, method, *args):
+        # The C++ method processes one partition per task with the GIL
+        # released, on several threads if ak.config.num_threads() > 1.
+        out = getattr(self._ext, method)(*args)
+        return IrregularlyPartitionedArray(out.partitions)
+
     @property
     def numpartitions(self):
         return self._ext.numpartitions
@@ -238,7 +244,7 @@ class PartitionedArray(object):
         elif isinstance(where, str) or (
             ak._util.py27 and isinstance(where, ak._util.unicode)
         ):
-            return self.replace_partitions([x[where] for x in self.partitions])
+            return self.map_partitions("map_getitem", where)
 
         elif isinstance(where, tuple) and len(where) == 0:
             return self
@@ -254,7 +260,7 @@ class PartitionedArray(object):
                 for x in where
             )
         ):
-            return self.replace_partitions([x[where] for x in self.partitions])
+            return self.map_partitions("map_getitem", where)
 
         else:
             if not isinstance(where, tuple):
@@ -275,22 +281,18 @@ class PartitionedArray(object):
                 return self.partition(partitionid)[(index,) + tail]
 
             elif isinstance(head, slice):
-                partitions = self._ext.getitem_range(
-                    head.start, head.stop, head.step
-                ).partitions
-                return IrregularlyPartitionedArray(
-                    [x[(slice(None),) + tail] for x in partitions]
+                ranged = PartitionedArray.from_ext(
+                    self._ext.getitem_range(head.start, head.stop, head.step)
                 )
+                return ranged.map_partitions("map_getitem", (slice(None),) + tail)
 
             elif head is Ellipsis:
-                return IrregularlyPartitionedArray(
-                    [x[(head,) + tail] for x in self.partitions]
-                )
+                return self.map_partitions("map_getitem", (head,) + tail)
 
             elif isinstance(head, str) or (
                 ak._util.py27 and isinstance(head, ak._util.unicode)
             ):
-                y = IrregularlyPartitionedArray([x[head] for x in self.partitions])
+                y = self.map_partitions("map_getitem", head)
                 if len(tail) == 0:
                     return y
                 else:
@@ -307,9 +309,7 @@ class PartitionedArray(object):
                     for x in head
                 )
             ):
-                y = IrregularlyPartitionedArray(
-                    [x[list(head)] for x in self.partitions]
-                )
+                y = self.map_partitions("map_getitem", list(head))
                 if len(tail) == 0:
                     return y
                 else:
@@ -560,8 +560,8 @@ class PartitionedArray(object):
             else:
                 return getattr(self.toContent(), name)(axis, mask, keepdims, initial)
         else:
-            return self.replace_partitions(
-                [getattr(x, name)(axis, mask, keepdims) for x in self.partitions]
+            return self.map_partitions(
+                "map_reduce", name, axis, mask, keepdims, initial
             )
 
     def count(self, axis, mask, keepdims):
@@ -616,28 +616,21 @@ class PartitionedArray(object):
         if first(self).axis_wrap_if_negative(axis) == 0:
             return self.toContent().combinations(n, replacement, keys, parameters, axis)
         else:
-            return self.replace_partitions(
-                [
-                    x.combinations(n, replacement, keys, parameters, axis)
-                    for x in self.partitions
-                ]
+            return self.map_partitions(
+                "map_combinations", n, replacement, keys, parameters, axis
             )
 
     def sort(self, axis, ascending, stable):
         if first(self).axis_wrap_if_negative(axis) == 0:
             return self.toContent().sort(axis, ascending, stable)
         else:
-            return self.replace_partitions(
-                [x.sort(axis, ascending, stable) for x in self.partitions]
-            )
+            return self.map_partitions("map_sort", axis, ascending, stable)
 
     def argsort(self, axis, ascending, stable):
         if first(self).axis_wrap_if_negative(axis) == 0:
             return self.toContent().argsort(axis, ascending, stable)
         else:
-            return self.replace_partitions(
-                [x.argsort(axis, ascending, stable) for x in self.partitions]
-            )
+            return self.map_partitions("map_argsort", axis, ascending, stable)
 
     def numbers_to_type(self, dtype_string):
         return self.replace_partitions(
@@ -0,0 +1,46 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_getitem_carry.cpp", line)
+
+#include "awkward/kernels.h"
+#include "awkward/kernel-bitmask.h"
+
+template <typename T>
+ERROR awkward_BitMaskedArray_getitem_carry(
+  uint8_t* tobitmask,
+  const uint8_t* frombitmask,
+  int64_t length,
+  const T* fromcarry,
+  int64_t lencarry,
+  bool lsb_order) {
+  // Each output byte is assembled in a register and written once.
+  for (int64_t start = 0;  start < lencarry;  start += 8) {
+    int64_t stop = (start + 8 < lencarry ? start + 8 : lencarry);
+    uint8_t byte = 0;
+    for (int64_t i = start;  i < stop;  i++) {
+      if (fromcarry[i] >= length) {
+        return failure("index out of range", i, fromcarry[i], FILENAME(__LINE__));
+      }
+      if (bitmask_get(frombitmask, fromcarry[i], lsb_order)) {
+        byte |= (uint8_t)(lsb_order ? (1 << (i - start)) : (128 >> (i - start)));
+      }
+    }
+    tobitmask[start >> 3] = byte;
+  }
+  return success();
+}
+ERROR awkward_BitMaskedArray_getitem_carry_64(
+  uint8_t* tobitmask,
+  const uint8_t* frombitmask,
+  int64_t length,
+  const int64_t* fromcarry,
+  int64_t lencarry,
+  bool lsb_order) {
+  return awkward_BitMaskedArray_getitem_carry<int64_t>(
+    tobitmask,
+    frombitmask,
+    length,
+    fromcarry,
+    lencarry,
+    lsb_order);
+}
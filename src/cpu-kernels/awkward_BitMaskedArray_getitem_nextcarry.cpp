@@ -0,0 +1,60 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_getitem_nextcarry.cpp", line)
+
+#include "awkward/kernels.h"
+#include "awkward/kernel-bitmask.h"
+
+template <typename T>
+ERROR awkward_BitMaskedArray_getitem_nextcarry(
+  T* tocarry,
+  const uint8_t* frombitmask,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  // Words of 64 missing items are skipped and words of 64 valid items are
+  // copied without testing each bit.
+  uint64_t allnull = validwhen ? 0 : ~((uint64_t)0);
+  int64_t numwords = length / 64;
+  int64_t k = 0;
+  for (int64_t w = 0;  w < numwords;  w++) {
+    uint64_t word = bitmask_word(frombitmask, w);
+    if (word == allnull) {
+      continue;
+    }
+    else if (word == ~allnull) {
+      for (int64_t i = w*64;  i < w*64 + 64;  i++) {
+        tocarry[k] = (T)i;
+        k++;
+      }
+    }
+    else {
+      for (int64_t i = w*64;  i < w*64 + 64;  i++) {
+        if (bitmask_get(frombitmask, i, lsb_order) == validwhen) {
+          tocarry[k] = (T)i;
+          k++;
+        }
+      }
+    }
+  }
+  for (int64_t i = numwords*64;  i < length;  i++) {
+    if (bitmask_get(frombitmask, i, lsb_order) == validwhen) {
+      tocarry[k] = (T)i;
+      k++;
+    }
+  }
+  return success();
+}
+ERROR awkward_BitMaskedArray_getitem_nextcarry_64(
+  int64_t* tocarry,
+  const uint8_t* frombitmask,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  return awkward_BitMaskedArray_getitem_nextcarry<int64_t>(
+    tocarry,
+    frombitmask,
+    length,
+    validwhen,
+    lsb_order);
+}
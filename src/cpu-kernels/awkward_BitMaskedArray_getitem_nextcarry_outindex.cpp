@@ -0,0 +1,72 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_getitem_nextcarry_outindex.cpp", line)
+
+#include "awkward/kernels.h"
+#include "awkward/kernel-bitmask.h"
+
+template <typename T>
+ERROR awkward_BitMaskedArray_getitem_nextcarry_outindex(
+  T* tocarry,
+  T* outindex,
+  const uint8_t* frombitmask,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  uint64_t allnull = validwhen ? 0 : ~((uint64_t)0);
+  int64_t numwords = length / 64;
+  int64_t k = 0;
+  for (int64_t w = 0;  w < numwords;  w++) {
+    uint64_t word = bitmask_word(frombitmask, w);
+    if (word == allnull) {
+      for (int64_t i = w*64;  i < w*64 + 64;  i++) {
+        outindex[i] = -1;
+      }
+    }
+    else if (word == ~allnull) {
+      for (int64_t i = w*64;  i < w*64 + 64;  i++) {
+        tocarry[k] = (T)i;
+        outindex[i] = (T)k;
+        k++;
+      }
+    }
+    else {
+      for (int64_t i = w*64;  i < w*64 + 64;  i++) {
+        if (bitmask_get(frombitmask, i, lsb_order) == validwhen) {
+          tocarry[k] = (T)i;
+          outindex[i] = (T)k;
+          k++;
+        }
+        else {
+          outindex[i] = -1;
+        }
+      }
+    }
+  }
+  for (int64_t i = numwords*64;  i < length;  i++) {
+    if (bitmask_get(frombitmask, i, lsb_order) == validwhen) {
+      tocarry[k] = (T)i;
+      outindex[i] = (T)k;
+      k++;
+    }
+    else {
+      outindex[i] = -1;
+    }
+  }
+  return success();
+}
+ERROR awkward_BitMaskedArray_getitem_nextcarry_outindex_64(
+  int64_t* tocarry,
+  int64_t* outindex,
+  const uint8_t* frombitmask,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  return awkward_BitMaskedArray_getitem_nextcarry_outindex<int64_t>(
+    tocarry,
+    outindex,
+    frombitmask,
+    length,
+    validwhen,
+    lsb_order);
+}
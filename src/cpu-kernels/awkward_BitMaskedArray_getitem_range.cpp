@@ -0,0 +1,38 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_getitem_range.cpp", line)
+
+#include "awkward/kernels.h"
+
+ERROR awkward_BitMaskedArray_getitem_range(
+  uint8_t* tobitmask,
+  const uint8_t* frombitmask,
+  int64_t start,
+  int64_t length,
+  bool lsb_order) {
+  if (length <= 0) {
+    return success();
+  }
+  // Each output byte takes the high part of one input byte and the low part
+  // of the next (or the other way around for most-significant-bit order).
+  int64_t first = start >> 3;
+  int64_t last = (start + length - 1) >> 3;
+  int shift = (int)(start & 7);
+  int64_t numbytes = (length + 7) >> 3;
+  for (int64_t j = 0;  j < numbytes;  j++) {
+    uint8_t lo = frombitmask[first + j];
+    if (shift == 0) {
+      tobitmask[j] = lo;
+    }
+    else {
+      uint8_t hi = (first + j + 1 <= last ? frombitmask[first + j + 1] : 0);
+      if (lsb_order) {
+        tobitmask[j] = (uint8_t)((lo >> shift) | (hi << (8 - shift)));
+      }
+      else {
+        tobitmask[j] = (uint8_t)((lo << shift) | (hi >> (8 - shift)));
+      }
+    }
+  }
+  return success();
+}
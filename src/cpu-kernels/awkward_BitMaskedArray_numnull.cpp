@@ -0,0 +1,24 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_numnull.cpp", line)
+
+#include "awkward/kernels.h"
+#include "awkward/kernel-bitmask.h"
+
+ERROR awkward_BitMaskedArray_numnull(
+  int64_t* numnull,
+  const uint8_t* frombitmask,
+  int64_t length,
+  bool validwhen,
+  bool lsb_order) {
+  int64_t numset = 0;
+  int64_t numwords = length / 64;
+  for (int64_t w = 0;  w < numwords;  w++) {
+    numset += bitmask_popcount(bitmask_word(frombitmask, w));
+  }
+  for (int64_t i = numwords*64;  i < length;  i++) {
+    numset += bitmask_get(frombitmask, i, lsb_order);
+  }
+  *numnull = validwhen ? length - numset : numset;
+  return success();
+}
@@ -0,0 +1,22 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_BitMaskedArray_overlay_mask.cpp", line)
+
+#include "awkward/kernels.h"
+
+ERROR awkward_BitMaskedArray_overlay_mask(
+  uint8_t* tobitmask,
+  const uint8_t* outerbitmask,
+  bool outervalidwhen,
+  const uint8_t* innerbitmask,
+  bool innervalidwhen,
+  int64_t bitmasklength) {
+  // The output is set (valid) where both inputs are valid.
+  uint8_t outerflip = (outervalidwhen ? 0 : 255);
+  uint8_t innerflip = (innervalidwhen ? 0 : 255);
+  for (int64_t i = 0;  i < bitmasklength;  i++) {
+    tobitmask[i] = (uint8_t)((outerbitmask[i] ^ outerflip) &
+                             (innerbitmask[i] ^ innerflip));
+  }
+  return success();
+}
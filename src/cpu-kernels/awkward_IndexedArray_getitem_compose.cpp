@@ -0,0 +1,21 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_IndexedArray_getitem_compose.cpp", line)
+
+#include "awkward/kernels.h"
+
+ERROR awkward_IndexedArray64_getitem_compose_64(
+  int64_t* toindex,
+  const int64_t* outerindex,
+  const int64_t* innerindex,
+  int64_t lenouter,
+  int64_t leninner) {
+  for (int64_t i = 0;  i < lenouter;  i++) {
+    int64_t j = outerindex[i];
+    if (j < 0  ||  j >= leninner) {
+      return failure("index out of range", i, j, FILENAME(__LINE__));
+    }
+    toindex[i] = innerindex[j];
+  }
+  return success();
+}
@@ -0,0 +1,66 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_ListArray_combinations_chunk.cpp", line)
+
+#include "awkward/kernels.h"
+
+// Fills at most `maxlength` combinations, resuming from the state left by the
+// previous call: `position[0]` is the list being enumerated and `index` holds
+// its next combination, or `index[0] < 0` if that list hasn't been started.
+ERROR awkward_ListArray_combinations_chunk_64(
+  int64_t** tocarry,
+  int64_t* toparents,
+  int64_t* tolength,
+  int64_t* index,
+  int64_t* position,
+  int64_t n,
+  bool replacement,
+  const int64_t* starts,
+  const int64_t* stops,
+  int64_t length,
+  int64_t maxlength) {
+  int64_t k = 0;
+  int64_t i = *position;
+  while (k < maxlength  &&  i < length) {
+    int64_t start = starts[i];
+    int64_t stop = stops[i];
+    if (index[0] < 0) {
+      if (stop - start < (replacement ? 1 : n)) {
+        i++;
+        continue;
+      }
+      for (int64_t j = 0;  j < n;  j++) {
+        index[j] = replacement ? start : start + j;
+      }
+    }
+    for (int64_t j = 0;  j < n;  j++) {
+      tocarry[j][k] = index[j];
+    }
+    toparents[k] = i;
+    k++;
+    int64_t j = n - 1;
+    if (replacement) {
+      while (j >= 0  &&  index[j] >= stop - 1) {
+        j--;
+      }
+    }
+    else {
+      while (j >= 0  &&  index[j] >= stop - (n - j)) {
+        j--;
+      }
+    }
+    if (j < 0) {
+      index[0] = -1;
+      i++;
+    }
+    else {
+      index[j]++;
+      for (int64_t m = j + 1;  m < n;  m++) {
+        index[m] = replacement ? index[j] : index[m - 1] + 1;
+      }
+    }
+  }
+  *position = i;
+  *tolength = k;
+  return success();
+}
@@ -0,0 +1,170 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_NumpyArray_fused_elementwise.cpp", line)
+
+#include <cmath>
+
+#include "awkward/kernels.h"
+#include "awkward/kernel-fused.h"
+
+// Evaluates the whole program on `blocksize` items at a time, so that the
+// intermediate values stay in `stack` (`stackdepth*blocksize` items, which
+// fits in cache) instead of being written out as a full array per operation.
+ERROR awkward_NumpyArray_fused_elementwise_64(
+  double* toptr,
+  const double** fromptrs,
+  const int64_t* program,
+  int64_t programlength,
+  const double* constants,
+  double* stack,
+  int64_t stackdepth,
+  int64_t blocksize,
+  int64_t length) {
+  for (int64_t start = 0;  start < length;  start += blocksize) {
+    int64_t n = (length - start < blocksize ? length - start : blocksize);
+    int64_t top = 0;
+    for (int64_t pc = 0;  pc < programlength;  pc++) {
+      int64_t opcode = program[2*pc];
+      int64_t argument = program[2*pc + 1];
+      if (opcode == FUSED_INPUT  ||  opcode == FUSED_CONSTANT) {
+        if (top >= stackdepth) {
+          return failure("stack overflow", pc, kSliceNone, FILENAME(__LINE__));
+        }
+        double* x = &stack[top*blocksize];
+        if (opcode == FUSED_INPUT) {
+          const double* from = &fromptrs[argument][start];
+          for (int64_t i = 0;  i < n;  i++) {
+            x[i] = from[i];
+          }
+        }
+        else {
+          double value = constants[argument];
+          for (int64_t i = 0;  i < n;  i++) {
+            x[i] = value;
+          }
+        }
+        top++;
+      }
+      else if (opcode < FUSED_ADD) {
+        if (top < 1) {
+          return failure("stack underflow", pc, kSliceNone, FILENAME(__LINE__));
+        }
+        double* x = &stack[(top - 1)*blocksize];
+        switch (opcode) {
+          case FUSED_NEGATIVE:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = -x[i]; }
+            break;
+          case FUSED_POSITIVE:
+            break;
+          case FUSED_ABSOLUTE:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::fabs(x[i]); }
+            break;
+          case FUSED_SQUARE:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = x[i] * x[i]; }
+            break;
+          case FUSED_SQRT:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::sqrt(x[i]); }
+            break;
+          case FUSED_CBRT:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::cbrt(x[i]); }
+            break;
+          case FUSED_EXP:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::exp(x[i]); }
+            break;
+          case FUSED_EXPM1:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::expm1(x[i]); }
+            break;
+          case FUSED_LOG:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::log(x[i]); }
+            break;
+          case FUSED_LOG1P:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::log1p(x[i]); }
+            break;
+          case FUSED_LOG10:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::log10(x[i]); }
+            break;
+          case FUSED_SIN:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::sin(x[i]); }
+            break;
+          case FUSED_COS:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::cos(x[i]); }
+            break;
+          case FUSED_TAN:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::tan(x[i]); }
+            break;
+          case FUSED_ARCSIN:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::asin(x[i]); }
+            break;
+          case FUSED_ARCCOS:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::acos(x[i]); }
+            break;
+          case FUSED_ARCTAN:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::atan(x[i]); }
+            break;
+          case FUSED_SINH:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::sinh(x[i]); }
+            break;
+          case FUSED_COSH:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::cosh(x[i]); }
+            break;
+          case FUSED_TANH:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::tanh(x[i]); }
+            break;
+          default:
+            return failure("unrecognized opcode", pc, opcode, FILENAME(__LINE__));
+        }
+      }
+      else {
+        if (top < 2) {
+          return failure("stack underflow", pc, kSliceNone, FILENAME(__LINE__));
+        }
+        double* x = &stack[(top - 2)*blocksize];
+        const double* y = &stack[(top - 1)*blocksize];
+        switch (opcode) {
+          case FUSED_ADD:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = x[i] + y[i]; }
+            break;
+          case FUSED_SUBTRACT:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = x[i] - y[i]; }
+            break;
+          case FUSED_MULTIPLY:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = x[i] * y[i]; }
+            break;
+          case FUSED_DIVIDE:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = x[i] / y[i]; }
+            break;
+          case FUSED_POWER:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::pow(x[i], y[i]); }
+            break;
+          case FUSED_ARCTAN2:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::atan2(x[i], y[i]); }
+            break;
+          case FUSED_HYPOT:
+            for (int64_t i = 0;  i < n;  i++) { x[i] = std::hypot(x[i], y[i]); }
+            break;
+          // like NumPy (unlike std::fmax and std::fmin), NaN propagates
+          case FUSED_MAXIMUM:
+            for (int64_t i = 0;  i < n;  i++) {
+              x[i] = (x[i] > y[i]  ||  x[i] != x[i]) ? x[i] : y[i];
+            }
+            break;
+          case FUSED_MINIMUM:
+            for (int64_t i = 0;  i < n;  i++) {
+              x[i] = (x[i] < y[i]  ||  x[i] != x[i]) ? x[i] : y[i];
+            }
+            break;
+          default:
+            return failure("unrecognized opcode", pc, opcode, FILENAME(__LINE__));
+        }
+        top--;
+      }
+    }
+    if (top != 1) {
+      return failure("program must leave exactly one result on the stack", top, kSliceNone, FILENAME(__LINE__));
+    }
+    for (int64_t i = 0;  i < n;  i++) {
+      toptr[start + i] = stack[i];
+    }
+  }
+  return success();
+}
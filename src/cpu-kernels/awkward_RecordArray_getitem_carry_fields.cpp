@@ -0,0 +1,64 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_RecordArray_getitem_carry_fields.cpp", line)
+
+#include "awkward/kernels.h"
+
+template <typename T>
+void awkward_RecordArray_getitem_carry_fields_block(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  const int64_t* carry,
+  int64_t start,
+  int64_t stop) {
+  for (int64_t i = start;  i < stop;  i++) {
+    std::memcpy(&toptr[i*(int64_t)sizeof(T)],
+                &fromptr[carry[i]*(int64_t)sizeof(T)],
+                sizeof(T));
+  }
+}
+
+// Gathers every field by the same carry, a block of the carry at a time, so
+// that the carry is read once (and stays in cache) for all of the fields.
+ERROR awkward_RecordArray_getitem_carry_fields_64(
+  uint8_t** toptrs,
+  const uint8_t** fromptrs,
+  const int64_t* strides,
+  int64_t numfields,
+  const int64_t* carry,
+  int64_t lencarry) {
+  const int64_t blocksize = 1024;
+  for (int64_t start = 0;  start < lencarry;  start += blocksize) {
+    int64_t stop = (lencarry - start < blocksize ? lencarry : start + blocksize);
+    for (int64_t j = 0;  j < numfields;  j++) {
+      uint8_t* toptr = toptrs[j];
+      const uint8_t* fromptr = fromptrs[j];
+      int64_t stride = strides[j];
+      switch (stride) {
+        case 1:
+          awkward_RecordArray_getitem_carry_fields_block<uint8_t>(
+            toptr, fromptr, carry, start, stop);
+          break;
+        case 2:
+          awkward_RecordArray_getitem_carry_fields_block<uint16_t>(
+            toptr, fromptr, carry, start, stop);
+          break;
+        case 4:
+          awkward_RecordArray_getitem_carry_fields_block<uint32_t>(
+            toptr, fromptr, carry, start, stop);
+          break;
+        case 8:
+          awkward_RecordArray_getitem_carry_fields_block<uint64_t>(
+            toptr, fromptr, carry, start, stop);
+          break;
+        default:
+          for (int64_t i = start;  i < stop;  i++) {
+            std::memcpy(&toptr[i*stride],
+                        &fromptr[carry[i]*stride],
+                        (size_t)stride);
+          }
+      }
+    }
+  }
+  return success();
+}
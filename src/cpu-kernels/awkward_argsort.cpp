@@ -2,11 +2,8 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_argsort.cpp", line)
 
-#include <algorithm>
-#include <numeric>
-#include <vector>
-
 #include "awkward/kernels.h"
+#include "awkward/kernel-sorting.h"
 
 template <typename T>
 ERROR awkward_argsort(
@@ -17,60 +14,17 @@ ERROR awkward_argsort(
   int64_t offsetslength,
   bool ascending,
   bool stable) {
-  std::vector<int64_t> result(length);
-  std::iota(result.begin(), result.end(), 0);
-
-  if (ascending  &&  stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(result.begin(), offsets[i]);
-      auto stop = std::next(result.begin(), offsets[i + 1]);
-      std::stable_sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] < fromptr[i2];
-      });
-      std::transform(start, stop, start, [&](int64_t j) -> int64_t {
-        return j - offsets[i];
-      });
-    }
-  }
-  else if (!ascending  &&  stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(result.begin(), offsets[i]);
-      auto stop = std::next(result.begin(), offsets[i + 1]);
-      std::stable_sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] > fromptr[i2];
-      });
-      std::transform(start, stop, start, [&](int64_t j) -> int64_t {
-        return j - offsets[i];
-      });
-    }
-  }
-  else if (ascending  &&  !stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(result.begin(), offsets[i]);
-      auto stop = std::next(result.begin(), offsets[i + 1]);
-      std::sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] < fromptr[i2];
-      });
-      std::transform(start, stop, start, [&](int64_t j) -> int64_t {
-        return j - offsets[i];
-      });
-    }
-  }
-  else {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(result.begin(), offsets[i]);
-      auto stop = std::next(result.begin(), offsets[i + 1]);
-      std::sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] > fromptr[i2];
-      });
-      std::transform(start, stop, start, [&](int64_t j) -> int64_t {
-        return j - offsets[i];
-      });
-    }
-  }
-
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[i] = result[i];
+  std::iota(toptr, toptr + length, 0);
+
+  std::unique_ptr<int64_t[]> scratch(
+    new int64_t[sorting_scratch_length(offsets, offsetslength)]);
+  for (int64_t i = 0;  i < offsetslength - 1;  i++) {
+    argsort_sublist(&toptr[offsets[i]],
+                    &fromptr[offsets[i]],
+                    offsets[i + 1] - offsets[i],
+                    ascending,
+                    stable,
+                    scratch.get());
   }
 
   return success();
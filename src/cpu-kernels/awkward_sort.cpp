@@ -3,10 +3,7 @@
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS_C("src/cpu-kernels/awkward_sort.cpp", line)
 
 #include "awkward/kernels.h"
-
-#include <algorithm>
-#include <numeric>
-#include <vector>
+#include "awkward/kernel-sorting.h"
 
 template <typename T>
 ERROR awkward_sort(
@@ -18,48 +15,26 @@ ERROR awkward_sort(
   int64_t parentslength,
   bool ascending,
   bool stable) {
-  std::vector<int64_t> index(length);
-  std::iota(index.begin(), index.end(), 0);
-
-  if (ascending  &&  stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(index.begin(), offsets[i]);
-      auto stop = std::next(index.begin(), offsets[i + 1]);
-      std::stable_sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] < fromptr[i2];
-      });
-    }
-  }
-  else if (!ascending  &&  stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(index.begin(), offsets[i]);
-      auto stop = std::next(index.begin(), offsets[i + 1]);
-      std::stable_sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] > fromptr[i2];
-      });
-    }
+  std::unique_ptr<T[]> buffer;
+  T* out = toptr;
+  if (parentslength < length) {
+    buffer.reset(new T[length]);
+    out = buffer.get();
   }
-  else if (ascending  &&  !stable) {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(index.begin(), offsets[i]);
-      auto stop = std::next(index.begin(), offsets[i + 1]);
-      std::sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] < fromptr[i2];
-      });
-    }
-  }
-  else {
-    for (int64_t i = 0;  i < offsetslength - 1;  i++) {
-      auto start = std::next(index.begin(), offsets[i]);
-      auto stop = std::next(index.begin(), offsets[i + 1]);
-      std::sort(start, stop, [&fromptr](int64_t i1, int64_t i2) {
-        return fromptr[i1] > fromptr[i2];
-      });
-    }
+  std::copy(fromptr, fromptr + length, out);
+
+  std::unique_ptr<T[]> scratch(
+    new T[sorting_scratch_length(offsets, offsetslength)]);
+  for (int64_t i = 0;  i < offsetslength - 1;  i++) {
+    sort_sublist(&out[offsets[i]],
+                 offsets[i + 1] - offsets[i],
+                 ascending,
+                 stable,
+                 scratch.get());
   }
 
-  for (int64_t i = 0;  i < parentslength;  i++) {
-    toptr[i] = fromptr[index[i]];
+  if (out != toptr) {
+    std::copy(out, out + parentslength, toptr);
   }
 
   return success();
@@ -0,0 +1,1083 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/Broadcasting.cpp", line)
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/array/BitMaskedArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/array/UnmaskedArray.h"
+#include "awkward/array/VirtualArray.h"
+
+#include "awkward/Broadcasting.h"
+
+namespace awkward {
+  BroadcastFunction::~BroadcastFunction() = default;
+
+  bool
+  BroadcastFunction::has_custom_broadcast(const ContentPtr& input) {
+    return false;
+  }
+
+  const ContentPtr
+  BroadcastFunction::custom_broadcast(const ContentPtr& input,
+                                      const Index64& offsets) {
+    throw std::runtime_error(
+      std::string("BroadcastFunction has no custom broadcasting")
+      + FILENAME(__LINE__));
+  }
+
+  BroadcastOptions::BroadcastOptions()
+      : allow_records(true)
+      , left_broadcast(true)
+      , right_broadcast(true)
+      , numpy_to_regular(false)
+      , regular_to_jagged(false)
+      , leaves_only(false) { }
+
+  namespace {
+    ////////// node types
+
+    bool
+    is_listoffset(const Content* x) {
+      return dynamic_cast<const ListOffsetArray32*>(x)  ||
+             dynamic_cast<const ListOffsetArrayU32*>(x)  ||
+             dynamic_cast<const ListOffsetArray64*>(x);
+    }
+
+    bool
+    is_listarray(const Content* x) {
+      return dynamic_cast<const ListArray32*>(x)  ||
+             dynamic_cast<const ListArrayU32*>(x)  ||
+             dynamic_cast<const ListArray64*>(x);
+    }
+
+    bool
+    is_list(const Content* x) {
+      return dynamic_cast<const RegularArray*>(x)  ||
+             is_listoffset(x)  ||
+             is_listarray(x);
+    }
+
+    bool
+    is_indexed(const Content* x) {
+      return dynamic_cast<const IndexedArray32*>(x)  ||
+             dynamic_cast<const IndexedArrayU32*>(x)  ||
+             dynamic_cast<const IndexedArray64*>(x);
+    }
+
+    bool
+    is_option(const Content* x) {
+      return dynamic_cast<const IndexedOptionArray32*>(x)  ||
+             dynamic_cast<const IndexedOptionArray64*>(x)  ||
+             dynamic_cast<const ByteMaskedArray*>(x)  ||
+             dynamic_cast<const BitMaskedArray*>(x)  ||
+             dynamic_cast<const UnmaskedArray*>(x);
+    }
+
+    bool
+    is_union(const Content* x) {
+      return dynamic_cast<const UnionArray8_32*>(x)  ||
+             dynamic_cast<const UnionArray8_U32*>(x)  ||
+             dynamic_cast<const UnionArray8_64*>(x);
+    }
+
+    bool
+    has_custom_parameter(const Content* x) {
+      return x->parameter("__array__") != std::string("null")  ||
+             x->parameter("__record__") != std::string("null");
+    }
+
+    /// @brief RegularArrays of RegularArrays of ... NumpyArrays, without
+    /// custom parameters, which a function can treat as one NumpyArray.
+    bool
+    is_fully_regular(const Content* x) {
+      if (const RegularArray* raw = dynamic_cast<const RegularArray*>(x)) {
+        if (has_custom_parameter(x)) {
+          return false;
+        }
+        const Content* content = raw->content().get();
+        return dynamic_cast<const NumpyArray*>(content) != nullptr  ||
+               is_fully_regular(content);
+      }
+      return false;
+    }
+
+    bool
+    is_leaf(const ContentPtrVec& inputs) {
+      bool out = true;
+      for (auto x : inputs) {
+        if (x.get() == nullptr) {
+          continue;
+        }
+        if (has_custom_parameter(x.get())) {
+          return true;
+        }
+        if (dynamic_cast<NumpyArray*>(x.get()) == nullptr  &&
+            !is_fully_regular(x.get())) {
+          out = false;
+        }
+      }
+      return out;
+    }
+
+    ////////// accessors for the templated node types
+
+    const ContentPtr
+    indexed_project(const Content* x) {
+      if (auto raw = dynamic_cast<const IndexedArray32*>(x)) {
+        return raw->project();
+      }
+      else if (auto raw = dynamic_cast<const IndexedArrayU32*>(x)) {
+        return raw->project();
+      }
+      else {
+        return dynamic_cast<const IndexedArray64*>(x)->project();
+      }
+    }
+
+    const Index8
+    option_bytemask(const Content* x) {
+      if (auto raw = dynamic_cast<const IndexedOptionArray32*>(x)) {
+        return raw->bytemask();
+      }
+      else if (auto raw = dynamic_cast<const IndexedOptionArray64*>(x)) {
+        return raw->bytemask();
+      }
+      else if (auto raw = dynamic_cast<const ByteMaskedArray*>(x)) {
+        return raw->bytemask();
+      }
+      else if (auto raw = dynamic_cast<const BitMaskedArray*>(x)) {
+        return raw->bytemask();
+      }
+      else {
+        return dynamic_cast<const UnmaskedArray*>(x)->bytemask();
+      }
+    }
+
+    const ContentPtr
+    option_project(const Content* x, const Index8& mask) {
+      if (auto raw = dynamic_cast<const IndexedOptionArray32*>(x)) {
+        return raw->project(mask);
+      }
+      else if (auto raw = dynamic_cast<const IndexedOptionArray64*>(x)) {
+        return raw->project(mask);
+      }
+      else if (auto raw = dynamic_cast<const ByteMaskedArray*>(x)) {
+        return raw->project(mask);
+      }
+      else if (auto raw = dynamic_cast<const BitMaskedArray*>(x)) {
+        return raw->project(mask);
+      }
+      else {
+        return dynamic_cast<const UnmaskedArray*>(x)->project(mask);
+      }
+    }
+
+    const Index8
+    union_tags(const Content* x) {
+      if (auto raw = dynamic_cast<const UnionArray8_32*>(x)) {
+        return raw->tags();
+      }
+      else if (auto raw = dynamic_cast<const UnionArray8_U32*>(x)) {
+        return raw->tags();
+      }
+      else {
+        return dynamic_cast<const UnionArray8_64*>(x)->tags();
+      }
+    }
+
+    const ContentPtr
+    union_project(const Content* x, int64_t tag) {
+      if (auto raw = dynamic_cast<const UnionArray8_32*>(x)) {
+        return raw->project(tag);
+      }
+      else if (auto raw = dynamic_cast<const UnionArray8_U32*>(x)) {
+        return raw->project(tag);
+      }
+      else {
+        return dynamic_cast<const UnionArray8_64*>(x)->project(tag);
+      }
+    }
+
+    const ContentPtrVec
+    union_contents(const Content* x) {
+      if (auto raw = dynamic_cast<const UnionArray8_32*>(x)) {
+        return raw->contents();
+      }
+      else if (auto raw = dynamic_cast<const UnionArray8_U32*>(x)) {
+        return raw->contents();
+      }
+      else {
+        return dynamic_cast<const UnionArray8_64*>(x)->contents();
+      }
+    }
+
+    const ContentPtr
+    list_content(const Content* x) {
+      if (auto raw = dynamic_cast<const RegularArray*>(x)) {
+        return raw->content();
+      }
+      else if (auto raw = dynamic_cast<const ListArray32*>(x)) {
+        return raw->content();
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(x)) {
+        return raw->content();
+      }
+      else if (auto raw = dynamic_cast<const ListArray64*>(x)) {
+        return raw->content();
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray32*>(x)) {
+        return raw->content();
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(x)) {
+        return raw->content();
+      }
+      else {
+        return dynamic_cast<const ListOffsetArray64*>(x)->content();
+      }
+    }
+
+    const Index64
+    list_compact_offsets64(const Content* x) {
+      if (auto raw = dynamic_cast<const ListArray32*>(x)) {
+        return raw->compact_offsets64(true);
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(x)) {
+        return raw->compact_offsets64(true);
+      }
+      else if (auto raw = dynamic_cast<const ListArray64*>(x)) {
+        return raw->compact_offsets64(true);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray32*>(x)) {
+        return raw->compact_offsets64(true);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(x)) {
+        return raw->compact_offsets64(true);
+      }
+      else {
+        return dynamic_cast<const ListOffsetArray64*>(x)->compact_offsets64(
+          true);
+      }
+    }
+
+    const ContentPtr
+    list_broadcast_tooffsets64(const Content* x, const Index64& offsets) {
+      ContentPtr out;
+      if (auto raw = dynamic_cast<const RegularArray*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else if (auto raw = dynamic_cast<const ListArray32*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else if (auto raw = dynamic_cast<const ListArray64*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray32*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(x)) {
+        out = raw->broadcast_tooffsets64(offsets);
+      }
+      else {
+        out = dynamic_cast<const ListOffsetArray64*>(x)->broadcast_tooffsets64(
+          offsets);
+      }
+      return dynamic_cast<ListOffsetArray64*>(out.get())->content();
+    }
+
+    template <typename T>
+    const Index64
+    listarray_offsets(const ListArrayOf<T>* x, bool& contiguous) {
+      const IndexOf<T> starts = x->starts();
+      const IndexOf<T> stops = x->stops();
+      int64_t len = starts.length();
+      Index64 out(len + 1);
+      contiguous = true;
+      out.data()[0] = 0;
+      for (int64_t i = 0;  i < len;  i++) {
+        if (i + 1 < len  &&  starts.data()[i + 1] != stops.data()[i]) {
+          contiguous = false;
+          break;
+        }
+        out.data()[i] = (int64_t)starts.data()[i];
+        out.data()[i + 1] = (int64_t)stops.data()[i];
+      }
+      return out;
+    }
+
+    /// @brief Offsets of a ListOffsetArray or of a ListArray whose lists are
+    /// contiguous (otherwise `contiguous` is set to `false`).
+    const Index64
+    list_offsets(const Content* x, bool& contiguous) {
+      contiguous = true;
+      if (auto raw = dynamic_cast<const ListArray32*>(x)) {
+        return listarray_offsets<int32_t>(raw, contiguous);
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(x)) {
+        return listarray_offsets<uint32_t>(raw, contiguous);
+      }
+      else if (auto raw = dynamic_cast<const ListArray64*>(x)) {
+        return listarray_offsets<int64_t>(raw, contiguous);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray32*>(x)) {
+        return raw->offsets().to64();
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(x)) {
+        return raw->offsets().to64();
+      }
+      else {
+        return dynamic_cast<const ListOffsetArray64*>(x)->offsets();
+      }
+    }
+
+    bool
+    all_same_offsets(const ContentPtrVec& inputs) {
+      std::shared_ptr<Index64> offsets(nullptr);
+      for (auto x : inputs) {
+        if (x.get() == nullptr) {
+          continue;
+        }
+        if (!is_listoffset(x.get())  &&  !is_listarray(x.get())) {
+          return false;
+        }
+        bool contiguous;
+        Index64 my_offsets = list_offsets(x.get(), contiguous);
+        if (!contiguous) {
+          return false;
+        }
+        if (offsets.get() == nullptr) {
+          offsets = std::make_shared<Index64>(my_offsets);
+        }
+        else if (offsets.get()->length() != my_offsets.length()  ||
+                 std::memcmp(offsets.get()->data(),
+                             my_offsets.data(),
+                             (size_t)my_offsets.length()*sizeof(int64_t))
+                 != 0) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template <typename T>
+    T
+    index_max(const IndexOf<T>& index) {
+      T out = index.data()[0];
+      for (int64_t i = 1;  i < index.length();  i++) {
+        out = std::max(out, index.data()[i]);
+      }
+      return out;
+    }
+
+    /// @brief The content of a list whose offsets are shared with the other
+    /// inputs, trimmed to the part that its lists cover.
+    const ContentPtr
+    same_offsets_content(const Content* x) {
+      int64_t lencontent;
+      if (auto raw = dynamic_cast<const ListOffsetArray32*>(x)) {
+        lencontent = raw->offsets().getitem_at_nowrap(raw->length());
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(x)) {
+        lencontent = raw->offsets().getitem_at_nowrap(raw->length());
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray64*>(x)) {
+        lencontent = raw->offsets().getitem_at_nowrap(raw->length());
+      }
+      else if (x->length() == 0) {
+        lencontent = 0;
+      }
+      else if (auto raw = dynamic_cast<const ListArray32*>(x)) {
+        lencontent = (int64_t)index_max<int32_t>(raw->stops());
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(x)) {
+        lencontent = (int64_t)index_max<uint32_t>(raw->stops());
+      }
+      else {
+        lencontent = index_max<int64_t>(
+          dynamic_cast<const ListArray64*>(x)->stops());
+      }
+      return list_content(x).get()->getitem_range_nowrap(0, lencontent);
+    }
+
+    /// @brief A list node of the same type and structure as `like` around
+    /// a new `content`.
+    const ContentPtr
+    same_offsets_list(const Content* like, const ContentPtr& content) {
+      IdentitiesPtr none = Identities::none();
+      util::Parameters noparams;
+      if (auto raw = dynamic_cast<const ListOffsetArray32*>(like)) {
+        return std::make_shared<ListOffsetArray32>(
+          none, noparams, raw->offsets(), content);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArrayU32*>(like)) {
+        return std::make_shared<ListOffsetArrayU32>(
+          none, noparams, raw->offsets(), content);
+      }
+      else if (auto raw = dynamic_cast<const ListOffsetArray64*>(like)) {
+        return std::make_shared<ListOffsetArray64>(
+          none, noparams, raw->offsets(), content);
+      }
+      else if (auto raw = dynamic_cast<const ListArray32*>(like)) {
+        return std::make_shared<ListArray32>(
+          none, noparams, raw->starts(), raw->stops(), content);
+      }
+      else if (auto raw = dynamic_cast<const ListArrayU32*>(like)) {
+        return std::make_shared<ListArrayU32>(
+          none, noparams, raw->starts(), raw->stops(), content);
+      }
+      else {
+        auto raw64 = dynamic_cast<const ListArray64*>(like);
+        return std::make_shared<ListArray64>(
+          none, noparams, raw64->starts(), raw64->stops(), content);
+      }
+    }
+
+    /// @brief Empty lists (of empty lists ...) with the structure of
+    /// `contents`, for broadcasting a union with no items.
+    const ContentPtr
+    copy_listtypes(const ContentPtrVec& contents) {
+      bool all_regular = true;
+      bool all_lists = true;
+      for (auto x : contents) {
+        RegularArray* raw = dynamic_cast<RegularArray*>(x.get());
+        RegularArray* first =
+          dynamic_cast<RegularArray*>(contents[0].get());
+        if (raw == nullptr  ||  first == nullptr  ||
+            raw->size() != first->size()) {
+          all_regular = false;
+        }
+        if (!is_list(x.get())) {
+          all_lists = false;
+        }
+      }
+      if (contents.empty()  ||  !all_lists) {
+        return std::make_shared<EmptyArray>(Identities::none(),
+                                            util::Parameters());
+      }
+      ContentPtrVec nextcontents;
+      for (auto x : contents) {
+        nextcontents.push_back(list_content(x.get()));
+      }
+      if (all_regular) {
+        return std::make_shared<RegularArray>(
+          Identities::none(),
+          util::Parameters(),
+          copy_listtypes(nextcontents),
+          dynamic_cast<RegularArray*>(contents[0].get())->size(),
+          0);
+      }
+      else {
+        return std::make_shared<ListOffsetArray64>(
+          Identities::none(),
+          util::Parameters(),
+          Index64(0),
+          copy_listtypes(nextcontents));
+      }
+    }
+
+    const std::string
+    sorted_keys(const std::vector<std::string>& keys) {
+      std::vector<std::string> sorted(keys);
+      std::sort(sorted.begin(), sorted.end());
+      std::stringstream out;
+      for (size_t i = 0;  i < sorted.size();  i++) {
+        out << (i == 0 ? "" : ", ") << sorted[i];
+      }
+      return out.str();
+    }
+
+    ////////// the recursion
+
+    const ContentPtrVec
+    apply(const ContentPtrVec& original,
+          BroadcastFunction& function,
+          const BroadcastOptions& options,
+          int64_t depth) {
+      ContentPtrVec inputs;
+      bool anylist = false;
+      for (auto x : original) {
+        ContentPtr y = x;
+        if (options.numpy_to_regular  &&
+            dynamic_cast<NumpyArray*>(y.get()) != nullptr) {
+          y = dynamic_cast<NumpyArray*>(y.get())->toRegularArray();
+        }
+        if (options.regular_to_jagged  &&
+            dynamic_cast<RegularArray*>(y.get()) != nullptr) {
+          y = dynamic_cast<RegularArray*>(y.get())->toListOffsetArray64(false);
+        }
+        if (y.get() != nullptr  &&  is_list(y.get())) {
+          anylist = true;
+        }
+        inputs.push_back(y);
+      }
+
+      // handle implicit right-broadcasting (i.e. NumPy-like)
+      if (options.right_broadcast  &&  anylist) {
+        int64_t maxdepth = 0;
+        bool all_regular = true;
+        for (auto x : inputs) {
+          if (x.get() != nullptr) {
+            maxdepth = std::max(maxdepth, x.get()->purelist_depth());
+            if (!x.get()->purelist_isregular()) {
+              all_regular = false;
+            }
+          }
+        }
+        if (maxdepth > 0  &&  all_regular) {
+          ContentPtrVec nextinputs;
+          bool changed = false;
+          for (auto x : inputs) {
+            ContentPtr obj = x;
+            if (obj.get() != nullptr) {
+              while (obj.get()->purelist_depth() < maxdepth) {
+                obj = std::make_shared<RegularArray>(Identities::none(),
+                                                     util::Parameters(),
+                                                     obj,
+                                                     1,
+                                                     obj.get()->length());
+                changed = true;
+              }
+            }
+            nextinputs.push_back(obj);
+          }
+          if (changed) {
+            return apply(nextinputs, function, options, depth);
+          }
+        }
+      }
+
+      // now all lengths must agree
+      ContentPtr first(nullptr);
+      for (auto x : inputs) {
+        if (x.get() == nullptr) {
+          continue;
+        }
+        if (first.get() == nullptr) {
+          first = x;
+        }
+        else if (x.get()->length() != first.get()->length()) {
+          throw std::invalid_argument(
+            std::string("cannot broadcast ") + first.get()->classname()
+            + std::string(" of length ") + std::to_string(first.get()->length())
+            + std::string(" with ") + x.get()->classname()
+            + std::string(" of length ") + std::to_string(x.get()->length())
+            + FILENAME(__LINE__));
+        }
+      }
+
+      ContentPtrVec outputs;
+      if (!options.leaves_only  ||  is_leaf(inputs)) {
+        if (function.apply(inputs, depth, outputs)) {
+          return outputs;
+        }
+      }
+
+      bool anyvirtual = false;
+      bool anyunknown = false;
+      bool anynumpy_ndim = false;
+      bool anyindexed = false;
+      bool anyunion = false;
+      bool anyoption = false;
+      bool anyrecord = false;
+      bool allregular = true;
+      for (auto x : inputs) {
+        Content* raw = x.get();
+        if (raw == nullptr) {
+          continue;
+        }
+        anyvirtual = anyvirtual  ||  dynamic_cast<VirtualArray*>(raw);
+        anyunknown = anyunknown  ||  dynamic_cast<EmptyArray*>(raw);
+        if (NumpyArray* rawnumpy = dynamic_cast<NumpyArray*>(raw)) {
+          anynumpy_ndim = anynumpy_ndim  ||  rawnumpy->ndim() > 1;
+        }
+        anyindexed = anyindexed  ||  is_indexed(raw);
+        anyunion = anyunion  ||  is_union(raw);
+        anyoption = anyoption  ||  is_option(raw);
+        anyrecord = anyrecord  ||  dynamic_cast<RecordArray*>(raw);
+        if (is_list(raw)  &&  dynamic_cast<RegularArray*>(raw) == nullptr) {
+          allregular = false;
+        }
+      }
+
+      // the rest of this is one switch statement
+      if (anyvirtual) {
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          if (VirtualArray* raw = dynamic_cast<VirtualArray*>(x.get())) {
+            nextinputs.push_back(raw->array());
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+        return apply(nextinputs, function, options, depth);
+      }
+
+      else if (anyunknown) {
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          if (dynamic_cast<EmptyArray*>(x.get()) != nullptr) {
+            nextinputs.push_back(EmptyArray(Identities::none(),
+                                            util::Parameters())
+                                   .toNumpyArray("?", 1, util::dtype::boolean));
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+        return apply(nextinputs, function, options, depth);
+      }
+
+      else if (anynumpy_ndim) {
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          NumpyArray* raw = dynamic_cast<NumpyArray*>(x.get());
+          if (raw != nullptr  &&  raw->ndim() > 1) {
+            nextinputs.push_back(raw->toRegularArray());
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+        return apply(nextinputs, function, options, depth);
+      }
+
+      else if (anyindexed) {
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          if (x.get() != nullptr  &&  is_indexed(x.get())) {
+            nextinputs.push_back(indexed_project(x.get()));
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+        return apply(nextinputs, function, options, depth);
+      }
+
+      else if (anyunion) {
+        // the combination of tags of each item, numbered in sorted order
+        std::vector<Index8> tagslist;
+        int64_t length = -1;
+        for (auto x : inputs) {
+          if (x.get() != nullptr  &&  is_union(x.get())) {
+            tagslist.push_back(union_tags(x.get()));
+            if (length == -1) {
+              length = tagslist.back().length();
+            }
+            else if (length != tagslist.back().length()) {
+              throw std::invalid_argument(
+                std::string("cannot broadcast UnionArray of length ")
+                + std::to_string(length)
+                + std::string(" with UnionArray of length ")
+                + std::to_string(tagslist.back().length())
+                + FILENAME(__LINE__));
+            }
+          }
+        }
+        std::vector<std::vector<int8_t>> combos((size_t)length);
+        std::set<std::vector<int8_t>> unique;
+        for (int64_t i = 0;  i < length;  i++) {
+          for (auto tags : tagslist) {
+            combos[(size_t)i].push_back(tags.data()[i]);
+          }
+          unique.insert(combos[(size_t)i]);
+        }
+        std::map<std::vector<int8_t>, int64_t> combo_tag;
+        for (auto combo : unique) {
+          int64_t tag = (int64_t)combo_tag.size();
+          combo_tag[combo] = tag;
+        }
+
+        Index8 tags(length);
+        Index64 index(length);
+        std::vector<std::vector<int64_t>> carries(unique.size());
+        for (int64_t i = 0;  i < length;  i++) {
+          int64_t tag = combo_tag[combos[(size_t)i]];
+          tags.data()[i] = (int8_t)tag;
+          index.data()[i] = (int64_t)carries[(size_t)tag].size();
+          carries[(size_t)tag].push_back(i);
+        }
+
+        std::vector<ContentPtrVec> outcontents;
+        for (auto combo : unique) {
+          std::vector<int64_t>& positions = carries[(size_t)combo_tag[combo]];
+          Index64 carry((int64_t)positions.size());
+          std::copy(positions.begin(), positions.end(), carry.data());
+          ContentPtrVec nextinputs;
+          size_t i = 0;
+          for (auto x : inputs) {
+            if (x.get() != nullptr  &&  is_union(x.get())) {
+              ContentPtr selected = x.get()->carry(carry, false);
+              nextinputs.push_back(union_project(selected.get(), combo[i]));
+              i++;
+            }
+            else if (x.get() != nullptr) {
+              nextinputs.push_back(x.get()->carry(carry, false));
+            }
+            else {
+              nextinputs.push_back(x);
+            }
+          }
+          outcontents.push_back(apply(nextinputs, function, options, depth));
+          if (outcontents.size() > 1  &&
+              outcontents.back().size() != outcontents[0].size()) {
+            throw std::runtime_error(
+              std::string("broadcast_and_apply: the function returned "
+                          "different numbers of outputs")
+              + FILENAME(__LINE__));
+          }
+        }
+
+        if (outcontents.empty()) {
+          ContentPtrVec nextinputs;
+          for (auto x : inputs) {
+            if (x.get() != nullptr  &&  is_union(x.get())) {
+              nextinputs.push_back(copy_listtypes(union_contents(x.get())));
+            }
+            else if (x.get() != nullptr) {
+              nextinputs.push_back(x.get()->getitem_range_nowrap(0, 0));
+            }
+            else {
+              nextinputs.push_back(x);
+            }
+          }
+          return apply(nextinputs, function, options, depth);
+        }
+
+        for (size_t j = 0;  j < outcontents[0].size();  j++) {
+          ContentPtrVec contents;
+          for (auto x : outcontents) {
+            contents.push_back(x[j]);
+          }
+          UnionArray8_64 out(Identities::none(),
+                             util::Parameters(),
+                             tags,
+                             index,
+                             contents);
+          outputs.push_back(out.simplify_uniontype(true, false));
+        }
+        return outputs;
+      }
+
+      else if (anyoption) {
+        Index8 mask(first.get()->length());
+        std::memset(mask.data(), 0, (size_t)mask.length());
+        bool anynonoption = false;
+        for (auto x : inputs) {
+          if (x.get() != nullptr  &&  is_option(x.get())) {
+            Index8 m = option_bytemask(x.get());
+            for (int64_t i = 0;  i < mask.length();  i++) {
+              mask.data()[i] |= (m.data()[i] != 0);
+            }
+          }
+          else if (x.get() != nullptr) {
+            anynonoption = true;
+          }
+        }
+
+        int64_t length = mask.length();
+        Index64 index(length);
+        Index64 nextindex(anynonoption ? length : 0);
+        int64_t k = 0;
+        for (int64_t i = 0;  i < length;  i++) {
+          index.data()[i] = mask.data()[i] ? -1 : k++;
+          if (anynonoption) {
+            nextindex.data()[i] = mask.data()[i] ? -1 : i;
+          }
+        }
+
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          if (x.get() != nullptr  &&  is_option(x.get())) {
+            nextinputs.push_back(option_project(x.get(), mask));
+          }
+          else if (x.get() != nullptr) {
+            IndexedOptionArray64 masked(Identities::none(),
+                                        util::Parameters(),
+                                        nextindex,
+                                        x);
+            nextinputs.push_back(masked.project(mask));
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+
+        ContentPtrVec outcontent = apply(nextinputs, function, options, depth);
+        for (auto x : outcontent) {
+          IndexedOptionArray64 out(Identities::none(),
+                                   util::Parameters(),
+                                   index,
+                                   x);
+          outputs.push_back(out.simplify_optiontype());
+        }
+        return outputs;
+      }
+
+      else if (anylist  &&  allregular) {
+        int64_t maxsize = 0;
+        for (auto x : inputs) {
+          if (RegularArray* raw = dynamic_cast<RegularArray*>(x.get())) {
+            maxsize = std::max(maxsize, raw->size());
+          }
+        }
+        ContentPtrVec nextinputs;
+        int64_t maxlen = 0;
+        for (auto x : inputs) {
+          ContentPtr next = x;
+          if (RegularArray* raw = dynamic_cast<RegularArray*>(x.get())) {
+            int64_t len = raw->length();
+            ContentPtr content = raw->content().get()->getitem_range_nowrap(
+              0, len*raw->size());
+            if (maxsize > 1  &&  raw->size() == 1) {
+              Index64 tmpindex(len*maxsize);
+              for (int64_t i = 0;  i < len;  i++) {
+                for (int64_t j = 0;  j < maxsize;  j++) {
+                  tmpindex.data()[i*maxsize + j] = i;
+                }
+              }
+              next = IndexedArray64(Identities::none(),
+                                    util::Parameters(),
+                                    tmpindex,
+                                    content).project();
+            }
+            else if (raw->size() == maxsize) {
+              next = content;
+            }
+            else {
+              throw std::invalid_argument(
+                std::string("cannot broadcast RegularArray of size ")
+                + std::to_string(raw->size())
+                + std::string(" with RegularArray of size ")
+                + std::to_string(maxsize) + FILENAME(__LINE__));
+            }
+          }
+          if (next.get() != nullptr) {
+            maxlen = std::max(maxlen, next.get()->length());
+          }
+          nextinputs.push_back(next);
+        }
+
+        ContentPtrVec outcontent = apply(nextinputs,
+                                         function,
+                                         options,
+                                         depth + 1);
+        for (auto x : outcontent) {
+          outputs.push_back(std::make_shared<RegularArray>(Identities::none(),
+                                                           util::Parameters(),
+                                                           x,
+                                                           maxsize,
+                                                           maxlen));
+        }
+        return outputs;
+      }
+
+      else if (anylist  &&  !all_same_offsets(inputs)) {
+        std::vector<bool> custom;
+        for (auto x : inputs) {
+          custom.push_back(x.get() != nullptr  &&
+                           function.has_custom_broadcast(x));
+        }
+
+        // the offsets come from a list without custom broadcasting, if any
+        const Content* firstlist = nullptr;
+        bool secondround = false;
+        for (size_t i = 0;  i < inputs.size();  i++) {
+          Content* x = inputs[i].get();
+          if (x != nullptr  &&  is_list(x)  &&
+              dynamic_cast<RegularArray*>(x) == nullptr  &&  !custom[i]) {
+            firstlist = x;
+            break;
+          }
+        }
+        if (firstlist == nullptr) {
+          secondround = true;
+          for (auto x : inputs) {
+            if (x.get() != nullptr  &&  is_list(x.get())  &&
+                dynamic_cast<RegularArray*>(x.get()) == nullptr) {
+              firstlist = x.get();
+              break;
+            }
+          }
+        }
+        Index64 offsets = list_compact_offsets64(firstlist);
+
+        ContentPtrVec nextinputs;
+        for (size_t i = 0;  i < inputs.size();  i++) {
+          const ContentPtr& x = inputs[i];
+          if (custom[i]  &&  !secondround) {
+            nextinputs.push_back(function.custom_broadcast(x, offsets));
+          }
+          else if (x.get() != nullptr  &&  is_list(x.get())) {
+            nextinputs.push_back(list_broadcast_tooffsets64(x.get(), offsets));
+          }
+          // handle implicit left-broadcasting (unlike NumPy)
+          else if (options.left_broadcast  &&  x.get() != nullptr) {
+            RegularArray regular(Identities::none(),
+                                 util::Parameters(),
+                                 x,
+                                 1,
+                                 x.get()->length());
+            nextinputs.push_back(list_broadcast_tooffsets64(&regular,
+                                                            offsets));
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+
+        ContentPtrVec outcontent = apply(nextinputs,
+                                         function,
+                                         options,
+                                         depth + 1);
+        for (auto x : outcontent) {
+          outputs.push_back(std::make_shared<ListOffsetArray64>(
+            Identities::none(), util::Parameters(), offsets, x));
+        }
+        return outputs;
+      }
+
+      else if (anylist) {
+        const Content* lastoffsets = nullptr;
+        const Content* laststarts = nullptr;
+        ContentPtrVec nextinputs;
+        for (auto x : inputs) {
+          if (x.get() != nullptr  &&  is_listoffset(x.get())) {
+            lastoffsets = x.get();
+            nextinputs.push_back(same_offsets_content(x.get()));
+          }
+          else if (x.get() != nullptr  &&  is_listarray(x.get())) {
+            laststarts = x.get();
+            nextinputs.push_back(same_offsets_content(x.get()));
+          }
+          else {
+            nextinputs.push_back(x);
+          }
+        }
+
+        ContentPtrVec outcontent = apply(nextinputs,
+                                         function,
+                                         options,
+                                         depth + 1);
+        const Content* like = (lastoffsets != nullptr ? lastoffsets
+                                                      : laststarts);
+        for (auto x : outcontent) {
+          outputs.push_back(same_offsets_list(like, x));
+        }
+        return outputs;
+      }
+
+      else if (anyrecord) {
+        if (!options.allow_records) {
+          throw std::invalid_argument(
+            std::string("cannot broadcast records in this type of operation")
+            + FILENAME(__LINE__));
+        }
+
+        std::shared_ptr<std::vector<std::string>> keys(nullptr);
+        int64_t length = -1;
+        bool istuple = true;
+        for (auto x : inputs) {
+          if (RecordArray* raw = dynamic_cast<RecordArray*>(x.get())) {
+            std::vector<std::string> mykeys = raw->keys();
+            if (keys.get() == nullptr) {
+              keys = std::make_shared<std::vector<std::string>>(mykeys);
+            }
+            else if (std::set<std::string>(keys.get()->begin(),
+                                           keys.get()->end()) !=
+                     std::set<std::string>(mykeys.begin(), mykeys.end())) {
+              throw std::invalid_argument(
+                std::string("cannot broadcast records because keys don't "
+                            "match:\n    ")
+                + sorted_keys(*keys.get()) + std::string("\n    ")
+                + sorted_keys(mykeys) + FILENAME(__LINE__));
+            }
+            if (length == -1) {
+              length = raw->length();
+            }
+            else if (length != raw->length()) {
+              throw std::invalid_argument(
+                std::string("cannot broadcast RecordArray of length ")
+                + std::to_string(length)
+                + std::string(" with RecordArray of length ")
+                + std::to_string(raw->length()) + FILENAME(__LINE__));
+            }
+            if (!raw->istuple()) {
+              istuple = false;
+            }
+          }
+        }
+
+        std::vector<ContentPtrVec> outcontents;
+        for (auto key : *keys.get()) {
+          ContentPtrVec nextinputs;
+          for (auto x : inputs) {
+            if (RecordArray* raw = dynamic_cast<RecordArray*>(x.get())) {
+              nextinputs.push_back(raw->getitem_field(key));
+            }
+            else {
+              nextinputs.push_back(x);
+            }
+          }
+          outcontents.push_back(apply(nextinputs, function, options, depth));
+        }
+
+        util::RecordLookupPtr recordlookup(nullptr);
+        if (!istuple) {
+          recordlookup = std::make_shared<util::RecordLookup>(*keys.get());
+        }
+        size_t numoutputs = (outcontents.empty() ? 0 : outcontents[0].size());
+        for (size_t j = 0;  j < numoutputs;  j++) {
+          ContentPtrVec contents;
+          for (auto x : outcontents) {
+            contents.push_back(x[j]);
+          }
+          outputs.push_back(std::make_shared<RecordArray>(Identities::none(),
+                                                          util::Parameters(),
+                                                          contents,
+                                                          recordlookup,
+                                                          length));
+        }
+        return outputs;
+      }
+
+      else {
+        std::stringstream names;
+        for (size_t i = 0;  i < inputs.size();  i++) {
+          names << (i == 0 ? "" : ", ")
+                << (inputs[i].get() == nullptr
+                      ? std::string("non-array")
+                      : inputs[i].get()->classname());
+        }
+        throw std::invalid_argument(
+          std::string("cannot broadcast: ") + names.str() + FILENAME(__LINE__));
+      }
+    }
+  }
+
+  const ContentPtrVec
+  broadcast_and_apply(const ContentPtrVec& inputs,
+                      BroadcastFunction& function,
+                      const BroadcastOptions& options,
+                      int64_t depth) {
+    return apply(inputs, function, options, depth);
+  }
+}
@@ -0,0 +1,227 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/CombinationsIterator.cpp", line)
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "awkward/kernel-dispatch.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/VirtualArray.h"
+
+#include "awkward/CombinationsIterator.h"
+
+namespace awkward {
+  namespace {
+    template <typename T>
+    bool
+    compact_as(const Content* raw, ContentPtr& out) {
+      if (const T* rawlist = dynamic_cast<const T*>(raw)) {
+        out = rawlist->toListOffsetArray64(true);
+        return true;
+      }
+      return false;
+    }
+
+    /// @brief Converts any list type into a ListOffsetArray64 starting at
+    /// zero, so that the carries index its content directly.
+    const ContentPtr
+    compact_lists(const ContentPtr& array, int64_t n) {
+      if (n < 1) {
+        throw std::invalid_argument(
+          std::string("in combinations, 'n' must be at least 1")
+          + FILENAME(__LINE__));
+      }
+      ContentPtr content = array;
+      if (VirtualArray* raw = dynamic_cast<VirtualArray*>(content.get())) {
+        content = raw->array();
+      }
+      if (content.get()->parameter_equals("__array__", "\"string\"")  ||
+          content.get()->parameter_equals("__array__", "\"bytestring\"")) {
+        throw std::invalid_argument(
+          std::string("ak.combinations does not compute combinations of the "
+                      "characters of a string; please split it into lists")
+          + FILENAME(__LINE__));
+      }
+      ContentPtr out(nullptr);
+      if (compact_as<ListOffsetArray64>(content.get(), out)  ||
+          compact_as<ListOffsetArray32>(content.get(), out)  ||
+          compact_as<ListOffsetArrayU32>(content.get(), out)  ||
+          compact_as<ListArray64>(content.get(), out)  ||
+          compact_as<ListArray32>(content.get(), out)  ||
+          compact_as<ListArrayU32>(content.get(), out)  ||
+          compact_as<RegularArray>(content.get(), out)) {
+        return out;
+      }
+      throw std::invalid_argument(
+        std::string("combinations can only be streamed from lists, not ")
+        + content.get()->classname() + FILENAME(__LINE__));
+    }
+
+    const Index64
+    offsets_of(const ContentPtr& compact) {
+      return dynamic_cast<ListOffsetArray64*>(compact.get())->offsets();
+    }
+  }
+
+  CombinationsIterator::CombinationsIterator(
+    const ContentPtr& array,
+    int64_t n,
+    bool replacement,
+    const util::RecordLookupPtr& recordlookup,
+    const util::Parameters& parameters,
+    int64_t chunksize)
+      : array_(compact_lists(array, n))
+      , content_(dynamic_cast<ListOffsetArray64*>(array_.get())->content())
+      , starts_(util::make_starts(offsets_of(array_)))
+      , stops_(util::make_stops(offsets_of(array_)))
+      , offsets_(starts_.length() + 1)
+      , n_(n)
+      , replacement_(replacement)
+      , recordlookup_(recordlookup)
+      , parameters_(parameters)
+      , chunksize_(chunksize)
+      , length_(0)
+      , at_(0)
+      , position_(0)
+      , index_(n) {
+    if (chunksize < 1) {
+      throw std::invalid_argument(
+        std::string("in combinations, 'chunksize' must be at least 1")
+        + FILENAME(__LINE__));
+    }
+    if (recordlookup.get() != nullptr  &&
+        (int64_t)recordlookup.get()->size() != n) {
+      throw std::invalid_argument(
+        std::string("if provided, the length of 'keys' must be 'n'")
+        + FILENAME(__LINE__));
+    }
+    struct Error err = kernel::ListArray_combinations_length_64<int64_t>(
+      kernel::lib::cpu,   // DERIVE
+      &length_,
+      offsets_.data(),
+      n_,
+      replacement_,
+      starts_.data(),
+      stops_.data(),
+      starts_.length());
+    util::handle_error(err, "CombinationsIterator", nullptr);
+    index_.data()[0] = -1;
+  }
+
+  const ContentPtr
+  CombinationsIterator::array() const {
+    return array_;
+  }
+
+  int64_t
+  CombinationsIterator::n() const {
+    return n_;
+  }
+
+  bool
+  CombinationsIterator::replacement() const {
+    return replacement_;
+  }
+
+  int64_t
+  CombinationsIterator::chunksize() const {
+    return chunksize_;
+  }
+
+  const Index64
+  CombinationsIterator::offsets() const {
+    return offsets_;
+  }
+
+  int64_t
+  CombinationsIterator::length() const {
+    return length_;
+  }
+
+  int64_t
+  CombinationsIterator::at() const {
+    return at_;
+  }
+
+  bool
+  CombinationsIterator::isdone() const {
+    return at_ >= length_;
+  }
+
+  const std::pair<Index64, ContentPtr>
+  CombinationsIterator::next() {
+    if (isdone()) {
+      throw std::invalid_argument(
+        std::string("CombinationsIterator has no more combinations")
+        + FILENAME(__LINE__));
+    }
+    int64_t maxlength = std::min(chunksize_, length_ - at_);
+
+    // The carries are allocated anew for each chunk: the RecordArray that
+    // is returned keeps them alive only as long as the consumer needs it.
+    std::vector<std::shared_ptr<int64_t>> tocarry;
+    std::vector<int64_t*> tocarryraw;
+    for (int64_t j = 0;  j < n_;  j++) {
+      std::shared_ptr<int64_t> ptr =
+          kernel::malloc<int64_t>(kernel::lib::cpu,   // DERIVE
+                                  maxlength*(int64_t)sizeof(int64_t));
+      tocarry.push_back(ptr);
+      tocarryraw.push_back(ptr.get());
+    }
+    Index64 parents(maxlength);
+    int64_t tolength;
+    struct Error err = kernel::ListArray_combinations_chunk_64(
+      kernel::lib::cpu,   // DERIVE
+      tocarryraw.data(),
+      parents.data(),
+      &tolength,
+      index_.data(),
+      &position_,
+      n_,
+      replacement_,
+      starts_.data(),
+      stops_.data(),
+      starts_.length(),
+      maxlength);
+    util::handle_error(err, "CombinationsIterator", nullptr);
+    at_ += tolength;
+
+    ContentPtrVec contents;
+    for (auto ptr : tocarry) {
+      contents.push_back(content_.get()->carry(
+        Index64(ptr, 0, tolength, kernel::lib::cpu),   // DERIVE
+      true));
+    }
+    ContentPtr recordarray = std::make_shared<RecordArray>(
+      Identities::none(), parameters_, contents, recordlookup_, tolength);
+    return std::pair<Index64, ContentPtr>(
+      Index64(parents.ptr(), 0, tolength, kernel::lib::cpu),   // DERIVE
+      recordarray);
+  }
+
+  const std::string
+  CombinationsIterator::tostring_part(const std::string& indent,
+                                      const std::string& pre,
+                                      const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<CombinationsIterator n=\"" << n_
+        << "\" replacement=\"" << (replacement_ ? "true" : "false")
+        << "\" chunksize=\"" << chunksize_ << "\" at=\"" << at_
+        << "\" length=\"" << length_ << "\">\n";
+    out << array_.get()->tostring_part(
+             indent + std::string("    "), "", "\n");
+    out << indent << "</CombinationsIterator>" << post;
+    return out.str();
+  }
+
+  const std::string
+  CombinationsIterator::tostring() const {
+    return tostring_part("", "", "");
+  }
+}
@@ -1023,6 +1023,22 @@ namespace awkward {
       }
     }
 
+    if (const NumpyArray* raw = dynamic_cast<const NumpyArray*>(this)) {
+      if (raw->ndim() == 1  &&
+          raw->iscontiguous()  &&
+          !reducer.returns_positions()) {
+        // A flat array is a single contiguous group: no parents needed.
+        Index64 offsets(2);
+        offsets.setitem_at_nowrap(0, 0);
+        offsets.setitem_at_nowrap(1, length());
+        ContentPtr next = raw->reduce_offsets_next(reducer,
+                                                   offsets,
+                                                   mask,
+                                                   keepdims);
+        return next.get()->getitem_at_nowrap(0);
+      }
+    }
+
     Index64 starts(1);
     starts.setitem_at_nowrap(0, 0);
 
@@ -0,0 +1,367 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/FusedElementwise.cpp", line)
+
+#include <cstring>
+#include <stdexcept>
+
+#include "awkward/kernel-dispatch.h"
+#include "awkward/kernel-fused.h"
+#include "awkward/array/ListArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/VirtualArray.h"
+
+#include "awkward/FusedElementwise.h"
+
+namespace awkward {
+  namespace {
+    /// @brief Number of items evaluated by each pass of the program: its
+    /// stack of intermediate values is this many float64s per level.
+    const int64_t kFusedBlockSize = 1024;
+
+    struct FusedOperation {
+      const char* name;
+      int64_t opcode;
+    };
+
+    const FusedOperation kFusedOperations[] = {
+      {"negative", FUSED_NEGATIVE},
+      {"positive", FUSED_POSITIVE},
+      {"absolute", FUSED_ABSOLUTE},
+      {"square", FUSED_SQUARE},
+      {"sqrt", FUSED_SQRT},
+      {"cbrt", FUSED_CBRT},
+      {"exp", FUSED_EXP},
+      {"expm1", FUSED_EXPM1},
+      {"log", FUSED_LOG},
+      {"log1p", FUSED_LOG1P},
+      {"log10", FUSED_LOG10},
+      {"sin", FUSED_SIN},
+      {"cos", FUSED_COS},
+      {"tan", FUSED_TAN},
+      {"arcsin", FUSED_ARCSIN},
+      {"arccos", FUSED_ARCCOS},
+      {"arctan", FUSED_ARCTAN},
+      {"sinh", FUSED_SINH},
+      {"cosh", FUSED_COSH},
+      {"tanh", FUSED_TANH},
+      {"add", FUSED_ADD},
+      {"subtract", FUSED_SUBTRACT},
+      {"multiply", FUSED_MULTIPLY},
+      {"true_divide", FUSED_DIVIDE},
+      {"divide", FUSED_DIVIDE},
+      {"power", FUSED_POWER},
+      {"arctan2", FUSED_ARCTAN2},
+      {"hypot", FUSED_HYPOT},
+      {"maximum", FUSED_MAXIMUM},
+      {"minimum", FUSED_MINIMUM}
+    };
+
+    /// @brief One list dimension of a fusable input.
+    struct FusedLevel {
+      /// @brief If `true`, this dimension is a RegularArray of #size.
+      bool regular;
+      int64_t size;
+      /// @brief Offsets of the lists, starting at zero.
+      Index64 offsets;
+    };
+
+    /// @brief Splits `input` into its list dimensions and its flat float64
+    /// numbers, or returns `false` if it can't be fused.
+    bool
+    fused_structure(const ContentPtr& input,
+                    std::vector<FusedLevel>& levels,
+                    int64_t& length,
+                    ContentPtr& numbers) {
+      ContentPtr x = input;
+      length = input.get()->length();
+      while (true) {
+        if (VirtualArray* raw = dynamic_cast<VirtualArray*>(x.get())) {
+          x = raw->array();
+        }
+        if (!x.get()->parameters().empty()) {
+          return false;
+        }
+        // the contents are trimmed to what the lists use, so that the
+        // levels below can be compared with those of the other inputs
+        if (RegularArray* raw = dynamic_cast<RegularArray*>(x.get())) {
+          levels.push_back({ true, raw->size(), raw->compact_offsets64(true) });
+          x = raw->content().get()->getitem_range_nowrap(
+            0, raw->size()*raw->length());
+        }
+        else if (ListOffsetArray64* raw =
+                 dynamic_cast<ListOffsetArray64*>(x.get())) {
+          ContentPtr compact = raw->toListOffsetArray64(true);
+          ListOffsetArray64* rawcompact =
+            dynamic_cast<ListOffsetArray64*>(compact.get());
+          const Index64 offsets = rawcompact->offsets();
+          levels.push_back({ false, 0, offsets });
+          x = rawcompact->content().get()->getitem_range_nowrap(
+            0, offsets.getitem_at_nowrap(offsets.length() - 1));
+        }
+        else if (ListOffsetArray32* raw =
+                 dynamic_cast<ListOffsetArray32*>(x.get())) {
+          x = raw->toListOffsetArray64(true);
+          continue;
+        }
+        else if (ListOffsetArrayU32* raw =
+                 dynamic_cast<ListOffsetArrayU32*>(x.get())) {
+          x = raw->toListOffsetArray64(true);
+          continue;
+        }
+        else if (ListArray64* raw = dynamic_cast<ListArray64*>(x.get())) {
+          x = raw->toListOffsetArray64(true);
+          continue;
+        }
+        else if (ListArray32* raw = dynamic_cast<ListArray32*>(x.get())) {
+          x = raw->toListOffsetArray64(true);
+          continue;
+        }
+        else if (ListArrayU32* raw = dynamic_cast<ListArrayU32*>(x.get())) {
+          x = raw->toListOffsetArray64(true);
+          continue;
+        }
+        else if (NumpyArray* raw = dynamic_cast<NumpyArray*>(x.get())) {
+          if (raw->ndim() != 1) {
+            x = raw->toRegularArray();
+            continue;
+          }
+          if (raw->ptr_lib() != kernel::lib::cpu) {
+            return false;
+          }
+          switch (raw->dtype()) {
+            case util::dtype::float64:
+              numbers = std::make_shared<NumpyArray>(raw->contiguous());
+              return true;
+            case util::dtype::boolean:
+            case util::dtype::int8:
+            case util::dtype::int16:
+            case util::dtype::int32:
+            case util::dtype::int64:
+            case util::dtype::uint8:
+            case util::dtype::uint16:
+            case util::dtype::uint32:
+            case util::dtype::uint64:
+            case util::dtype::float32:
+              numbers = raw->numbers_to_type("float64");
+              return true;
+            default:
+              return false;
+          }
+        }
+        else {
+          return false;
+        }
+      }
+    }
+
+    bool
+    same_offsets(const Index64& one, const Index64& two) {
+      if (one.length() != two.length()) {
+        return false;
+      }
+      if (one.ptr().get() == two.ptr().get()  &&
+          one.offset() == two.offset()) {
+        return true;
+      }
+      return std::memcmp(one.data(),
+                         two.data(),
+                         (size_t)one.length()*sizeof(int64_t)) == 0;
+    }
+
+    /// @brief Checks the program and returns the deepest its stack gets.
+    int64_t
+    fused_stackdepth(const std::vector<int64_t>& program,
+                     int64_t numinputs,
+                     int64_t numconstants) {
+      if (program.size() % 2 != 0) {
+        throw std::invalid_argument(
+          std::string("fused program must consist of (opcode, argument) pairs")
+          + FILENAME(__LINE__));
+      }
+      int64_t depth = 0;
+      int64_t maxdepth = 0;
+      for (size_t pc = 0;  pc < program.size();  pc += 2) {
+        int64_t opcode = program[pc];
+        int64_t argument = program[pc + 1];
+        if (opcode == FUSED_INPUT  ||  opcode == FUSED_CONSTANT) {
+          int64_t limit = (opcode == FUSED_INPUT ? numinputs : numconstants);
+          if (argument < 0  ||  argument >= limit) {
+            throw std::invalid_argument(
+              std::string("fused program refers to ")
+              + (opcode == FUSED_INPUT ? "input " : "constant ")
+              + std::to_string(argument) + std::string(", but there are only ")
+              + std::to_string(limit) + FILENAME(__LINE__));
+          }
+          depth++;
+        }
+        else {
+          bool known = false;
+          for (auto operation : kFusedOperations) {
+            known = known  ||  operation.opcode == opcode;
+          }
+          if (!known) {
+            throw std::invalid_argument(
+              std::string("unrecognized opcode in fused program: ")
+              + std::to_string(opcode) + FILENAME(__LINE__));
+          }
+          if (opcode >= FUSED_ADD) {
+            depth--;
+          }
+        }
+        if (depth < 1) {
+          throw std::invalid_argument(
+            std::string("fused program has too few operands for opcode ")
+            + std::to_string(opcode) + FILENAME(__LINE__));
+        }
+        if (depth > maxdepth) {
+          maxdepth = depth;
+        }
+      }
+      if (depth != 1) {
+        throw std::invalid_argument(
+          std::string("fused program must compute exactly one result, not ")
+          + std::to_string(depth) + FILENAME(__LINE__));
+      }
+      return maxdepth;
+    }
+  }
+
+  int64_t
+  fused_opcode(const std::string& name) {
+    if (name == std::string("input")) {
+      return FUSED_INPUT;
+    }
+    if (name == std::string("constant")) {
+      return FUSED_CONSTANT;
+    }
+    for (auto operation : kFusedOperations) {
+      if (name == std::string(operation.name)) {
+        return operation.opcode;
+      }
+    }
+    return -1;
+  }
+
+  const std::vector<std::string>
+  fused_operations() {
+    std::vector<std::string> out;
+    for (auto operation : kFusedOperations) {
+      out.push_back(std::string(operation.name));
+    }
+    return out;
+  }
+
+  const ContentPtr
+  fused_elementwise(const ContentPtrVec& inputs,
+                    const std::vector<int64_t>& program,
+                    const std::vector<double>& constants) {
+    int64_t stackdepth = fused_stackdepth(program,
+                                          (int64_t)inputs.size(),
+                                          (int64_t)constants.size());
+
+    if (inputs.empty()) {
+      throw std::invalid_argument(
+        std::string("fused program must have at least one input")
+        + FILENAME(__LINE__));
+    }
+
+    // the output has the structure of the first input
+    std::vector<FusedLevel> levels;
+    int64_t length;
+    std::vector<ContentPtr> numbers(inputs.size(), ContentPtr(nullptr));
+    if (!fused_structure(inputs[0], levels, length, numbers[0])) {
+      return ContentPtr(nullptr);
+    }
+    for (size_t i = 1;  i < inputs.size();  i++) {
+      std::vector<FusedLevel> otherlevels;
+      int64_t otherlength;
+      if (!fused_structure(inputs[i], otherlevels, otherlength, numbers[i])) {
+        return ContentPtr(nullptr);
+      }
+      if (otherlength != length  ||  otherlevels.size() != levels.size()) {
+        return ContentPtr(nullptr);
+      }
+      for (size_t j = 0;  j < levels.size();  j++) {
+        if (levels[j].regular  &&  otherlevels[j].regular  &&
+            levels[j].size == otherlevels[j].size) {
+          continue;
+        }
+        if (!same_offsets(levels[j].offsets, otherlevels[j].offsets)) {
+          return ContentPtr(nullptr);
+        }
+        levels[j].regular = false;
+      }
+    }
+
+    // the number of items at the bottom, which every input has (at least)
+    int64_t flatlength = length;
+    if (!levels.empty()) {
+      const Index64& offsets = levels.back().offsets;
+      flatlength = offsets.getitem_at_nowrap(offsets.length() - 1);
+    }
+    std::vector<const double*> fromptrs;
+    for (auto x : numbers) {
+      NumpyArray* raw = dynamic_cast<NumpyArray*>(x.get());
+      if (raw->length() < flatlength) {
+        throw std::invalid_argument(
+          std::string("len(content) < len(offsets) in fused elementwise input")
+          + FILENAME(__LINE__));
+      }
+      fromptrs.push_back(reinterpret_cast<const double*>(raw->data()));
+    }
+
+    std::shared_ptr<double> ptr = kernel::malloc<double>(
+      kernel::lib::cpu,   // DERIVE
+      flatlength*(int64_t)sizeof(double));
+    std::shared_ptr<double> stack = kernel::malloc<double>(
+      kernel::lib::cpu,   // DERIVE
+      stackdepth*kFusedBlockSize*(int64_t)sizeof(double));
+    struct Error err = kernel::NumpyArray_fused_elementwise_64(
+      kernel::lib::cpu,   // DERIVE
+      ptr.get(),
+      fromptrs.data(),
+      program.data(),
+      (int64_t)program.size() / 2,
+      constants.data(),
+      stack.get(),
+      stackdepth,
+      kFusedBlockSize,
+      flatlength);
+    util::handle_error(err, "fused_elementwise", nullptr);
+
+    std::vector<ssize_t> shape({ (ssize_t)flatlength });
+    std::vector<ssize_t> strides({ (ssize_t)sizeof(double) });
+    ContentPtr out = std::make_shared<NumpyArray>(
+      Identities::none(),
+      util::Parameters(),
+      ptr,
+      shape,
+      strides,
+      0,
+      sizeof(double),
+      util::dtype_to_format(util::dtype::float64),
+      util::dtype::float64,
+      kernel::lib::cpu);
+    for (int64_t j = (int64_t)levels.size() - 1;  j >= 0;  j--) {
+      const FusedLevel& level = levels[(size_t)j];
+      int64_t levellength = level.offsets.length() - 1;
+      if (level.regular) {
+        out = std::make_shared<RegularArray>(Identities::none(),
+                                             util::Parameters(),
+                                             out,
+                                             level.size,
+                                             levellength);
+      }
+      else {
+        out = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                  util::Parameters(),
+                                                  level.offsets,
+                                                  out);
+      }
+    }
+    return out;
+  }
+}
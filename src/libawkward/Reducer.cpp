@@ -17,6 +17,138 @@ namespace awkward {
     return false;
   }
 
+  const Index64
+  Reducer::offsets_to_parents(const Index64& offsets,
+                              int64_t outlength) const {
+    int64_t start = offsets.getitem_at_nowrap(0);
+    int64_t stop = offsets.getitem_at_nowrap(outlength);
+    Index64 parents(stop - start);
+    struct Error err = kernel::ListOffsetArray_reduce_local_nextparents_64(
+      kernel::lib::cpu,   // DERIVE
+      parents.data(),
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return parents;
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_bool(const bool* data,
+                              const Index64& offsets,
+                              int64_t outlength) const {
+    return apply_bool(data + offsets.getitem_at_nowrap(0),
+                      offsets_to_parents(offsets, outlength),
+                      outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_int8(const int8_t* data,
+                              const Index64& offsets,
+                              int64_t outlength) const {
+    return apply_int8(data + offsets.getitem_at_nowrap(0),
+                      offsets_to_parents(offsets, outlength),
+                      outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_uint8(const uint8_t* data,
+                               const Index64& offsets,
+                               int64_t outlength) const {
+    return apply_uint8(data + offsets.getitem_at_nowrap(0),
+                       offsets_to_parents(offsets, outlength),
+                       outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_int16(const int16_t* data,
+                               const Index64& offsets,
+                               int64_t outlength) const {
+    return apply_int16(data + offsets.getitem_at_nowrap(0),
+                       offsets_to_parents(offsets, outlength),
+                       outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_uint16(const uint16_t* data,
+                                const Index64& offsets,
+                                int64_t outlength) const {
+    return apply_uint16(data + offsets.getitem_at_nowrap(0),
+                        offsets_to_parents(offsets, outlength),
+                        outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_int32(const int32_t* data,
+                               const Index64& offsets,
+                               int64_t outlength) const {
+    return apply_int32(data + offsets.getitem_at_nowrap(0),
+                       offsets_to_parents(offsets, outlength),
+                       outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_uint32(const uint32_t* data,
+                                const Index64& offsets,
+                                int64_t outlength) const {
+    return apply_uint32(data + offsets.getitem_at_nowrap(0),
+                        offsets_to_parents(offsets, outlength),
+                        outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_int64(const int64_t* data,
+                               const Index64& offsets,
+                               int64_t outlength) const {
+    return apply_int64(data + offsets.getitem_at_nowrap(0),
+                       offsets_to_parents(offsets, outlength),
+                       outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_uint64(const uint64_t* data,
+                                const Index64& offsets,
+                                int64_t outlength) const {
+    return apply_uint64(data + offsets.getitem_at_nowrap(0),
+                        offsets_to_parents(offsets, outlength),
+                        outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_float32(const float* data,
+                                 const Index64& offsets,
+                                 int64_t outlength) const {
+    return apply_float32(data + offsets.getitem_at_nowrap(0),
+                         offsets_to_parents(offsets, outlength),
+                         outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_float64(const double* data,
+                                 const Index64& offsets,
+                                 int64_t outlength) const {
+    return apply_float64(data + offsets.getitem_at_nowrap(0),
+                         offsets_to_parents(offsets, outlength),
+                         outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_complex64(const std::complex<float>* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    return apply_complex64(data + offsets.getitem_at_nowrap(0),
+                           offsets_to_parents(offsets, outlength),
+                           outlength);
+  }
+
+  const std::shared_ptr<void>
+  Reducer::apply_offsets_complex128(const std::complex<double>* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_complex128(data + offsets.getitem_at_nowrap(0),
+                            offsets_to_parents(offsets, outlength),
+                            outlength);
+  }
+
   ////////// count
 
   const std::string
@@ -160,6 +292,131 @@ namespace awkward {
                       outlength);
   }
 
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_bool(const bool* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    // This is the only reducer that completely ignores the data.
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_count_offsets_64(
+      ptr_lib,
+      ptr.get(),
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_int8(const int8_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_uint8(const uint8_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_int16(const int16_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_uint16(const uint16_t* data,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_int32(const int32_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_uint32(const uint32_t* data,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_int64(const int64_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_uint64(const uint64_t* data,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_float32(const float* data,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_float64(const double* data,
+                                      const Index64& offsets,
+                                      int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_complex64(const std::complex<float>* data,
+                                        const Index64& offsets,
+                                        int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_offsets_complex128(const std::complex<double>* data,
+                                         const Index64& offsets,
+                                         int64_t outlength) const {
+    return apply_offsets_bool(reinterpret_cast<const bool*>(data),
+                              offsets,
+                              outlength);
+  }
+
   ////////// count nonzero
 
   const std::string
@@ -411,6 +668,193 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_bool(const bool* data,
+                                          const Index64& offsets,
+                                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<bool>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_int8(const int8_t* data,
+                                          const Index64& offsets,
+                                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_uint8(const uint8_t* data,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_int16(const int16_t* data,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_uint16(const uint16_t* data,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_int32(const int32_t* data,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_uint32(const uint32_t* data,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_int64(const int64_t* data,
+                                           const Index64& offsets,
+                                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<int64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_uint64(const uint64_t* data,
+                                            const Index64& offsets,
+                                            int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<uint64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_float32(const float* data,
+                                             const Index64& offsets,
+                                             int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<float>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_offsets_float64(const double* data,
+                                             const Index64& offsets,
+                                             int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_countnonzero_offsets_64<double>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
   ////////// sum (addition)
 
   const std::string
@@ -766,12 +1210,248 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// prod (multiplication)
-
-  const std::string
-  ReducerProd::name() const {
-    return "prod";
-  }
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_int8(const int8_t* data,
+                                 const Index64& offsets,
+                                 int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int32_t, int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int64_t, int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_uint8(const uint8_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint32_t, uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint64_t, uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_int16(const int16_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int32_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int64_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_uint16(const uint16_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint32_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint64_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_int32(const int32_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int32_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int64_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_uint32(const uint32_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint32_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint64_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_int64(const int64_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<int64_t, int64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_uint64(const uint64_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_sum_offsets_64<uint64_t, uint64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_float32(const float* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<float> ptr = kernel::malloc<float>(
+      ptr_lib, outlength*(int64_t)sizeof(float));
+    struct Error err = kernel::reduce_sum_offsets_64<float, float>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_offsets_float64(const double* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<double> ptr = kernel::malloc<double>(
+      ptr_lib, outlength*(int64_t)sizeof(double));
+    struct Error err = kernel::reduce_sum_offsets_64<double, double>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  ////////// prod (multiplication)
+
+  const std::string
+  ReducerProd::name() const {
+    return "prod";
+  }
 
   util::dtype
   ReducerProd::preferred_dtype() const {
@@ -1121,69 +1801,305 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// any (logical or)
-
-  const std::string
-  ReducerAny::name() const {
-    return "any";
-  }
-
-  util::dtype
-  ReducerAny::preferred_dtype() const {
-    return util::dtype::boolean;
-  }
-
-  util::dtype
-  ReducerAny::return_dtype(util::dtype given_dtype) const {
-    return util::dtype::boolean;
-  }
-
   const std::shared_ptr<void>
-  ReducerAny::apply_bool(const bool* data,
-                         const Index64& parents,
-                         int64_t outlength) const {
+  ReducerProd::apply_offsets_int8(const int8_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
-      ptr_lib, outlength*(int64_t)sizeof(bool));
-    struct Error err = kernel::reduce_sum_bool_64<bool>(
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*sizeof(int32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int32_t, int8_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int64_t, int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name()), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int8(const int8_t* data,
-                         const Index64& parents,
-                         int64_t outlength) const {
+  ReducerProd::apply_offsets_uint8(const uint8_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
-      ptr_lib, outlength*(int64_t)sizeof(bool));
-    struct Error err = kernel::reduce_sum_bool_64<int8_t>(
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint32_t, uint8_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint64_t, uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
       outlength);
+#endif
     util::handle_error(err, util::quote(name()), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint8(const uint8_t* data,
-                          const Index64& parents,
-                          int64_t outlength) const {
+  ReducerProd::apply_offsets_int16(const int16_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
-      ptr_lib, outlength*(int64_t)sizeof(bool));
-    struct Error err = kernel::reduce_sum_bool_64<uint8_t>(
-      ptr_lib,
-      ptr.get(),
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int32_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int64_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_uint16(const uint16_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint32_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint64_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_int32(const int32_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int32_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int64_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_uint32(const uint32_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint32_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#else
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint64_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+#endif
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_int64(const int64_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<int64_t, int64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_uint64(const uint64_t* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    struct Error err = kernel::reduce_prod_offsets_64<uint64_t, uint64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_float32(const float* data,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<float> ptr = kernel::malloc<float>(
+      ptr_lib, outlength*(int64_t)sizeof(float));
+    struct Error err = kernel::reduce_prod_offsets_64<float, float>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerProd::apply_offsets_float64(const double* data,
+                                     const Index64& offsets,
+                                     int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<double> ptr = kernel::malloc<double>(
+      ptr_lib, outlength*(int64_t)sizeof(double));
+    struct Error err = kernel::reduce_prod_offsets_64<double, double>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  ////////// any (logical or)
+
+  const std::string
+  ReducerAny::name() const {
+    return "any";
+  }
+
+  util::dtype
+  ReducerAny::preferred_dtype() const {
+    return util::dtype::boolean;
+  }
+
+  util::dtype
+  ReducerAny::return_dtype(util::dtype given_dtype) const {
+    return util::dtype::boolean;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_bool(const bool* data,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
+      ptr_lib, outlength*(int64_t)sizeof(bool));
+    struct Error err = kernel::reduce_sum_bool_64<bool>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_int8(const int8_t* data,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
+      ptr_lib, outlength*(int64_t)sizeof(bool));
+    struct Error err = kernel::reduce_sum_bool_64<int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerAny::apply_uint8(const uint8_t* data,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
+      ptr_lib, outlength*(int64_t)sizeof(bool));
+    struct Error err = kernel::reduce_sum_bool_64<uint8_t>(
+      ptr_lib,
+      ptr.get(),
       data,
       parents.data(),
       parents.length(),
@@ -1616,16 +2532,556 @@ namespace awkward {
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
-      outlength);
+      parents.data(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  ////////// min (minimum, in which infinity is the identity)
+
+  ReducerMin::ReducerMin(double initial_f64,
+                         uint64_t initial_u64,
+                         int64_t initial_i64)
+    : initial_f64_(initial_f64)
+    , initial_u64_(initial_u64)
+    , initial_i64_(initial_i64)
+    , has_initial_(true) { }
+
+  ReducerMin::ReducerMin()
+    : initial_f64_(0.0)
+    , initial_u64_((uint64_t)0)
+    , initial_i64_((int64_t)0)
+    , has_initial_(false) { }
+
+  const std::string
+  ReducerMin::name() const {
+    return "min";
+  }
+
+  util::dtype
+  ReducerMin::preferred_dtype() const {
+    return util::dtype::float64;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_bool(const bool* data,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
+      ptr_lib, outlength*(int64_t)sizeof(bool));
+    struct Error err = kernel::reduce_prod_bool_64<bool>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int8(const int8_t* data,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int8_t> ptr = kernel::malloc<int8_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int8_t));
+    int8_t initial = std::numeric_limits<int8_t>::max();
+    if (has_initial_) {
+      initial = (int8_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_64<int8_t, int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint8(const uint8_t* data,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint8_t> ptr = kernel::malloc<uint8_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint8_t));
+    uint8_t initial = std::numeric_limits<uint8_t>::max();
+    if (has_initial_) {
+      initial = (uint8_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_64<uint8_t, uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int16(const int16_t* data,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int16_t> ptr = kernel::malloc<int16_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int16_t));
+    int16_t initial = std::numeric_limits<int16_t>::max();
+    if (has_initial_) {
+      initial = (int16_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_64<int16_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint16(const uint16_t* data,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint16_t> ptr = kernel::malloc<uint16_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint16_t));
+    uint16_t initial = std::numeric_limits<uint16_t>::max();
+    if (has_initial_) {
+      initial = (uint16_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_64<uint16_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int32(const int32_t* data,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    int32_t initial = std::numeric_limits<int32_t>::max();
+    if (has_initial_) {
+      initial = (int32_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_64<int32_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint32(const uint32_t* data,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    uint32_t initial = std::numeric_limits<uint32_t>::max();
+    if (has_initial_) {
+      initial = (uint32_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_64<uint32_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_int64(const int64_t* data,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    int64_t initial = std::numeric_limits<int64_t>::max();
+    if (has_initial_) {
+      initial = (int64_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_64<int64_t, int64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_uint64(const uint64_t* data,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    uint64_t initial = std::numeric_limits<uint64_t>::max();
+    if (has_initial_) {
+      initial = (uint64_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_64<uint64_t, uint64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_float32(const float* data,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<float> ptr = kernel::malloc<float>(
+      ptr_lib, outlength*(int64_t)sizeof(float));
+    float initial = std::numeric_limits<float>::infinity();
+    if (has_initial_) {
+      initial = (float)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_64<float, float>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_float64(const double* data,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<double> ptr = kernel::malloc<double>(
+      ptr_lib, outlength*(int64_t)sizeof(double));
+    double initial = std::numeric_limits<double>::infinity();
+    if (has_initial_) {
+      initial = (double)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_64<double, double>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_complex64(const std::complex<float>* data,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<std::complex<float>> ptr = kernel::malloc<std::complex<float>>(
+      ptr_lib, outlength*(int64_t)sizeof(std::complex<float>));
+    float initial = std::numeric_limits<float>::infinity();
+    if (has_initial_) {
+      initial = (float)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_64<std::complex<float>, std::complex<float>>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_complex128(const std::complex<double>* data,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<std::complex<double>> ptr = kernel::malloc<std::complex<double>>(
+      ptr_lib, outlength*(int64_t)sizeof(std::complex<double>));
+    double initial = std::numeric_limits<double>::infinity();
+    if (has_initial_) {
+      initial = (double)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_64<std::complex<double>, std::complex<double>>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      parents.data(),
+      parents.length(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_int8(const int8_t* data,
+                                 const Index64& offsets,
+                                 int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int8_t> ptr = kernel::malloc<int8_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int8_t));
+    int8_t initial = std::numeric_limits<int8_t>::max();
+    if (has_initial_) {
+      initial = (int8_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<int8_t, int8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_uint8(const uint8_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint8_t> ptr = kernel::malloc<uint8_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint8_t));
+    uint8_t initial = std::numeric_limits<uint8_t>::max();
+    if (has_initial_) {
+      initial = (uint8_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<uint8_t, uint8_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_int16(const int16_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int16_t> ptr = kernel::malloc<int16_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int16_t));
+    int16_t initial = std::numeric_limits<int16_t>::max();
+    if (has_initial_) {
+      initial = (int16_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<int16_t, int16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_uint16(const uint16_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint16_t> ptr = kernel::malloc<uint16_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint16_t));
+    uint16_t initial = std::numeric_limits<uint16_t>::max();
+    if (has_initial_) {
+      initial = (uint16_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<uint16_t, uint16_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_int32(const int32_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int32_t));
+    int32_t initial = std::numeric_limits<int32_t>::max();
+    if (has_initial_) {
+      initial = (int32_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<int32_t, int32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_uint32(const uint32_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint32_t));
+    uint32_t initial = std::numeric_limits<uint32_t>::max();
+    if (has_initial_) {
+      initial = (uint32_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<uint32_t, uint32_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_int64(const int64_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(int64_t));
+    int64_t initial = std::numeric_limits<int64_t>::max();
+    if (has_initial_) {
+      initial = (int64_t)initial_i64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<int64_t, int64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_uint64(const uint64_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
+      ptr_lib, outlength*(int64_t)sizeof(uint64_t));
+    uint64_t initial = std::numeric_limits<uint64_t>::max();
+    if (has_initial_) {
+      initial = (uint64_t)initial_u64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<uint64_t, uint64_t>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_float32(const float* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<float> ptr = kernel::malloc<float>(
+      ptr_lib, outlength*(int64_t)sizeof(float));
+    float initial = std::numeric_limits<float>::infinity();
+    if (has_initial_) {
+      initial = (float)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<float, float>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
+    util::handle_error(err, util::quote(name()), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_offsets_float64(const double* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
+    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
+    std::shared_ptr<double> ptr = kernel::malloc<double>(
+      ptr_lib, outlength*(int64_t)sizeof(double));
+    double initial = std::numeric_limits<double>::infinity();
+    if (has_initial_) {
+      initial = (double)initial_f64_;
+    }
+    struct Error err = kernel::reduce_min_offsets_64<double, double>(
+      ptr_lib,
+      ptr.get(),
+      data,
+      offsets.data(),
+      outlength,
+      initial);
     util::handle_error(err, util::quote(name()), nullptr);
     return ptr;
   }
 
-  ////////// min (minimum, in which infinity is the identity)
+  ////////// max (maximum, in which -infinity is the identity)
 
-  ReducerMin::ReducerMin(double initial_f64,
+  ReducerMax::ReducerMax(double initial_f64,
                          uint64_t initial_u64,
                          int64_t initial_i64)
     : initial_f64_(initial_f64)
@@ -1633,30 +3089,30 @@ namespace awkward {
     , initial_i64_(initial_i64)
     , has_initial_(true) { }
 
-  ReducerMin::ReducerMin()
+  ReducerMax::ReducerMax()
     : initial_f64_(0.0)
     , initial_u64_((uint64_t)0)
     , initial_i64_((int64_t)0)
     , has_initial_(false) { }
 
   const std::string
-  ReducerMin::name() const {
-    return "min";
+  ReducerMax::name() const {
+    return "max";
   }
 
   util::dtype
-  ReducerMin::preferred_dtype() const {
+  ReducerMax::preferred_dtype() const {
     return util::dtype::float64;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_bool(const bool* data,
+  ReducerMax::apply_bool(const bool* data,
                          const Index64& parents,
                          int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<bool> ptr = kernel::malloc<bool>(
       ptr_lib, outlength*(int64_t)sizeof(bool));
-    struct Error err = kernel::reduce_prod_bool_64<bool>(
+    struct Error err = kernel::reduce_sum_bool_64<bool>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1668,17 +3124,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int8(const int8_t* data,
+  ReducerMax::apply_int8(const int8_t* data,
                          const Index64& parents,
                          int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int8_t> ptr = kernel::malloc<int8_t>(
       ptr_lib, outlength*(int64_t)sizeof(int8_t));
-    int8_t initial = std::numeric_limits<int8_t>::max();
+    int8_t initial = std::numeric_limits<int8_t>::min();
     if (has_initial_) {
       initial = (int8_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_min_64<int8_t, int8_t>(
+    struct Error err = kernel::reduce_max_64<int8_t, int8_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1691,17 +3147,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint8(const uint8_t* data,
+  ReducerMax::apply_uint8(const uint8_t* data,
                           const Index64& parents,
                           int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint8_t> ptr = kernel::malloc<uint8_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint8_t));
-    uint8_t initial = std::numeric_limits<uint8_t>::max();
+    uint8_t initial = std::numeric_limits<uint8_t>::min();
     if (has_initial_) {
       initial = (uint8_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_min_64<uint8_t, uint8_t>(
+    struct Error err = kernel::reduce_max_64<uint8_t, uint8_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1714,17 +3170,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int16(const int16_t* data,
+  ReducerMax::apply_int16(const int16_t* data,
                           const Index64& parents,
                           int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int16_t> ptr = kernel::malloc<int16_t>(
       ptr_lib, outlength*(int64_t)sizeof(int16_t));
-    int16_t initial = std::numeric_limits<int16_t>::max();
+    int16_t initial = std::numeric_limits<int16_t>::min();
     if (has_initial_) {
       initial = (int16_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_min_64<int16_t, int16_t>(
+    struct Error err = kernel::reduce_max_64<int16_t, int16_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1737,17 +3193,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint16(const uint16_t* data,
+  ReducerMax::apply_uint16(const uint16_t* data,
                            const Index64& parents,
                            int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint16_t> ptr = kernel::malloc<uint16_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint16_t));
-    uint16_t initial = std::numeric_limits<uint16_t>::max();
+    uint16_t initial = std::numeric_limits<uint16_t>::min();
     if (has_initial_) {
       initial = (uint16_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_min_64<uint16_t, uint16_t>(
+    struct Error err = kernel::reduce_max_64<uint16_t, uint16_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1760,17 +3216,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int32(const int32_t* data,
+  ReducerMax::apply_int32(const int32_t* data,
                           const Index64& parents,
                           int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
       ptr_lib, outlength*(int64_t)sizeof(int32_t));
-    int32_t initial = std::numeric_limits<int32_t>::max();
+    int32_t initial = std::numeric_limits<int32_t>::min();
     if (has_initial_) {
       initial = (int32_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_min_64<int32_t, int32_t>(
+    struct Error err = kernel::reduce_max_64<int32_t, int32_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1783,17 +3239,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint32(const uint32_t* data,
+  ReducerMax::apply_uint32(const uint32_t* data,
                            const Index64& parents,
                            int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint32_t));
-    uint32_t initial = std::numeric_limits<uint32_t>::max();
+    uint32_t initial = std::numeric_limits<uint32_t>::min();
     if (has_initial_) {
       initial = (uint32_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_min_64<uint32_t, uint32_t>(
+    struct Error err = kernel::reduce_max_64<uint32_t, uint32_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1806,17 +3262,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int64(const int64_t* data,
+  ReducerMax::apply_int64(const int64_t* data,
                           const Index64& parents,
                           int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
       ptr_lib, outlength*(int64_t)sizeof(int64_t));
-    int64_t initial = std::numeric_limits<int64_t>::max();
+    int64_t initial = std::numeric_limits<int64_t>::min();
     if (has_initial_) {
       initial = (int64_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_min_64<int64_t, int64_t>(
+    struct Error err = kernel::reduce_max_64<int64_t, int64_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1829,17 +3285,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint64(const uint64_t* data,
+  ReducerMax::apply_uint64(const uint64_t* data,
                            const Index64& parents,
                            int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint64_t));
-    uint64_t initial = std::numeric_limits<uint64_t>::max();
+    uint64_t initial = std::numeric_limits<uint64_t>::min();
     if (has_initial_) {
       initial = (uint64_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_min_64<uint64_t, uint64_t>(
+    struct Error err = kernel::reduce_max_64<uint64_t, uint64_t>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1852,17 +3308,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float32(const float* data,
+  ReducerMax::apply_float32(const float* data,
                             const Index64& parents,
                             int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<float> ptr = kernel::malloc<float>(
       ptr_lib, outlength*(int64_t)sizeof(float));
-    float initial = std::numeric_limits<float>::infinity();
+    float initial = -std::numeric_limits<float>::infinity();
     if (has_initial_) {
       initial = (float)initial_f64_;
     }
-    struct Error err = kernel::reduce_min_64<float, float>(
+    struct Error err = kernel::reduce_max_64<float, float>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1875,17 +3331,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float64(const double* data,
+  ReducerMax::apply_float64(const double* data,
                             const Index64& parents,
                             int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<double> ptr = kernel::malloc<double>(
       ptr_lib, outlength*(int64_t)sizeof(double));
-    double initial = std::numeric_limits<double>::infinity();
+    double initial = -std::numeric_limits<double>::infinity();
     if (has_initial_) {
       initial = (double)initial_f64_;
     }
-    struct Error err = kernel::reduce_min_64<double, double>(
+    struct Error err = kernel::reduce_max_64<double, double>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1898,17 +3354,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_complex64(const std::complex<float>* data,
+  ReducerMax::apply_complex64(const std::complex<float>* data,
                               const Index64& parents,
                               int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<std::complex<float>> ptr = kernel::malloc<std::complex<float>>(
       ptr_lib, outlength*(int64_t)sizeof(std::complex<float>));
-    float initial = std::numeric_limits<float>::infinity();
+    float initial = 0;
     if (has_initial_) {
       initial = (float)initial_f64_;
     }
-    struct Error err = kernel::reduce_min_64<std::complex<float>, std::complex<float>>(
+    struct Error err = kernel::reduce_max_64<std::complex<float>, std::complex<float>>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1921,17 +3377,17 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_complex128(const std::complex<double>* data,
+  ReducerMax::apply_complex128(const std::complex<double>* data,
                                const Index64& parents,
                                int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<std::complex<double>> ptr = kernel::malloc<std::complex<double>>(
       ptr_lib, outlength*(int64_t)sizeof(std::complex<double>));
-    double initial = std::numeric_limits<double>::infinity();
+    double initial = 0;
     if (has_initial_) {
       initial = (double)initial_f64_;
     }
-    struct Error err = kernel::reduce_min_64<std::complex<double>, std::complex<double>>(
+    struct Error err = kernel::reduce_max_64<std::complex<double>, std::complex<double>>(
       ptr_lib,
       ptr.get(),
       data,
@@ -1943,54 +3399,10 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// max (maximum, in which -infinity is the identity)
-
-  ReducerMax::ReducerMax(double initial_f64,
-                         uint64_t initial_u64,
-                         int64_t initial_i64)
-    : initial_f64_(initial_f64)
-    , initial_u64_(initial_u64)
-    , initial_i64_(initial_i64)
-    , has_initial_(true) { }
-
-  ReducerMax::ReducerMax()
-    : initial_f64_(0.0)
-    , initial_u64_((uint64_t)0)
-    , initial_i64_((int64_t)0)
-    , has_initial_(false) { }
-
-  const std::string
-  ReducerMax::name() const {
-    return "max";
-  }
-
-  util::dtype
-  ReducerMax::preferred_dtype() const {
-    return util::dtype::float64;
-  }
-
-  const std::shared_ptr<void>
-  ReducerMax::apply_bool(const bool* data,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<bool> ptr = kernel::malloc<bool>(
-      ptr_lib, outlength*(int64_t)sizeof(bool));
-    struct Error err = kernel::reduce_sum_bool_64<bool>(
-      ptr_lib,
-      ptr.get(),
-      data,
-      parents.data(),
-      parents.length(),
-      outlength);
-    util::handle_error(err, util::quote(name()), nullptr);
-    return ptr;
-  }
-
   const std::shared_ptr<void>
-  ReducerMax::apply_int8(const int8_t* data,
-                         const Index64& parents,
-                         int64_t outlength) const {
+  ReducerMax::apply_offsets_int8(const int8_t* data,
+                                 const Index64& offsets,
+                                 int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int8_t> ptr = kernel::malloc<int8_t>(
       ptr_lib, outlength*(int64_t)sizeof(int8_t));
@@ -1998,12 +3410,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (int8_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_max_64<int8_t, int8_t>(
+    struct Error err = kernel::reduce_max_offsets_64<int8_t, int8_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2011,9 +3422,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint8(const uint8_t* data,
-                          const Index64& parents,
-                          int64_t outlength) const {
+  ReducerMax::apply_offsets_uint8(const uint8_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint8_t> ptr = kernel::malloc<uint8_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint8_t));
@@ -2021,12 +3432,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (uint8_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_max_64<uint8_t, uint8_t>(
+    struct Error err = kernel::reduce_max_offsets_64<uint8_t, uint8_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2034,9 +3444,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int16(const int16_t* data,
-                          const Index64& parents,
-                          int64_t outlength) const {
+  ReducerMax::apply_offsets_int16(const int16_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int16_t> ptr = kernel::malloc<int16_t>(
       ptr_lib, outlength*(int64_t)sizeof(int16_t));
@@ -2044,12 +3454,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (int16_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_max_64<int16_t, int16_t>(
+    struct Error err = kernel::reduce_max_offsets_64<int16_t, int16_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2057,9 +3466,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint16(const uint16_t* data,
-                           const Index64& parents,
-                           int64_t outlength) const {
+  ReducerMax::apply_offsets_uint16(const uint16_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint16_t> ptr = kernel::malloc<uint16_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint16_t));
@@ -2067,12 +3476,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (uint16_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_max_64<uint16_t, uint16_t>(
+    struct Error err = kernel::reduce_max_offsets_64<uint16_t, uint16_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2080,9 +3488,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int32(const int32_t* data,
-                          const Index64& parents,
-                          int64_t outlength) const {
+  ReducerMax::apply_offsets_int32(const int32_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int32_t> ptr = kernel::malloc<int32_t>(
       ptr_lib, outlength*(int64_t)sizeof(int32_t));
@@ -2090,12 +3498,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (int32_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_max_64<int32_t, int32_t>(
+    struct Error err = kernel::reduce_max_offsets_64<int32_t, int32_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2103,9 +3510,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint32(const uint32_t* data,
-                           const Index64& parents,
-                           int64_t outlength) const {
+  ReducerMax::apply_offsets_uint32(const uint32_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint32_t> ptr = kernel::malloc<uint32_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint32_t));
@@ -2113,12 +3520,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (uint32_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_max_64<uint32_t, uint32_t>(
+    struct Error err = kernel::reduce_max_offsets_64<uint32_t, uint32_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2126,9 +3532,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int64(const int64_t* data,
-                          const Index64& parents,
-                          int64_t outlength) const {
+  ReducerMax::apply_offsets_int64(const int64_t* data,
+                                  const Index64& offsets,
+                                  int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<int64_t> ptr = kernel::malloc<int64_t>(
       ptr_lib, outlength*(int64_t)sizeof(int64_t));
@@ -2136,12 +3542,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (int64_t)initial_i64_;
     }
-    struct Error err = kernel::reduce_max_64<int64_t, int64_t>(
+    struct Error err = kernel::reduce_max_offsets_64<int64_t, int64_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2149,9 +3554,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint64(const uint64_t* data,
-                           const Index64& parents,
-                           int64_t outlength) const {
+  ReducerMax::apply_offsets_uint64(const uint64_t* data,
+                                   const Index64& offsets,
+                                   int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<uint64_t> ptr = kernel::malloc<uint64_t>(
       ptr_lib, outlength*(int64_t)sizeof(uint64_t));
@@ -2159,12 +3564,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (uint64_t)initial_u64_;
     }
-    struct Error err = kernel::reduce_max_64<uint64_t, uint64_t>(
+    struct Error err = kernel::reduce_max_offsets_64<uint64_t, uint64_t>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2172,9 +3576,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float32(const float* data,
-                            const Index64& parents,
-                            int64_t outlength) const {
+  ReducerMax::apply_offsets_float32(const float* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<float> ptr = kernel::malloc<float>(
       ptr_lib, outlength*(int64_t)sizeof(float));
@@ -2182,12 +3586,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (float)initial_f64_;
     }
-    struct Error err = kernel::reduce_max_64<float, float>(
+    struct Error err = kernel::reduce_max_offsets_64<float, float>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -2195,9 +3598,9 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float64(const double* data,
-                            const Index64& parents,
-                            int64_t outlength) const {
+  ReducerMax::apply_offsets_float64(const double* data,
+                                    const Index64& offsets,
+                                    int64_t outlength) const {
     kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
     std::shared_ptr<double> ptr = kernel::malloc<double>(
       ptr_lib, outlength*(int64_t)sizeof(double));
@@ -2205,58 +3608,11 @@ namespace awkward {
     if (has_initial_) {
       initial = (double)initial_f64_;
     }
-    struct Error err = kernel::reduce_max_64<double, double>(
-      ptr_lib,
-      ptr.get(),
-      data,
-      parents.data(),
-      parents.length(),
-      outlength,
-      initial);
-    util::handle_error(err, util::quote(name()), nullptr);
-    return ptr;
-  }
-
-  const std::shared_ptr<void>
-  ReducerMax::apply_complex64(const std::complex<float>* data,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<std::complex<float>> ptr = kernel::malloc<std::complex<float>>(
-      ptr_lib, outlength*(int64_t)sizeof(std::complex<float>));
-    float initial = 0;
-    if (has_initial_) {
-      initial = (float)initial_f64_;
-    }
-    struct Error err = kernel::reduce_max_64<std::complex<float>, std::complex<float>>(
-      ptr_lib,
-      ptr.get(),
-      data,
-      parents.data(),
-      parents.length(),
-      outlength,
-      initial);
-    util::handle_error(err, util::quote(name()), nullptr);
-    return ptr;
-  }
-
-  const std::shared_ptr<void>
-  ReducerMax::apply_complex128(const std::complex<double>* data,
-                               const Index64& parents,
-                               int64_t outlength) const {
-    kernel::lib ptr_lib = kernel::lib::cpu;   // DERIVE
-    std::shared_ptr<std::complex<double>> ptr = kernel::malloc<std::complex<double>>(
-      ptr_lib, outlength*(int64_t)sizeof(std::complex<double>));
-    double initial = 0;
-    if (has_initial_) {
-      initial = (double)initial_f64_;
-    }
-    struct Error err = kernel::reduce_max_64<std::complex<double>, std::complex<double>>(
+    struct Error err = kernel::reduce_max_offsets_64<double, double>(
       ptr_lib,
       ptr.get(),
       data,
-      parents.data(),
-      parents.length(),
+      offsets.data(),
       outlength,
       initial);
     util::handle_error(err, util::quote(name()), nullptr);
@@ -20,6 +20,8 @@
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/array/ListOffsetArray.h"
 #include "awkward/array/VirtualArray.h"
 
 #include "awkward/array/BitMaskedArray.h"
@@ -319,7 +321,16 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::project() const {
-    return toByteMaskedArray().get()->project();
+    Index64 nextcarry(length_ - numnull());
+    struct Error err = kernel::BitMaskedArray_getitem_nextcarry_64(
+      kernel::lib::cpu,   // DERIVE
+      nextcarry.data(),
+      mask_.data(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return content_.get()->carry(nextcarry, false);
   }
 
   const ContentPtr
@@ -343,6 +354,31 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::simplify_optiontype() const {
+    if (BitMaskedArray* rawcontent =
+        dynamic_cast<BitMaskedArray*>(content_.get())) {
+      if (rawcontent->lsb_order() == lsb_order_) {
+        // Both masks line up bit for bit: combine them without expanding.
+        int64_t bitlength = ((length_ / 8) + ((length_ % 8) != 0));
+        IndexU8 mask(bitlength);
+        struct Error err = kernel::BitMaskedArray_overlay_mask(
+          kernel::lib::cpu,   // DERIVE
+          mask.data(),
+          mask_.data(),
+          valid_when_,
+          rawcontent->mask().data(),
+          rawcontent->valid_when(),
+          bitlength);
+        util::handle_error(err, classname(), identities_.get());
+        BitMaskedArray step1(identities_,
+                             parameters_,
+                             mask,
+                             rawcontent->content(),
+                             true,
+                             length_,
+                             lsb_order_);
+        return step1.simplify_optiontype();
+      }
+    }
     if (dynamic_cast<IndexedArray32*>(content_.get())        ||
         dynamic_cast<IndexedArrayU32*>(content_.get())       ||
         dynamic_cast<IndexedArray64*>(content_.get())        ||
@@ -380,6 +416,20 @@ namespace awkward {
       valid_when_);
   }
 
+  int64_t
+  BitMaskedArray::numnull() const {
+    int64_t out;
+    struct Error err = kernel::BitMaskedArray_numnull(
+      kernel::lib::cpu,   // DERIVE
+      &out,
+      mask_.data(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return out;
+  }
+
   const std::shared_ptr<IndexedOptionArray64>
   BitMaskedArray::toIndexedOptionArray64() const {
     Index64 index(mask_.length() * 8);
@@ -676,7 +726,40 @@ namespace awkward {
 
   const ContentPtr
   BitMaskedArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
-    return toByteMaskedArray().get()->getitem_range_nowrap(start, stop);
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    int64_t length = stop - start;
+    int64_t bitlength = ((length / 8) + ((length % 8) != 0));
+    ContentPtr content = content_.get()->getitem_range_nowrap(start, stop);
+    if (start % 8 == 0) {
+      return std::make_shared<BitMaskedArray>(
+        identities,
+        parameters_,
+        mask_.getitem_range_nowrap(start / 8, start / 8 + bitlength),
+        content,
+        valid_when_,
+        length,
+        lsb_order_);
+    }
+    IndexU8 mask(bitlength);
+    struct Error err = kernel::BitMaskedArray_getitem_range(
+      kernel::lib::cpu,   // DERIVE
+      mask.data(),
+      mask_.data(),
+      start,
+      length,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<BitMaskedArray>(
+      identities,
+      parameters_,
+      mask,
+      content,
+      valid_when_,
+      length,
+      lsb_order_);
   }
 
   const ContentPtr
@@ -733,7 +816,27 @@ namespace awkward {
   BitMaskedArray::getitem_next(const SliceItemPtr& head,
                                const Slice& tail,
                                const Index64& advanced) const {
-    return toByteMaskedArray().get()->getitem_next(head, tail, advanced);
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else if (dynamic_cast<SliceAt*>(head.get())  ||
+             dynamic_cast<SliceRange*>(head.get())  ||
+             dynamic_cast<SliceArray64*>(head.get())  ||
+             dynamic_cast<SliceJagged64*>(head.get())) {
+      int64_t numnull;
+      std::pair<Index64, Index64> pair = nextcarry_outindex(numnull);
+      Index64 nextcarry = pair.first;
+      Index64 outindex = pair.second;
+
+      ContentPtr next = content_.get()->carry(nextcarry, true);
+
+      ContentPtr out = next.get()->getitem_next(head, tail, advanced);
+      IndexedOptionArray64 out2(identities_, parameters_, outindex, out);
+      return out2.simplify_optiontype();
+    }
+    else {
+      return toByteMaskedArray().get()->getitem_next(head, tail, advanced);
+    }
   }
 
   const ContentPtr
@@ -746,7 +849,29 @@ namespace awkward {
         return getitem_range_nowrap(0, carry.length());
       }
     }
-    return toByteMaskedArray().get()->carry(carry, allow_lazy);
+    int64_t bitlength = ((carry.length() / 8) + ((carry.length() % 8) != 0));
+    IndexU8 nextmask(bitlength);
+    struct Error err = kernel::BitMaskedArray_getitem_carry_64(
+      kernel::lib::cpu,   // DERIVE
+      nextmask.data(),
+      mask_.data(),
+      length_,
+      carry.data(),
+      carry.length(),
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    return std::make_shared<BitMaskedArray>(
+      identities,
+      parameters_,
+      nextmask,
+      content_.get()->carry(carry, allow_lazy),
+      valid_when_,
+      carry.length(),
+      lsb_order_);
   }
 
   int64_t
@@ -960,14 +1085,93 @@ namespace awkward {
                               int64_t outlength,
                               bool mask,
                               bool keepdims) const {
-    return toByteMaskedArray().get()->reduce_next(reducer,
-                                                  negaxis,
-                                                  starts,
-                                                  shifts,
-                                                  parents,
-                                                  outlength,
-                                                  mask,
-                                                  keepdims);
+    std::pair<bool, int64_t> branchdepth = branch_depth();
+
+    if (reducer.returns_positions()  &&
+        !branchdepth.first  && negaxis == branchdepth.second) {
+      // The shifts for argmin/argmax are only computed from a byte mask.
+      return toByteMaskedArray().get()->reduce_next(reducer,
+                                                    negaxis,
+                                                    starts,
+                                                    shifts,
+                                                    parents,
+                                                    outlength,
+                                                    mask,
+                                                    keepdims);
+    }
+
+    int64_t numnull = BitMaskedArray::numnull();
+    Index64 nextparents(length_ - numnull);
+    Index64 nextcarry(length_ - numnull);
+    Index64 outindex(length_);
+    struct Error err = kernel::BitMaskedArray_reduce_next_64(
+      kernel::lib::cpu,   // DERIVE
+      nextcarry.data(),
+      nextparents.data(),
+      outindex.data(),
+      mask_.data(),
+      parents.data(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+
+    ContentPtr next = content_.get()->carry(nextcarry, false);
+    if (RegularArray* raw = dynamic_cast<RegularArray*>(next.get())) {
+      next = raw->toListOffsetArray64(true);
+    }
+
+    ContentPtr out = next.get()->reduce_next(reducer,
+                                             negaxis,
+                                             starts,
+                                             Index64(0),
+                                             nextparents,
+                                             outlength,
+                                             mask,
+                                             keepdims);
+
+    if (!branchdepth.first  &&  negaxis == branchdepth.second) {
+      return out;
+    }
+    else {
+      if (RegularArray* raw =
+          dynamic_cast<RegularArray*>(out.get())) {
+        out = raw->toListOffsetArray64(true);
+      }
+      if (ListOffsetArray64* raw =
+          dynamic_cast<ListOffsetArray64*>(out.get())) {
+        Index64 outoffsets(starts.length() + 1);
+        if (starts.length() > 0  &&  starts.getitem_at_nowrap(0) != 0) {
+          throw std::runtime_error(
+            std::string("reduce_next with unbranching depth > negaxis expects "
+                        "a ListOffsetArray64 whose offsets start at zero")
+            + FILENAME(__LINE__));
+        }
+        struct Error err2 = kernel::IndexedArray_reduce_next_fix_offsets_64(
+          kernel::lib::cpu,   // DERIVE
+          outoffsets.data(),
+          starts.data(),
+          starts.length(),
+          outindex.length());
+        util::handle_error(err2, classname(), identities_.get());
+
+        return std::make_shared<ListOffsetArray64>(
+          raw->identities(),
+          raw->parameters(),
+          outoffsets,
+          std::make_shared<IndexedOptionArray64>(Identities::none(),
+                                                 util::Parameters(),
+                                                 outindex,
+                                                 raw->content()));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("reduce_next with unbranching depth > negaxis is only "
+                      "expected to return RegularArray or ListOffsetArray64; "
+                      "instead, it returned ")
+          + out.get()->classname() + FILENAME(__LINE__));
+      }
+    }
   }
 
   const ContentPtr
@@ -1139,6 +1343,24 @@ namespace awkward {
     return toByteMaskedArray().get()->numbers_to_type(name);
   }
 
+  const std::pair<Index64, Index64>
+  BitMaskedArray::nextcarry_outindex(int64_t& numnull) const {
+    numnull = BitMaskedArray::numnull();
+    Index64 nextcarry(length_ - numnull);
+    Index64 outindex(length_);
+    struct Error err = kernel::BitMaskedArray_getitem_nextcarry_outindex_64(
+      kernel::lib::cpu,   // DERIVE
+      nextcarry.data(),
+      outindex.data(),
+      mask_.data(),
+      length_,
+      valid_when_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+
+    return std::pair<Index64, Index64>(nextcarry, outindex);
+  }
+
   bool
   BitMaskedArray::is_unique() const {
     return toByteMaskedArray().get()->is_unique();
@@ -1466,6 +1466,34 @@ namespace awkward {
     if (identities_.get() != nullptr) {
       identities = identities_.get()->getitem_carry_64(carry);
     }
+
+    // an IndexedArray64 of an IndexedArray64 (as successive lazy carries
+    // make) is composed into one, so that its content is gathered only once
+    if (!ISOPTION) {
+      if (IndexedArray64* rawcontent =
+          dynamic_cast<IndexedArray64*>(content_.get())) {
+        if (rawcontent->parameters().empty()  &&
+            rawcontent->identities().get() == nullptr) {
+          Index64 nextcarry = nextindex.to64();
+          Index64 innerindex = rawcontent->index();
+          Index64 composed(nextcarry.length());
+          // unlike a carry, the outer index is not known to be in range
+          struct Error err2 = kernel::IndexedArray64_getitem_compose_64(
+            kernel::lib::cpu,   // DERIVE
+            composed.data(),
+            nextcarry.data(),
+            innerindex.data(),
+            nextcarry.length(),
+            innerindex.length());
+          util::handle_error(err2, classname(), identities_.get());
+          return std::make_shared<IndexedArray64>(identities,
+                                                  parameters_,
+                                                  composed,
+                                                  rawcontent->content());
+        }
+      }
+    }
+
     return std::make_shared<IndexedArrayOf<T, ISOPTION>>(identities,
                                                          parameters_,
                                                          nextindex,
@@ -1479,34 +1479,49 @@ namespace awkward {
     }
 
     else {
-      int64_t globalstart;
-      int64_t globalstop;
-      struct Error err1 = kernel::ListOffsetArray_reduce_global_startstop_64(
-        kernel::lib::cpu,   // DERIVE
-        &globalstart,
-        &globalstop,
-        offsets_.data(),
-        offsets_.length() - 1);
-      util::handle_error(err1, classname(), identities_.get());
-
-      Index64 nextparents(globalstop - globalstart);
-      struct Error err2 = kernel::ListOffsetArray_reduce_local_nextparents_64(
-        kernel::lib::cpu,   // DERIVE
-        nextparents.data(),
-        offsets_.data(),
-        offsets_.length() - 1);
-      util::handle_error(err2, classname(), identities_.get());
+      ContentPtr outcontent(nullptr);
+      NumpyArray* rawcontent = dynamic_cast<NumpyArray*>(content_.get());
+      if (rawcontent != nullptr  &&
+          rawcontent->ndim() == 1  &&
+          rawcontent->iscontiguous()  &&
+          !reducer.returns_positions()) {
+        // The groups are contiguous ranges of numbers: reduce them directly
+        // from the offsets, rather than expanding them into nextparents.
+        outcontent = rawcontent->reduce_offsets_next(reducer,
+                                                     offsets_,
+                                                     mask,
+                                                     keepdims);
+      }
+      else {
+        int64_t globalstart;
+        int64_t globalstop;
+        struct Error err1 = kernel::ListOffsetArray_reduce_global_startstop_64(
+          kernel::lib::cpu,   // DERIVE
+          &globalstart,
+          &globalstop,
+          offsets_.data(),
+          offsets_.length() - 1);
+        util::handle_error(err1, classname(), identities_.get());
 
-      ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
-                                                                globalstop);
-      ContentPtr outcontent = trimmed.get()->reduce_next(reducer,
-                                                         negaxis,
-                                                         util::make_starts(offsets_),
-                                                         shifts,
-                                                         nextparents,
-                                                         offsets_.length() - 1,
-                                                         mask,
-                                                         keepdims);
+        Index64 nextparents(globalstop - globalstart);
+        struct Error err2 = kernel::ListOffsetArray_reduce_local_nextparents_64(
+          kernel::lib::cpu,   // DERIVE
+          nextparents.data(),
+          offsets_.data(),
+          offsets_.length() - 1);
+        util::handle_error(err2, classname(), identities_.get());
+
+        ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
+                                                                  globalstop);
+        outcontent = trimmed.get()->reduce_next(reducer,
+                                                negaxis,
+                                                util::make_starts(offsets_),
+                                                shifts,
+                                                nextparents,
+                                                offsets_.length() - 1,
+                                                mask,
+                                                keepdims);
+      }
 
       Index64 outoffsets(outlength + 1);
       struct Error err3 = kernel::ListOffsetArray_reduce_local_outoffsets_64(
@@ -9,6 +9,7 @@
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 
 #include "awkward/kernels.h"
 #include "awkward/kernel-utils.h"
@@ -3191,6 +3192,156 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  NumpyArray::reduce_offsets_next(const Reducer& reducer,
+                                  const Index64& offsets,
+                                  bool mask,
+                                  bool keepdims) const {
+    if (shape_.size() != 1  ||  !iscontiguous()) {
+      throw std::runtime_error(
+        std::string("reduce_offsets_next requires a one-dimensional, "
+                    "contiguous NumpyArray") + FILENAME(__LINE__));
+    }
+    if (reducer.returns_positions()) {
+      throw std::runtime_error(
+        std::string("reduce_offsets_next cannot apply a reducer that returns "
+                    "positions") + FILENAME(__LINE__));
+    }
+    int64_t outlength = offsets.length() - 1;
+
+    std::shared_ptr<void> ptr;
+    switch (dtype_) {
+    case util::dtype::boolean:
+      ptr = reducer.apply_offsets_bool(reinterpret_cast<bool*>(data()),
+                                       offsets,
+                                       outlength);
+      break;
+    case util::dtype::int8:
+      ptr = reducer.apply_offsets_int8(reinterpret_cast<int8_t*>(data()),
+                                       offsets,
+                                       outlength);
+      break;
+    case util::dtype::int16:
+      ptr = reducer.apply_offsets_int16(reinterpret_cast<int16_t*>(data()),
+                                        offsets,
+                                        outlength);
+      break;
+    case util::dtype::int32:
+      ptr = reducer.apply_offsets_int32(reinterpret_cast<int32_t*>(data()),
+                                        offsets,
+                                        outlength);
+      break;
+    case util::dtype::int64:
+      ptr = reducer.apply_offsets_int64(reinterpret_cast<int64_t*>(data()),
+                                        offsets,
+                                        outlength);
+      break;
+    case util::dtype::uint8:
+      ptr = reducer.apply_offsets_uint8(reinterpret_cast<uint8_t*>(data()),
+                                        offsets,
+                                        outlength);
+      break;
+    case util::dtype::uint16:
+      ptr = reducer.apply_offsets_uint16(reinterpret_cast<uint16_t*>(data()),
+                                         offsets,
+                                         outlength);
+      break;
+    case util::dtype::uint32:
+      ptr = reducer.apply_offsets_uint32(reinterpret_cast<uint32_t*>(data()),
+                                         offsets,
+                                         outlength);
+      break;
+    case util::dtype::uint64:
+      ptr = reducer.apply_offsets_uint64(reinterpret_cast<uint64_t*>(data()),
+                                         offsets,
+                                         outlength);
+      break;
+    case util::dtype::float16:
+      throw std::runtime_error(
+        std::string("FIXME: reducers on float16") + FILENAME(__LINE__));
+    case util::dtype::float32:
+      ptr = reducer.apply_offsets_float32(reinterpret_cast<float*>(data()),
+                                          offsets,
+                                          outlength);
+      break;
+    case util::dtype::float64:
+      ptr = reducer.apply_offsets_float64(reinterpret_cast<double*>(data()),
+                                          offsets,
+                                          outlength);
+      break;
+    case util::dtype::float128:
+      throw std::runtime_error(
+        std::string("FIXME: reducers on float128") + FILENAME(__LINE__));
+      break;
+    case util::dtype::complex64:
+      ptr = reducer.apply_offsets_complex64(reinterpret_cast<std::complex<float>*>(data()),
+                                            offsets,
+                                            outlength);
+      break;
+    case util::dtype::complex128:
+      ptr = reducer.apply_offsets_complex128(reinterpret_cast<std::complex<double>*>(data()),
+                                             offsets,
+                                             outlength);
+      break;
+    case util::dtype::complex256:
+      throw std::runtime_error(
+        std::string("FIXME: reducers on complex256") + FILENAME(__LINE__));
+      break;
+    // case util::dtype::datetime64:
+    //   throw std::runtime_error(
+    //     std::string("FIXME: reducers on datetime64") + FILENAME(__LINE__));
+    // case util::dtype:::timedelta64:
+    //   throw std::runtime_error(
+    //     std:string("FIXME: reducers on timedelta64") + FILENAME(__LINE__));
+    default:
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to NumpyArray with format \"")
+        + format_ + std::string("\"") + FILENAME(__LINE__));
+    }
+
+    util::dtype dtype = reducer.return_dtype(dtype_);
+    std::string format = util::dtype_to_format(dtype);
+    ssize_t itemsize = util::dtype_to_itemsize(dtype);
+
+    std::vector<ssize_t> shape({ (ssize_t)outlength });
+    std::vector<ssize_t> strides({ itemsize });
+    ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
+                                                  util::Parameters(),
+                                                  ptr,
+                                                  shape,
+                                                  strides,
+                                                  0,
+                                                  itemsize,
+                                                  format,
+                                                  dtype,
+                                                  ptr_lib_);
+
+    if (mask) {
+      Index8 outmask(outlength);
+      struct Error err = kernel::NumpyArray_reduce_mask_ByteMaskedArray_offsets_64(
+        kernel::lib::cpu,   // DERIVE
+        outmask.data(),
+        offsets.data(),
+        outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              outmask,
+                                              out,
+                                              false);
+    }
+
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1,
+                                           length());
+    }
+
+    return out;
+  }
+
   const ContentPtr
   NumpyArray::localindex(int64_t axis, int64_t depth) const {
     int64_t posaxis = axis_wrap_if_negative(axis);
@@ -4654,6 +4805,13 @@ namespace awkward {
     }
   }
 
+  namespace {
+    /// @brief Number of items that NumpyArray::tojson_integer and
+    /// NumpyArray::tojson_real convert at a time for ToJson::integers and
+    /// ToJson::reals.
+    const int64_t kToJsonBatch = 1024;
+  }
+
   void
   NumpyArray::tojson_boolean(ToJson& builder,
                              bool include_beginendlist) const {
@@ -4710,8 +4868,19 @@ namespace awkward {
       if (include_beginendlist) {
         builder.beginlist();
       }
-      for (int64_t i = 0;  i < length();  i++) {
-        builder.integer((int64_t)array[i*stride]);
+      if (std::is_same<T, int64_t>::value  &&  stride == 1) {
+        builder.integers(reinterpret_cast<int64_t*>(array), length());
+      }
+      else {
+        // convert in batches, so that the builder formats them in bulk
+        int64_t batch[kToJsonBatch];
+        for (int64_t start = 0;  start < length();  start += kToJsonBatch) {
+          int64_t stop = std::min(start + kToJsonBatch, length());
+          for (int64_t i = start;  i < stop;  i++) {
+            batch[i - start] = (int64_t)array[i*stride];
+          }
+          builder.integers(batch, stop - start);
+        }
       }
       if (include_beginendlist) {
         builder.endlist();
@@ -4753,8 +4922,19 @@ namespace awkward {
       if (include_beginendlist) {
         builder.beginlist();
       }
-      for (int64_t i = 0;  i < length();  i++) {
-        builder.real(array[i*stride]);
+      if (std::is_same<T, double>::value  &&  stride == 1) {
+        builder.reals(reinterpret_cast<double*>(array), length());
+      }
+      else {
+        // convert in batches, so that the builder formats them in bulk
+        double batch[kToJsonBatch];
+        for (int64_t start = 0;  start < length();  start += kToJsonBatch) {
+          int64_t stop = std::min(start + kToJsonBatch, length());
+          for (int64_t i = start;  i < stop;  i++) {
+            batch[i - start] = (double)array[i*stride];
+          }
+          builder.reals(batch, stop - start);
+        }
       }
       if (include_beginendlist) {
         builder.endlist();
@@ -5325,48 +5505,19 @@ namespace awkward {
       parents.length());
     util::handle_error(err2, classname(), nullptr);
 
-    if (stable) {
-      struct Error err3 = kernel::NumpyArray_sort<T>(
-        kernel::lib::cpu,   // DERIVE
-        ptr.get(),
-        data,
-        length,
-        offsets.data(),
-        offsets_length,
-        parents.length(),
-        ascending,
-        stable);
-      util::handle_error(err3, classname(), nullptr);
-    }
-    else {
-      std::shared_ptr<int64_t> tmp_beg_ptr = kernel::malloc<int64_t>(kernel::lib::cpu,   // DERIVE
-                                                                     kMaxLevels*((int64_t)sizeof(int64_t)));
-      std::shared_ptr<int64_t> tmp_end_ptr = kernel::malloc<int64_t>(kernel::lib::cpu,   // DERIVE
-                                                                     kMaxLevels*((int64_t)sizeof(int64_t)));
-
-      struct Error err3 = kernel::NumpyArray_fill(
-        kernel::lib::cpu,   // DERIVE
-        ptr.get(),
-        0,
-        data,
-        length);
-      util::handle_error(err3, classname(), nullptr);
-
-      Index64 sort_starts = util::make_starts(offsets);
-      Index64 sort_stops = util::make_stops(offsets);
-
-      struct Error err4 = kernel::NumpyArray_quick_sort<T>(
-        kernel::lib::cpu,   // DERIVE
-        ptr.get(),
-        tmp_beg_ptr.get(),
-        tmp_end_ptr.get(),
-        sort_starts.data(),
-        sort_stops.data(),
-        ascending,
-        sort_starts.length(),
-        kMaxLevels);
-      util::handle_error(err4, classname(), nullptr);
-    }
+    // Sorted values cannot reveal the order of ties, so the (stable) sorting
+    // engine serves both settings of `stable`.
+    struct Error err3 = kernel::NumpyArray_sort<T>(
+      kernel::lib::cpu,   // DERIVE
+      ptr.get(),
+      data,
+      length,
+      offsets.data(),
+      offsets_length,
+      parents.length(),
+      ascending,
+      stable);
+    util::handle_error(err3, classname(), nullptr);
 
     return ptr;
   }
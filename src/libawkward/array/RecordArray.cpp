@@ -353,6 +353,73 @@ namespace awkward {
                                         contents);
   }
 
+  namespace {
+    /// @brief Returns `content` if RecordArray::carry can gather it along
+    /// with the other fields in one pass, nullptr otherwise.
+    const NumpyArray*
+    carry_fields_gatherable(const ContentPtr& content) {
+      const NumpyArray* raw = dynamic_cast<const NumpyArray*>(content.get());
+      if (raw != nullptr  &&
+          raw->ptr_lib() == kernel::lib::cpu  &&
+          raw->identities().get() == nullptr  &&
+          raw->ndim() >= 1  &&
+          raw->iscontiguous()) {
+        return raw;
+      }
+      return nullptr;
+    }
+
+    /// @brief Collects the gatherable fields of `record` and of the
+    /// RecordArrays nested in it, depth-first.
+    void
+    carry_fields_collect(const RecordArray* record,
+                         std::vector<const NumpyArray*>& leaves) {
+      for (auto content : record->contents()) {
+        if (const NumpyArray* raw = carry_fields_gatherable(content)) {
+          leaves.push_back(raw);
+        }
+        else if (const RecordArray* rawrecord =
+                 dynamic_cast<const RecordArray*>(content.get())) {
+          carry_fields_collect(rawrecord, leaves);
+        }
+      }
+    }
+
+    /// @brief Carries the fields of `record` (as RecordArray::carry with
+    /// `allow_lazy = false` would), taking the gatherable ones from
+    /// `gathered`, in the order of #carry_fields_collect.
+    const ContentPtrVec
+    carry_fields_rebuild(const RecordArray* record,
+                         const Index64& carry,
+                         const ContentPtrVec& gathered,
+                         size_t& next) {
+      ContentPtrVec contents;
+      for (auto content : record->contents()) {
+        if (carry_fields_gatherable(content) != nullptr) {
+          contents.push_back(gathered[next]);
+          next++;
+        }
+        else if (const RecordArray* rawrecord =
+                 dynamic_cast<const RecordArray*>(content.get())) {
+          IdentitiesPtr identities(nullptr);
+          if (rawrecord->identities().get() != nullptr) {
+            identities = rawrecord->identities().get()->getitem_carry_64(carry);
+          }
+          contents.push_back(std::make_shared<RecordArray>(
+            identities,
+            rawrecord->parameters(),
+            carry_fields_rebuild(rawrecord, carry, gathered, next),
+            rawrecord->recordlookup(),
+            carry.length()));
+        }
+        else {
+          contents.push_back(content.get()->carry(carry, false));
+        }
+      }
+      return contents;
+    }
+  }
+
   ////////// RecordArray
 
   RecordArray::RecordArray(const IdentitiesPtr& identities,
@@ -946,9 +1013,58 @@ namespace awkward {
                                               shallow_copy());
     }
     else {
+      // gather all of the numeric fields, including those of nested
+      // records, in one pass over the carry, rather than one pass per field
+      std::vector<const NumpyArray*> leaves;
+      carry_fields_collect(this, leaves);
       ContentPtrVec contents;
-      for (auto content : contents_) {
-        contents.push_back(content.get()->carry(carry, allow_lazy));
+      if (leaves.size() < 2) {
+        for (auto content : contents_) {
+          contents.push_back(content.get()->carry(carry, allow_lazy));
+        }
+      }
+      else {
+        ContentPtrVec gathered;
+        std::vector<std::shared_ptr<void>> toptrs;
+        std::vector<uint8_t*> toptrsraw;
+        std::vector<const uint8_t*> fromptrs;
+        std::vector<int64_t> strides;
+        for (auto leaf : leaves) {
+          int64_t stride = (int64_t)leaf->strides()[0];
+          std::shared_ptr<void> ptr(
+            kernel::malloc<void>(kernel::lib::cpu,   // DERIVE
+                                 carry.length()*stride));
+          toptrs.push_back(ptr);
+          toptrsraw.push_back(reinterpret_cast<uint8_t*>(ptr.get()));
+          fromptrs.push_back(reinterpret_cast<const uint8_t*>(leaf->data()));
+          strides.push_back(stride);
+        }
+        struct Error err = kernel::RecordArray_getitem_carry_fields_64(
+          kernel::lib::cpu,   // DERIVE
+          toptrsraw.data(),
+          fromptrs.data(),
+          strides.data(),
+          (int64_t)leaves.size(),
+          carry.data(),
+          carry.length());
+        util::handle_error(err, classname(), identities_.get());
+        for (size_t i = 0;  i < leaves.size();  i++) {
+          std::vector<ssize_t> shape = leaves[i]->shape();
+          shape[0] = (ssize_t)carry.length();
+          gathered.push_back(std::make_shared<NumpyArray>(
+            Identities::none(),
+            leaves[i]->parameters(),
+            toptrs[i],
+            shape,
+            leaves[i]->strides(),
+            0,
+            leaves[i]->itemsize(),
+            leaves[i]->format(),
+            leaves[i]->dtype(),
+            kernel::lib::cpu));
+        }
+        size_t next = 0;
+        contents = carry_fields_rebuild(this, carry, gathered, next);
       }
       return std::make_shared<RecordArray>(identities,
                                            parameters_,
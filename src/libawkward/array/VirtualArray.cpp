@@ -3,9 +3,13 @@
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/array/VirtualArray.cpp", line)
 #define FILENAME_C(line) FILENAME_FOR_EXCEPTIONS_C("src/libawkward/array/VirtualArray.cpp", line)
 
+#include <exception>
+#include <future>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "awkward/common.h"
 #include "awkward/Reducer.h"
@@ -13,6 +17,7 @@
 #include "awkward/array/RegularArray.h"
 
 #include "awkward/array/VirtualArray.h"
+#include "awkward/kernel-parallel.h"
 
 namespace awkward {
   ////////// VirtualForm
@@ -365,10 +370,80 @@ namespace awkward {
     return kernel::lib::cpu;
   }
 
+  namespace {
+    /// @brief Arrays being generated by VirtualArray::prefetch, by cache and
+    /// fully qualified key (so that every VirtualArray that would fill the
+    /// same cache entry finds them). Entries are removed when the background
+    /// task ends, and the task holds the cache until then, so a cache's
+    /// address is not reused while it has entries.
+    std::mutex prefetching_mutex;
+    std::unordered_map<std::string,
+                       std::shared_future<ContentPtr>> prefetching;
+
+    std::string
+    prefetching_key(const ArrayCachePtr& cache, const std::string& key) {
+      return std::to_string(reinterpret_cast<size_t>(cache.get()))
+             + std::string(":") + key;
+    }
+
+    /// @brief Pins a key of a cache (if not `nullptr`) for as long as it is
+    /// in scope.
+    class CachePin {
+    public:
+      CachePin(const ArrayCachePtr& cache, const std::string& key)
+          : cache_(cache)
+          , key_(key) {
+        if (cache_.get() != nullptr) {
+          cache_.get()->pin(key_);
+        }
+      }
+
+      ~CachePin() {
+        if (cache_.get() != nullptr) {
+          try {
+            cache_.get()->unpin(key_);
+          }
+          catch (...) { }   // the cache was cleared in the meantime
+        }
+      }
+
+    private:
+      const ArrayCachePtr cache_;
+      const std::string key_;
+    };
+
+    /// @brief Returns the array being prefetched for `key`, waiting for it
+    /// if need be, or `nullptr` if none is or it failed (so that the caller
+    /// generates it, reporting the error itself).
+    ContentPtr
+    wait_for_prefetch(const std::string& key) {
+      std::shared_future<ContentPtr> pending;
+      {
+        std::lock_guard<std::mutex> lock(prefetching_mutex);
+        auto found = prefetching.find(key);
+        if (found == prefetching.end()) {
+          return ContentPtr(nullptr);
+        }
+        pending = found->second;
+      }
+      kernel::background_wait([&pending]() { pending.wait(); });
+      try {
+        return pending.get();
+      }
+      catch (...) {
+        return ContentPtr(nullptr);
+      }
+    }
+  }
+
   const ContentPtr
   VirtualArray::array() const {
     ContentPtr out(nullptr);
     kernel::lib src_ptrlib = check_key(cache_key_);
+    // Keeps other threads from evicting the array while it is found or
+    // generated and put in the cache.
+    CachePin pin(cache_, kernel::fully_qualified_cache_key(ptr_lib_,
+                                                           cache_key()));
 
     if (cache_.get() != nullptr) {
       if (src_ptrlib != ptr_lib_) {
@@ -378,6 +453,10 @@ namespace awkward {
         out = cache_.get()->get(cache_key());
       }
     }
+    if (out.get() == nullptr  &&  cache_.get() != nullptr) {
+      out = wait_for_prefetch(prefetching_key(
+        cache_, kernel::fully_qualified_cache_key(ptr_lib_, cache_key())));
+    }
     if (out.get() == nullptr) {
       if (src_ptrlib != ptr_lib_) {
         out = generator_.get()->generate_and_check()->copy_to(src_ptrlib);
@@ -393,6 +472,56 @@ namespace awkward {
     return out;
   }
 
+  void
+  VirtualArray::prefetch() const {
+    if (cache_.get() == nullptr  ||  cache_.get()->is_broken()  ||
+        check_key(cache_key_) != ptr_lib_) {
+      return;
+    }
+    // Checked outside of prefetching_mutex because the cache may need a
+    // lock of its own (such as the Python GIL).
+    if (cache_.get()->get(cache_key()).get() != nullptr) {
+      return;
+    }
+    std::string key = kernel::fully_qualified_cache_key(ptr_lib_, cache_key());
+    std::string pending = prefetching_key(cache_, key);
+    std::shared_ptr<std::promise<ContentPtr>> promise =
+      std::make_shared<std::promise<ContentPtr>>();
+    {
+      std::lock_guard<std::mutex> lock(prefetching_mutex);
+      if (prefetching.find(pending) != prefetching.end()) {
+        return;
+      }
+      prefetching[pending] = promise.get()->get_future().share();
+    }
+
+    ArrayGeneratorPtr generator = generator_;
+    ArrayCachePtr cache = cache_;
+    kernel::background([generator, cache, key, pending, promise]() {
+      CachePin pin(cache, key);
+      ContentPtr out(nullptr);
+      std::exception_ptr error(nullptr);
+      try {
+        out = generator.get()->generate_and_check();
+        cache.get()->set(key, out);
+      }
+      catch (...) {
+        error = std::current_exception();
+      }
+      {
+        // Before the waiting threads wake up, so that they don't find it.
+        std::lock_guard<std::mutex> lock(prefetching_mutex);
+        prefetching.erase(pending);
+      }
+      if (error) {
+        promise.get()->set_exception(error);
+      }
+      else {
+        promise.get()->set_value(out);
+      }
+    });
+  }
+
   const std::string
   VirtualArray::cache_key() const {
     return cache_key_;
@@ -605,6 +734,8 @@ namespace awkward {
       sliceform = generator_.get()->form().get()->getitem_range();
     }
 
+    // If this is not generated before the slice is, the SliceGenerator asks
+    // the generator for only these rows (see ArrayGenerator::getitem_range).
     ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
                  sliceform, stop - start, shallow_copy(), slice);
     ArrayCachePtr cache(nullptr);
@@ -971,8 +1102,22 @@ namespace awkward {
             length = 0;
           }
           FormPtr form(nullptr);
-          ArrayGeneratorPtr generator = std::make_shared<SliceGenerator>(
+          ArrayGeneratorPtr generator(nullptr);
+          if (range->step() == 1) {
+            // See getitem_range_nowrap; with the regularized range, the
+            // SliceGenerator can ask the generator for only these rows.
+            Slice slice;
+            slice.append(SliceRange(regular_start,
+                                    regular_start + length,
+                                    1));
+            slice.become_sealed();
+            generator = std::make_shared<SliceGenerator>(
+                   form, length, shallow_copy(), slice);
+          }
+          else {
+            generator = std::make_shared<SliceGenerator>(
                      form, length, shallow_copy(), where);
+          }
           ArrayCachePtr cache(nullptr);
           std::shared_ptr<VirtualArray> out = std::make_shared<VirtualArray>(
                                                     Identities::none(),
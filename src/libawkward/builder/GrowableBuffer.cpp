@@ -4,6 +4,7 @@
 
 #include "awkward/builder/GrowableBuffer.h"
 
+#include <algorithm>
 #include <complex>
 #include <cmath>
 #include <cstring>
@@ -64,7 +65,8 @@ namespace awkward {
       : options_(options)
       , ptr_(ptr)
       , length_(length)
-      , reserved_(reserved) { }
+      , reserved_(reserved)
+      , offset_(0) { }
 
   template <typename T>
   GrowableBuffer<T>::GrowableBuffer(const ArrayBuilderOptions& options)
@@ -76,6 +78,9 @@ namespace awkward {
   template <typename T>
   const std::shared_ptr<T>
   GrowableBuffer<T>::ptr() const {
+    if (!chunks_.empty()) {
+      concatenate();
+    }
     return ptr_;
   }
 
@@ -91,6 +96,9 @@ namespace awkward {
     if (newlength > reserved_) {
       set_reserved(newlength);
     }
+    else if (newlength < offset_) {
+      concatenate();
+    }
     length_ = newlength;
   }
 
@@ -104,9 +112,20 @@ namespace awkward {
   void
   GrowableBuffer<T>::set_reserved(int64_t minreserved) {
     if (minreserved > reserved_) {
-      std::shared_ptr<T> ptr = kernel::malloc<T>(kernel::lib::cpu, minreserved*(int64_t)sizeof(T));
-      memcpy(ptr.get(), ptr_.get(), (size_t)length_ * sizeof(T));
-      ptr_ = ptr;
+      if (reserved_ * (int64_t)sizeof(T) < chunk_threshold) {
+        std::shared_ptr<T> ptr = kernel::malloc<T>(kernel::lib::cpu, minreserved*(int64_t)sizeof(T));
+        memcpy(ptr.get(), ptr_.get(), (size_t)(length_ - offset_) * sizeof(T));
+        ptr_ = ptr;
+      }
+      else {
+        // Keep the filled part as a chunk and continue in a new one.
+        if (length_ > offset_) {
+          chunks_.push_back(ptr_);
+          chunkstops_.push_back(length_);
+        }
+        ptr_ = kernel::malloc<T>(kernel::lib::cpu, (minreserved - length_)*(int64_t)sizeof(T));
+        offset_ = length_;
+      }
       reserved_ = minreserved;
     }
   }
@@ -117,6 +136,9 @@ namespace awkward {
     length_ = 0;
     reserved_ = options_.initial();
     ptr_ = kernel::malloc<T>(kernel::lib::cpu, options_.initial()*(int64_t)sizeof(T));
+    offset_ = 0;
+    chunks_.clear();
+    chunkstops_.clear();
   }
 
   template <typename T>
@@ -125,14 +147,53 @@ namespace awkward {
     if (length_ == reserved_) {
       set_reserved((int64_t)ceil(reserved_ * options_.resize()));
     }
-    ptr_.get()[length_] = datum;
+    ptr_.get()[length_ - offset_] = datum;
     length_++;
   }
 
+  template <typename T>
+  void
+  GrowableBuffer<T>::extend(const T* data, int64_t length) {
+    int64_t next = length_ + length;
+    if (next > reserved_) {
+      set_reserved(std::max(next,
+                            (int64_t)ceil(reserved_ * options_.resize())));
+    }
+    memcpy(ptr_.get() + (length_ - offset_), data, (size_t)length * sizeof(T));
+    length_ = next;
+  }
+
   template <typename T>
   T
   GrowableBuffer<T>::getitem_at_nowrap(int64_t at) const {
-    return ptr_.get()[at];
+    if (at >= offset_) {
+      return ptr_.get()[at - offset_];
+    }
+    size_t chunk = (size_t)(std::upper_bound(chunkstops_.begin(),
+                                             chunkstops_.end(),
+                                             at) - chunkstops_.begin());
+    int64_t start = (chunk == 0 ? 0 : chunkstops_[chunk - 1]);
+    return chunks_[chunk].get()[at - start];
+  }
+
+  template <typename T>
+  void
+  GrowableBuffer<T>::concatenate() const {
+    std::shared_ptr<T> ptr = kernel::malloc<T>(kernel::lib::cpu, reserved_*(int64_t)sizeof(T));
+    int64_t start = 0;
+    for (size_t i = 0;  i < chunks_.size();  i++) {
+      memcpy(ptr.get() + start,
+             chunks_[i].get(),
+             (size_t)(chunkstops_[i] - start) * sizeof(T));
+      start = chunkstops_[i];
+    }
+    memcpy(ptr.get() + offset_,
+           ptr_.get(),
+           (size_t)(length_ - offset_) * sizeof(T));
+    ptr_ = ptr;
+    offset_ = 0;
+    chunks_.clear();
+    chunkstops_.clear();
   }
 
   template class EXPORT_TEMPLATE_INST GrowableBuffer<bool>;
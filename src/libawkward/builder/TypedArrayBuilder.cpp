@@ -0,0 +1,799 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/builder/TypedArrayBuilder.cpp", line)
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/Identities.h"
+#include "awkward/Index.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/RegularArray.h"
+
+#include "awkward/builder/TypedArrayBuilder.h"
+
+namespace awkward {
+  namespace {
+    // Calls MACRO(dtype, C++ type) for each dtype that a leaf can have.
+    #define FOR_LEAF_DTYPES(MACRO)                 \
+      MACRO(util::dtype::boolean, bool)            \
+      MACRO(util::dtype::int8, int8_t)             \
+      MACRO(util::dtype::int16, int16_t)           \
+      MACRO(util::dtype::int32, int32_t)           \
+      MACRO(util::dtype::int64, int64_t)           \
+      MACRO(util::dtype::uint8, uint8_t)           \
+      MACRO(util::dtype::uint16, uint16_t)         \
+      MACRO(util::dtype::uint32, uint32_t)         \
+      MACRO(util::dtype::uint64, uint64_t)         \
+      MACRO(util::dtype::float32, float)           \
+      MACRO(util::dtype::float64, double)
+
+    template <typename T>
+    GrowableBuffer<T>*
+    leaf_buffer(const std::shared_ptr<void>& data) {
+      return reinterpret_cast<GrowableBuffer<T>*>(data.get());
+    }
+
+    bool
+    is_leaf_dtype(util::dtype dtype) {
+      switch (dtype) {
+        #define LEAF_CASE(DTYPE, TYPE) case DTYPE:
+        FOR_LEAF_DTYPES(LEAF_CASE)
+        #undef LEAF_CASE
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    bool
+    is_float_dtype(util::dtype dtype) {
+      return dtype == util::dtype::float32  ||  dtype == util::dtype::float64;
+    }
+
+    std::shared_ptr<void>
+    make_leaf(util::dtype dtype, const ArrayBuilderOptions& options) {
+      switch (dtype) {
+        #define LEAF_CASE(DTYPE, TYPE)                                        \
+          case DTYPE:                                                         \
+            return std::make_shared<GrowableBuffer<TYPE>>(                    \
+                     GrowableBuffer<TYPE>::empty(options));
+        FOR_LEAF_DTYPES(LEAF_CASE)
+        #undef LEAF_CASE
+        default:
+          return std::shared_ptr<void>(nullptr);
+      }
+    }
+
+    template <typename X>
+    void
+    leaf_append(util::dtype dtype, const std::shared_ptr<void>& data, X x) {
+      switch (dtype) {
+        #define LEAF_CASE(DTYPE, TYPE)                                        \
+          case DTYPE:                                                         \
+            leaf_buffer<TYPE>(data)->append((TYPE)x);                         \
+            break;
+        FOR_LEAF_DTYPES(LEAF_CASE)
+        #undef LEAF_CASE
+        default:
+          break;
+      }
+    }
+
+    void
+    leaf_clear(util::dtype dtype, const std::shared_ptr<void>& data) {
+      switch (dtype) {
+        #define LEAF_CASE(DTYPE, TYPE)                                        \
+          case DTYPE:                                                         \
+            leaf_buffer<TYPE>(data)->clear();                                 \
+            break;
+        FOR_LEAF_DTYPES(LEAF_CASE)
+        #undef LEAF_CASE
+        default:
+          break;
+      }
+    }
+
+    std::shared_ptr<void>
+    leaf_ptr(util::dtype dtype, const std::shared_ptr<void>& data) {
+      switch (dtype) {
+        #define LEAF_CASE(DTYPE, TYPE)                                        \
+          case DTYPE:                                                         \
+            return leaf_buffer<TYPE>(data)->ptr();
+        FOR_LEAF_DTYPES(LEAF_CASE)
+        #undef LEAF_CASE
+        default:
+          return std::shared_ptr<void>(nullptr);
+      }
+    }
+
+    #undef FOR_LEAF_DTYPES
+  }
+
+  TypedArrayBuilder::Node::Node(const FormPtr& form,
+                                Kind kind,
+                                const ArrayBuilderOptions& options)
+      : form(form)
+      , kind(kind)
+      , length(0)
+      , dtype(util::dtype::NOT_PRIMITIVE)
+      , data(nullptr)
+      , index(GrowableBuffer<int64_t>::empty(options))
+      , size(0)
+      , istuple(false) { }
+
+  TypedArrayBuilder::TypedArrayBuilder(const FormPtr& form,
+                                       const ArrayBuilderOptions& options)
+      : options_(options)
+      , form_(form)
+      , length_(0) {
+    add_node(form);
+    clear();
+  }
+
+  int64_t
+  TypedArrayBuilder::add_node(const FormPtr& form) {
+    int64_t out = (int64_t)nodes_.size();
+
+    if (NumpyForm* raw = dynamic_cast<NumpyForm*>(form.get())) {
+      if (!raw->inner_shape().empty()  ||  !is_leaf_dtype(raw->dtype())) {
+        throw std::invalid_argument(
+          std::string("TypedArrayBuilder only supports one-dimensional "
+                      "NumpyForms of booleans and numbers, not ")
+          + form.get()->tostring() + FILENAME(__LINE__));
+      }
+      nodes_.push_back(Node(form, Kind::numpy, options_));
+      nodes_.back().dtype = raw->dtype();
+      nodes_.back().data = make_leaf(raw->dtype(), options_);
+    }
+
+    else if (ListOffsetForm* raw = dynamic_cast<ListOffsetForm*>(form.get())) {
+      if (raw->offsets() != Index::Form::i64) {
+        throw std::invalid_argument(
+          std::string("TypedArrayBuilder only supports ListOffsetForms with "
+                      "64-bit offsets") + FILENAME(__LINE__));
+      }
+      nodes_.push_back(Node(form, Kind::listoffset, options_));
+      int64_t content = add_node(raw->content());
+      nodes_[(size_t)out].contents.push_back(content);
+    }
+
+    else if (RegularForm* raw = dynamic_cast<RegularForm*>(form.get())) {
+      nodes_.push_back(Node(form, Kind::regular, options_));
+      nodes_.back().size = raw->size();
+      int64_t content = add_node(raw->content());
+      nodes_[(size_t)out].contents.push_back(content);
+    }
+
+    else if (RecordForm* raw = dynamic_cast<RecordForm*>(form.get())) {
+      nodes_.push_back(Node(form, Kind::record, options_));
+      nodes_.back().size = raw->numfields();
+      nodes_.back().istuple = raw->istuple();
+      if (!raw->istuple()) {
+        for (int64_t i = 0;  i < raw->numfields();  i++) {
+          nodes_.back().keys[raw->key(i)] = i;
+        }
+      }
+      for (auto content : raw->contents()) {
+        int64_t child = add_node(content);
+        nodes_[(size_t)out].contents.push_back(child);
+      }
+    }
+
+    else if (IndexedOptionForm* raw =
+                 dynamic_cast<IndexedOptionForm*>(form.get())) {
+      if (raw->index() != Index::Form::i64) {
+        throw std::invalid_argument(
+          std::string("TypedArrayBuilder only supports IndexedOptionForms "
+                      "with a 64-bit index") + FILENAME(__LINE__));
+      }
+      nodes_.push_back(Node(form, Kind::indexedoption, options_));
+      int64_t content = add_node(raw->content());
+      nodes_[(size_t)out].contents.push_back(content);
+    }
+
+    else {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder does not support ")
+        + form.get()->tostring() + FILENAME(__LINE__));
+    }
+
+    return out;
+  }
+
+  const FormPtr
+  TypedArrayBuilder::form() const {
+    return form_;
+  }
+
+  const std::string
+  TypedArrayBuilder::tostring() const {
+    std::stringstream out;
+    out << "<TypedArrayBuilder length=\"" << length() << "\" form=\""
+        << form_.get()->tojson(false, false) << "\"/>";
+    return out.str();
+  }
+
+  int64_t
+  TypedArrayBuilder::length() const {
+    return length_;
+  }
+
+  void
+  TypedArrayBuilder::clear() {
+    for (auto& node : nodes_) {
+      node.length = 0;
+      node.index.clear();
+      if (node.kind == Kind::numpy) {
+        leaf_clear(node.dtype, node.data);
+      }
+      else if (node.kind == Kind::listoffset) {
+        node.index.append(0);
+      }
+    }
+    frames_.clear();
+    length_ = 0;
+  }
+
+  const ContentPtr
+  TypedArrayBuilder::snapshot() const {
+    return snapshot_node(0, length_);
+  }
+
+  const ContentPtr
+  TypedArrayBuilder::snapshot_node(int64_t node, int64_t length) const {
+    const Node& self = nodes_[(size_t)node];
+    const util::Parameters& parameters = self.form.get()->parameters();
+
+    switch (self.kind) {
+      case Kind::numpy: {
+        ssize_t itemsize = (ssize_t)util::dtype_to_itemsize(self.dtype);
+        std::vector<ssize_t> shape = { (ssize_t)length };
+        std::vector<ssize_t> strides = { itemsize };
+        return std::make_shared<NumpyArray>(Identities::none(),
+                                            parameters,
+                                            leaf_ptr(self.dtype, self.data),
+                                            shape,
+                                            strides,
+                                            0,
+                                            itemsize,
+                                            util::dtype_to_format(self.dtype),
+                                            self.dtype,
+                                            kernel::lib::cpu);
+      }
+
+      case Kind::listoffset: {
+        Index64 offsets(self.index.ptr(), 0, length + 1, kernel::lib::cpu);
+        int64_t contentlength = self.index.getitem_at_nowrap(length);
+        return std::make_shared<ListOffsetArray64>(
+          Identities::none(),
+          parameters,
+          offsets,
+          snapshot_node(self.contents[0], contentlength));
+      }
+
+      case Kind::regular: {
+        return std::make_shared<RegularArray>(
+          Identities::none(),
+          parameters,
+          snapshot_node(self.contents[0], length * self.size),
+          self.size,
+          length);
+      }
+
+      case Kind::record: {
+        ContentPtrVec contents;
+        for (auto content : self.contents) {
+          contents.push_back(snapshot_node(content, length));
+        }
+        RecordForm* raw = dynamic_cast<RecordForm*>(self.form.get());
+        std::vector<ArrayCachePtr> caches;  // nothing is virtual here
+        return std::make_shared<RecordArray>(Identities::none(),
+                                             parameters,
+                                             contents,
+                                             raw->recordlookup(),
+                                             length,
+                                             caches);
+      }
+
+      default: {   // Kind::indexedoption
+        // Every index up to 'length' points to a complete item.
+        Index64 index(self.index.ptr(), 0, length, kernel::lib::cpu);
+        int64_t content = self.contents[0];
+        return std::make_shared<IndexedOptionArray64>(
+          Identities::none(),
+          parameters,
+          index,
+          snapshot_node(content, nodes_[(size_t)content].length));
+      }
+    }
+  }
+
+  const std::string
+  TypedArrayBuilder::wrong_form(const char* command, int64_t node) const {
+    return std::string("TypedArrayBuilder cannot '") + command
+           + std::string("' where the form is ")
+           + nodes_[(size_t)node].form.get()->tojson(false, false);
+  }
+
+  int64_t
+  TypedArrayBuilder::next_node(const char* command) {
+    if (frames_.empty()) {
+      return 0;
+    }
+    const Frame& frame = frames_.back();
+    const Node& parent = nodes_[(size_t)frame.node];
+    if (parent.kind != Kind::record) {
+      return parent.contents[0];
+    }
+    if (frame.at == -1) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called '") + command
+        + std::string("' in a ") + (parent.istuple ? "tuple" : "record")
+        + std::string(" without first selecting a ")
+        + (parent.istuple ? "slot with 'index'" : "field with 'field'")
+        + FILENAME(__LINE__));
+    }
+    int64_t out = parent.contents[(size_t)frame.at];
+    if (nodes_[(size_t)out].length != parent.length) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called '") + command
+        + std::string("' for ") + (parent.istuple ? "slot " : "field ")
+        + std::to_string(frame.at) + std::string(", which is already filled")
+        + FILENAME(__LINE__));
+    }
+    return out;
+  }
+
+  int64_t
+  TypedArrayBuilder::content_node(int64_t node) const {
+    while (nodes_[(size_t)node].kind == Kind::indexedoption) {
+      node = nodes_[(size_t)node].contents[0];
+    }
+    return node;
+  }
+
+  void
+  TypedArrayBuilder::fill_options(int64_t node) {
+    while (nodes_[(size_t)node].kind == Kind::indexedoption) {
+      Node& option = nodes_[(size_t)node];
+      node = option.contents[0];
+      option.index.append(nodes_[(size_t)node].length);
+      option.length++;
+    }
+  }
+
+  void
+  TypedArrayBuilder::maybe_complete() {
+    if (frames_.empty()) {
+      length_++;
+    }
+  }
+
+  void
+  TypedArrayBuilder::null() {
+    int64_t node = next_node("null");
+    Node& option = nodes_[(size_t)node];
+    if (option.kind != Kind::indexedoption) {
+      throw std::invalid_argument(wrong_form("null", node) + FILENAME(__LINE__));
+    }
+    option.index.append(-1);
+    option.length++;
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::boolean(bool x) {
+    int64_t start = next_node("boolean");
+    int64_t node = content_node(start);
+    Node& leaf = nodes_[(size_t)node];
+    if (leaf.kind != Kind::numpy  ||  leaf.dtype != util::dtype::boolean) {
+      throw std::invalid_argument(wrong_form("boolean", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    leaf_buffer<bool>(leaf.data)->append(x);
+    leaf.length++;
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::integer(int64_t x) {
+    int64_t start = next_node("integer");
+    int64_t node = content_node(start);
+    Node& leaf = nodes_[(size_t)node];
+    if (leaf.kind != Kind::numpy  ||  leaf.dtype == util::dtype::boolean) {
+      throw std::invalid_argument(wrong_form("integer", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    leaf_append(leaf.dtype, leaf.data, x);
+    leaf.length++;
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::real(double x) {
+    int64_t start = next_node("real");
+    int64_t node = content_node(start);
+    Node& leaf = nodes_[(size_t)node];
+    if (leaf.kind != Kind::numpy  ||  !is_float_dtype(leaf.dtype)) {
+      throw std::invalid_argument(wrong_form("real", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    leaf_append(leaf.dtype, leaf.data, x);
+    leaf.length++;
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::string(const char* x, int64_t length) {
+    int64_t start = next_node("string");
+    int64_t node = content_node(start);
+    Node& list = nodes_[(size_t)node];
+    Node* leaf = nullptr;
+    if (list.kind == Kind::listoffset) {
+      leaf = &nodes_[(size_t)list.contents[0]];
+    }
+    if (leaf == nullptr  ||  leaf->kind != Kind::numpy  ||
+        (leaf->dtype != util::dtype::uint8  &&
+         leaf->dtype != util::dtype::int8)) {
+      throw std::invalid_argument(wrong_form("string", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    // uint8 and int8 buffers have the same layout; copy the bytes at once.
+    leaf_buffer<uint8_t>(leaf->data)->extend(
+      reinterpret_cast<const uint8_t*>(x), length);
+    leaf->length += length;
+    list.index.append(leaf->length);
+    list.length++;
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::string(const std::string& x) {
+    string(x.c_str(), (int64_t)x.length());
+  }
+
+  void
+  TypedArrayBuilder::beginlist() {
+    int64_t start = next_node("begin_list");
+    int64_t node = content_node(start);
+    const Node& list = nodes_[(size_t)node];
+    if (list.kind != Kind::listoffset  &&  list.kind != Kind::regular) {
+      throw std::invalid_argument(wrong_form("begin_list", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    frames_.push_back({ node, nodes_[(size_t)list.contents[0]].length });
+  }
+
+  void
+  TypedArrayBuilder::endlist() {
+    if (frames_.empty()  ||
+        nodes_[(size_t)frames_.back().node].kind == Kind::record) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'end_list' without "
+                    "'begin_list' at the same level before it")
+        + FILENAME(__LINE__));
+    }
+    const Frame& frame = frames_.back();
+    Node& list = nodes_[(size_t)frame.node];
+    int64_t contentlength = nodes_[(size_t)list.contents[0]].length;
+    if (list.kind == Kind::listoffset) {
+      list.index.append(contentlength);
+    }
+    else if (contentlength - frame.at != list.size) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'end_list' after ")
+        + std::to_string(contentlength - frame.at)
+        + std::string(" items for a RegularForm of size ")
+        + std::to_string(list.size) + FILENAME(__LINE__));
+    }
+    list.length++;
+    frames_.pop_back();
+    maybe_complete();
+  }
+
+  void
+  TypedArrayBuilder::begintuple(int64_t numfields) {
+    int64_t start = next_node("begin_tuple");
+    int64_t node = content_node(start);
+    const Node& tuple = nodes_[(size_t)node];
+    if (tuple.kind != Kind::record  ||  !tuple.istuple  ||
+        tuple.size != numfields) {
+      throw std::invalid_argument(
+        wrong_form("begin_tuple", node) + std::string(" (with ")
+        + std::to_string(numfields) + std::string(" fields)")
+        + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    frames_.push_back({ node, -1 });
+  }
+
+  void
+  TypedArrayBuilder::index(int64_t index) {
+    if (frames_.empty()  ||
+        nodes_[(size_t)frames_.back().node].kind != Kind::record  ||
+        !nodes_[(size_t)frames_.back().node].istuple) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'index' without "
+                    "'begin_tuple' at the same level before it")
+        + FILENAME(__LINE__));
+    }
+    Frame& frame = frames_.back();
+    if (index < 0  ||  index >= nodes_[(size_t)frame.node].size) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'index' with ")
+        + std::to_string(index) + std::string(" for a tuple with ")
+        + std::to_string(nodes_[(size_t)frame.node].size)
+        + std::string(" fields") + FILENAME(__LINE__));
+    }
+    frame.at = index;
+  }
+
+  void
+  TypedArrayBuilder::endtuple() {
+    endrecord_or_tuple(true);
+  }
+
+  void
+  TypedArrayBuilder::beginrecord() {
+    int64_t start = next_node("begin_record");
+    int64_t node = content_node(start);
+    const Node& record = nodes_[(size_t)node];
+    if (record.kind != Kind::record  ||  record.istuple) {
+      throw std::invalid_argument(wrong_form("begin_record", node) + FILENAME(__LINE__));
+    }
+    fill_options(start);
+    frames_.push_back({ node, -1 });
+  }
+
+  void
+  TypedArrayBuilder::field(int64_t fieldindex) {
+    if (frames_.empty()  ||
+        nodes_[(size_t)frames_.back().node].kind != Kind::record  ||
+        nodes_[(size_t)frames_.back().node].istuple) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'field' without "
+                    "'begin_record' at the same level before it")
+        + FILENAME(__LINE__));
+    }
+    Frame& frame = frames_.back();
+    if (fieldindex < 0  ||  fieldindex >= nodes_[(size_t)frame.node].size) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'field' with index ")
+        + std::to_string(fieldindex) + std::string(" for a record with ")
+        + std::to_string(nodes_[(size_t)frame.node].size)
+        + std::string(" fields") + FILENAME(__LINE__));
+    }
+    frame.at = fieldindex;
+  }
+
+  void
+  TypedArrayBuilder::field(const std::string& key) {
+    if (frames_.empty()  ||
+        nodes_[(size_t)frames_.back().node].kind != Kind::record) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'field' without "
+                    "'begin_record' at the same level before it")
+        + FILENAME(__LINE__));
+    }
+    const Node& record = nodes_[(size_t)frames_.back().node];
+    auto found = record.keys.find(key);
+    if (found == record.keys.end()) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called 'field' with key ")
+        + util::quote(key) + std::string(", which is not in ")
+        + record.form.get()->tojson(false, false) + FILENAME(__LINE__));
+    }
+    field(found->second);
+  }
+
+  void
+  TypedArrayBuilder::endrecord() {
+    endrecord_or_tuple(false);
+  }
+
+  void
+  TypedArrayBuilder::endrecord_or_tuple(bool istuple) {
+    if (frames_.empty()  ||
+        nodes_[(size_t)frames_.back().node].kind != Kind::record  ||
+        nodes_[(size_t)frames_.back().node].istuple != istuple) {
+      throw std::invalid_argument(
+        std::string("TypedArrayBuilder called ")
+        + (istuple ? "'end_tuple' without 'begin_tuple'"
+                   : "'end_record' without 'begin_record'")
+        + std::string(" at the same level before it") + FILENAME(__LINE__));
+    }
+    Node& record = nodes_[(size_t)frames_.back().node];
+    for (size_t i = 0;  i < record.contents.size();  i++) {
+      if (nodes_[(size_t)record.contents[i]].length != record.length + 1) {
+        throw std::invalid_argument(
+          std::string("TypedArrayBuilder called ")
+          + (istuple ? "'end_tuple' before filling slot "
+                     : "'end_record' before filling field ")
+          + std::to_string(i) + FILENAME(__LINE__));
+      }
+    }
+    record.length++;
+    frames_.pop_back();
+    maybe_complete();
+  }
+}
+
+uint8_t awkward_TypedArrayBuilder_length(void* typedarraybuilder,
+                                         int64_t* result) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    *result = obj->length();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_clear(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->clear();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_null(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->null();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_boolean(void* typedarraybuilder,
+                                          bool x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->boolean(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_integer(void* typedarraybuilder,
+                                          int64_t x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->integer(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_real(void* typedarraybuilder,
+                                       double x) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->real(x);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_beginlist(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->beginlist();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endlist(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endlist();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_begintuple(void* typedarraybuilder,
+                                             int64_t numfields) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->begintuple(numfields);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_index(void* typedarraybuilder,
+                                        int64_t index) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->index(index);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endtuple(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endtuple();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_beginrecord(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->beginrecord();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_field(void* typedarraybuilder,
+                                        int64_t fieldindex) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->field(fieldindex);
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t awkward_TypedArrayBuilder_endrecord(void* typedarraybuilder) {
+  awkward::TypedArrayBuilder* obj =
+    reinterpret_cast<awkward::TypedArrayBuilder*>(typedarraybuilder);
+  try {
+    obj->endrecord();
+  }
+  catch (...) {
+    return 1;
+  }
+  return 0;
+}
@@ -2,6 +2,20 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/forth/ForthInputBuffer.cpp", line)
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _MSC_VER
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "awkward/kernel-dispatch.h"
+
 #include "awkward/forth/ForthInputBuffer.h"
 
 namespace awkward {
@@ -11,17 +25,217 @@ namespace awkward {
     : ptr_(ptr)
     , offset_(offset)
     , length_(length)
-    , pos_(0) { }
+    , pos_(0)
+    , capacity_(0)
+    , base_(0)
+    , exhausted_(true) { }
+
+  namespace {
+#ifndef _MSC_VER
+    /// @brief Used as a `std::shared_ptr` deleter to unmap a file.
+    class munmap_deleter {
+    public:
+      munmap_deleter(void* address, size_t length)
+          : address_(address)
+          , length_(length) { }
+
+      void operator()(void const* ptr) {
+        munmap(address_, length_);
+      }
+
+    private:
+      void* address_;
+      size_t length_;
+    };
+#endif
+
+    /// @brief Checks the requested byte range against the file size and
+    /// returns its length.
+    int64_t
+    range_length(const std::string& filename,
+                 int64_t filesize,
+                 int64_t offset,
+                 int64_t length) {
+      if (offset < 0  ||  offset > filesize) {
+        throw std::invalid_argument(
+          std::string("offset ") + std::to_string(offset)
+          + std::string(" is beyond the end of file \"") + filename
+          + std::string("\"") + FILENAME(__LINE__));
+      }
+      if (length < 0) {
+        return filesize - offset;
+      }
+      if (offset + length > filesize) {
+        throw std::invalid_argument(
+          std::string("offset + length ") + std::to_string(offset + length)
+          + std::string(" is beyond the end of file \"") + filename
+          + std::string("\"") + FILENAME(__LINE__));
+      }
+      return length;
+    }
+  }
+
+  ForthInputBuffer::ForthInputBuffer(const std::string& filename,
+                                     int64_t offset,
+                                     int64_t length)
+    : ptr_(nullptr)
+    , offset_(0)
+    , length_(0)
+    , pos_(0)
+    , capacity_(0)
+    , base_(0)
+    , exhausted_(true) {
+#ifndef _MSC_VER
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+      throw std::invalid_argument(
+        std::string("file \"") + filename
+        + std::string("\" could not be opened for reading") + FILENAME(__LINE__));
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+      close(fd);
+      throw std::invalid_argument(
+        std::string("file \"") + filename
+        + std::string("\" could not be inspected") + FILENAME(__LINE__));
+    }
+    try {
+      length_ = range_length(filename, (int64_t)info.st_size, offset, length);
+    }
+    catch (...) {
+      close(fd);
+      throw;
+    }
+
+    if (length_ == 0) {
+      close(fd);
+      ptr_ = kernel::malloc<void>(kernel::lib::cpu, 0);
+      return;
+    }
+
+    // mmap offsets must be page-aligned: map from the page that contains
+    // `offset` and start reading partway into it.
+    int64_t pagesize = (int64_t)sysconf(_SC_PAGESIZE);
+    int64_t aligned = (offset / pagesize) * pagesize;
+    offset_ = offset - aligned;
+    size_t maplength = (size_t)(offset_ + length_);
+    void* address = mmap(nullptr,
+                         maplength,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE,
+                         fd,
+                         (off_t)aligned);
+    close(fd);
+    if (address == MAP_FAILED) {
+      throw std::invalid_argument(
+        std::string("file \"") + filename
+        + std::string("\" could not be memory-mapped") + FILENAME(__LINE__));
+    }
+    madvise(address, maplength, MADV_SEQUENTIAL);
+    ptr_ = std::shared_ptr<void>(address, munmap_deleter(address, maplength));
+#else
+    FILE* file;
+    if (fopen_s(&file, filename.c_str(), "rb") != 0) {
+      throw std::invalid_argument(
+        std::string("file \"") + filename
+        + std::string("\" could not be opened for reading") + FILENAME(__LINE__));
+    }
+    _fseeki64(file, 0, SEEK_END);
+    int64_t filesize = (int64_t)_ftelli64(file);
+    try {
+      length_ = range_length(filename, filesize, offset, length);
+    }
+    catch (...) {
+      fclose(file);
+      throw;
+    }
+    ptr_ = kernel::malloc<void>(kernel::lib::cpu, length_);
+    _fseeki64(file, offset, SEEK_SET);
+    size_t num_read = fread(ptr_.get(), 1, (size_t)length_, file);
+    fclose(file);
+    if ((int64_t)num_read != length_) {
+      throw std::invalid_argument(
+        std::string("file \"") + filename
+        + std::string("\" could not be read") + FILENAME(__LINE__));
+    }
+#endif
+  }
+
+  ForthInputBuffer::ForthInputBuffer(
+    const std::function<int64_t(void* buffer, int64_t num_bytes)>& source,
+    int64_t chunk_size)
+    : ptr_(nullptr)
+    , offset_(0)
+    , length_(0)
+    , pos_(0)
+    , source_(source)
+    , capacity_(chunk_size)
+    , base_(0)
+    , exhausted_(false) {
+    if (chunk_size <= 0) {
+      throw std::invalid_argument(
+        std::string("chunk_size must be positive, not ")
+        + std::to_string(chunk_size) + FILENAME(__LINE__));
+    }
+    ptr_ = kernel::malloc<void>(kernel::lib::cpu, chunk_size);
+  }
+
+  bool
+  ForthInputBuffer::refill(int64_t num_bytes) noexcept {
+    if (exhausted_) {
+      return false;
+    }
+    try {
+      // Keep the unread bytes, moving them to the front of the window.
+      uint8_t* data = reinterpret_cast<uint8_t*>(ptr_.get());
+      int64_t unread = length_ - pos_;
+      if (num_bytes > capacity_) {
+        std::shared_ptr<void> ptr = kernel::malloc<void>(kernel::lib::cpu,
+                                                         num_bytes);
+        std::memcpy(ptr.get(), data + (pos_ - base_), (size_t)unread);
+        ptr_ = ptr;
+        capacity_ = num_bytes;
+        data = reinterpret_cast<uint8_t*>(ptr_.get());
+      }
+      else if (pos_ != base_) {
+        std::memmove(data, data + (pos_ - base_), (size_t)unread);
+      }
+      base_ = pos_;
+
+      while (length_ < pos_ + num_bytes) {
+        int64_t filled = length_ - base_;
+        int64_t num_read = source_(data + filled, capacity_ - filled);
+        if (num_read <= 0) {
+          exhausted_ = true;
+          break;
+        }
+        length_ += std::min(num_read, capacity_ - filled);
+      }
+    }
+    catch (...) {
+      source_error_ = std::current_exception();
+      exhausted_ = true;
+    }
+    return length_ >= pos_ + num_bytes;
+  }
+
+  bool
+  ForthInputBuffer::advance(int64_t to) noexcept {
+    // The bytes from #pos on are kept, so that if the source ends before
+    // `to`, the position has not moved and they can still be read.
+    return refill(to - pos_);
+  }
 
   void*
   ForthInputBuffer::read(int64_t num_bytes, util::ForthError& err) noexcept {
     int64_t next = pos_ + num_bytes;
-    if (next > length_) {
+    if (next > length_  &&  !refill(num_bytes)) {
       err = util::ForthError::read_beyond;
       return nullptr;
     }
     void* out = reinterpret_cast<void*>(
-        reinterpret_cast<size_t>(ptr_.get()) + (size_t)offset_ + (size_t)pos_
+        reinterpret_cast<size_t>(ptr_.get()) + (size_t)offset_
+        + (size_t)(pos_ - base_)
     );
     pos_ = next;
     return out;
@@ -29,7 +243,7 @@ namespace awkward {
 
   void
   ForthInputBuffer::seek(int64_t to, util::ForthError& err) noexcept {
-    if (to < 0  ||  to > length_) {
+    if (to < base_  ||  (to > length_  &&  !advance(to))) {
       err = util::ForthError::seek_beyond;
     }
     else {
@@ -40,7 +254,7 @@ namespace awkward {
   void
   ForthInputBuffer::skip(int64_t num_bytes, util::ForthError& err) noexcept {
     int64_t next = pos_ + num_bytes;
-    if (next < 0  ||  next > length_) {
+    if (next < base_  ||  (next > length_  &&  !advance(next))) {
       err = util::ForthError::skip_beyond;
     }
     else {
@@ -49,8 +263,8 @@ namespace awkward {
   }
 
   bool
-  ForthInputBuffer::end() const noexcept {
-    return pos_ == length_;
+  ForthInputBuffer::end() noexcept {
+    return pos_ == length_  &&  !refill(1);
   }
 
   int64_t
@@ -60,7 +274,19 @@ namespace awkward {
 
   int64_t
   ForthInputBuffer::len() const noexcept {
-    return length_;
+    return exhausted_ ? length_ : -1;
+  }
+
+  bool
+  ForthInputBuffer::is_streaming() const noexcept {
+    return (bool)source_;
+  }
+
+  void
+  ForthInputBuffer::maybe_throw() const {
+    if (source_error_) {
+      std::rethrow_exception(source_error_);
+    }
   }
 
 }
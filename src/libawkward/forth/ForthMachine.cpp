@@ -2,10 +2,14 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/forth/ForthMachine.cpp", line)
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 #include <chrono>
 
+#include "awkward/kernel-parallel.h"
+
 #include "awkward/forth/ForthMachine.h"
 
 namespace awkward {
@@ -34,6 +38,11 @@ namespace awkward {
   #define READ_VARINT (0x8 * 14)
   #define READ_ZIGZAG (0x8 * 15)
   #define READ_NBIT (0x8 * 16)
+  // bulk parser modifiers (all require READ_REPEATED and READ_DIRECT)
+  #define READ_ACCUMULATE 0x100
+  #define READ_SPLIT 0x200
+  #define READ_LOOKUP 0x400
+  #define READ_BULK (READ_ACCUMULATE | READ_SPLIT | READ_LOOKUP)
 
   // instructions from special parsing rules
   #define CODE_LITERAL 0
@@ -106,6 +115,23 @@ namespace awkward {
   // beginning of the user-defined dictionary
   #define BOUND_DICTIONARY 66
 
+  // threaded-code instructions (CODE_* instructions stand for themselves)
+  #define THREADED_CALL 66
+  #define THREADED_READ 67
+  #define THREADED_READ_WRITE 68
+  #define THREADED_DO_READ 69
+  #define THREADED_END_SEGMENT 70
+
+  // GCC and Clang can jump straight from each instruction's code to the
+  // next one's through its label address ("computed goto"); other compilers
+  // decode.
+  #if defined(__GNUC__)
+    #define AWKWARD_FORTH_COMPUTED_GOTO
+    #define THREADED_LABEL(code) threaded_##code:
+  #else
+    #define THREADED_LABEL(code)
+  #endif
+
   const std::set<std::string> reserved_words_({
     // comments
     "(", ")", "\\", "\n", "",
@@ -146,7 +172,19 @@ namespace awkward {
     "#f->", "#d->", "#varint->", "#zigzag->",
     // multiple big-endian
     "#!h->", "#!i->", "#!q->", "#!n->", "#!H->", "#!I->", "#!Q->", "#!N->",
-    "#!f->", "#!d->"
+    "#!f->", "#!d->",
+    // bulk running sum (counts to offsets, delta decoding)
+    "#+b->", "#+h->", "#+i->", "#+q->", "#+n->", "#+B->", "#+H->", "#+I->", "#+Q->", "#+N->",
+    "#+varint->", "#+zigzag->",
+    "#!+h->", "#!+i->", "#!+q->", "#!+n->", "#!+H->", "#!+I->", "#!+Q->", "#!+N->",
+    // bulk byte-stream-split
+    "#%h->", "#%i->", "#%q->", "#%n->", "#%H->", "#%I->", "#%Q->", "#%N->", "#%f->", "#%d->",
+    "#!%h->", "#!%i->", "#!%q->", "#!%n->", "#!%H->", "#!%I->", "#!%Q->", "#!%N->",
+    "#!%f->", "#!%d->",
+    // bulk dictionary lookup
+    "#@b->", "#@h->", "#@i->", "#@q->", "#@n->", "#@B->", "#@H->", "#@I->", "#@Q->", "#@N->",
+    "#@varint->",
+    "#!@h->", "#!@i->", "#!@q->", "#!@n->", "#!@H->", "#!@I->", "#!@Q->", "#!@N->"
   });
 
   const std::map<std::string, util::dtype> output_dtype_words_({
@@ -218,7 +256,8 @@ namespace awkward {
                                        int64_t stack_max_depth,
                                        int64_t recursion_max_depth,
                                        int64_t output_initial_size,
-                                       double output_resize_factor)
+                                       double output_resize_factor,
+                                       bool threaded)
     : source_(source)
     , output_initial_size_(output_initial_size)
     , output_resize_factor_(output_resize_factor)
@@ -242,6 +281,7 @@ namespace awkward {
     , do_current_depth_(0)
 
     , current_error_(util::ForthError::none)
+    , threaded_(false)
 
     , count_instructions_(0)
     , count_reads_(0)
@@ -252,8 +292,58 @@ namespace awkward {
     std::vector<std::pair<int64_t, int64_t>> linecol;
     tokenize(tokenized, linecol);
     compile(tokenized, linecol);
+    if (threaded) {
+      thread_bytecodes();
+    }
   }
 
+  template <typename T, typename I>
+  ForthMachineOf<T, I>::ForthMachineOf(const ForthMachineOf<T, I>* program)
+    : source_(program->source_)
+    , output_initial_size_(program->output_initial_size_)
+    , output_resize_factor_(program->output_resize_factor_)
+
+    , stack_buffer_(new T[program->stack_max_depth_])
+    , stack_depth_(0)
+    , stack_max_depth_(program->stack_max_depth_)
+
+    , variable_names_(program->variable_names_)
+    , variables_(program->variables_.size(), 0)
+
+    , input_names_(program->input_names_)
+    , input_must_be_writable_(program->input_must_be_writable_)
+    , output_names_(program->output_names_)
+    , output_dtypes_(program->output_dtypes_)
+
+    , strings_(program->strings_)
+    , dictionary_names_(program->dictionary_names_)
+    , dictionary_bytecodes_(program->dictionary_bytecodes_)
+    , bytecodes_offsets_(program->bytecodes_offsets_)
+    , bytecodes_(program->bytecodes_)
+    , threaded_bytecodes_(program->threaded_bytecodes_)
+
+    , current_inputs_()
+    , current_outputs_()
+    , is_ready_(false)
+
+    , current_which_(new int64_t[program->recursion_max_depth_])
+    , current_where_(new int64_t[program->recursion_max_depth_])
+    , recursion_current_depth_(0)
+    , recursion_max_depth_(program->recursion_max_depth_)
+
+    , do_recursion_depth_(new int64_t[program->recursion_max_depth_])
+    , do_stop_(new int64_t[program->recursion_max_depth_])
+    , do_i_(new int64_t[program->recursion_max_depth_])
+    , do_current_depth_(0)
+
+    , current_error_(util::ForthError::none)
+    , threaded_(program->threaded_)
+
+    , count_instructions_(0)
+    , count_reads_(0)
+    , count_writes_(0)
+    , count_nanoseconds_(0) { }
+
   template <typename T, typename I>
   ForthMachineOf<T, I>::~ForthMachineOf() {
     delete [] stack_buffer_;
@@ -264,6 +354,12 @@ namespace awkward {
     delete [] do_i_;
   }
 
+  template <typename T, typename I>
+  const std::shared_ptr<ForthMachineOf<T, I>>
+  ForthMachineOf<T, I>::copy_program() const {
+    return std::shared_ptr<ForthMachineOf<T, I>>(new ForthMachineOf<T, I>(this));
+  }
+
   template <typename T, typename I>
   const std::string
   ForthMachineOf<T, I>::source() const noexcept {
@@ -370,6 +466,16 @@ namespace awkward {
 
       std::string rep = (~bytecode & READ_REPEATED) ? "#" : "";
       std::string big = ((~bytecode & READ_BIGENDIAN) != 0) ? "!" : "";
+      std::string bulk = "";
+      if (~bytecode & READ_ACCUMULATE) {
+        bulk = "+";
+      }
+      else if (~bytecode & READ_SPLIT) {
+        bulk = "%";
+      }
+      else if (~bytecode & READ_LOOKUP) {
+        bulk = "@";
+      }
       std::string rest;
       int64_t next_pos = 2;
       I nbits = 0;
@@ -425,12 +531,17 @@ namespace awkward {
           rest = std::to_string(nbits) + "bit->";
           break;
       }
-      std::string arrow = rep + big + rest;
+      std::string arrow = rep + big + bulk + rest;
 
       std::string out_name = "stack";
       if (~bytecode & READ_DIRECT) {
         I out_num = bytecodes_[(IndexTypeOf<int64_t>)bytecode_position + (IndexTypeOf<int64_t>)next_pos];
         out_name = output_names_[(IndexTypeOf<int64_t>)out_num];
+        next_pos++;
+      }
+      if (~bytecode & READ_LOOKUP) {
+        I dict_num = bytecodes_[(IndexTypeOf<int64_t>)bytecode_position + (IndexTypeOf<int64_t>)next_pos];
+        out_name += std::string(" ") + output_names_[(IndexTypeOf<int64_t>)dict_num];
       }
       return in_name + std::string(" ") + arrow + std::string(" ") + out_name;
     }
@@ -733,6 +844,12 @@ namespace awkward {
     return output_resize_factor_;
   }
 
+  template <typename T, typename I>
+  bool
+  ForthMachineOf<T, I>::threaded() const noexcept {
+    return threaded_;
+  }
+
   template <typename T, typename I>
   const std::vector<T>
   ForthMachineOf<T, I>::stack() const {
@@ -1210,6 +1327,22 @@ namespace awkward {
     return current_error_;
   }
 
+  template <typename T, typename I>
+  const std::vector<std::shared_ptr<ForthMachineOf<T, I>>>
+  ForthMachineOf<T, I>::run_many(
+      const std::vector<std::map<std::string,
+                                 std::shared_ptr<ForthInputBuffer>>>& inputs,
+      int64_t num_threads) const {
+    std::vector<std::shared_ptr<ForthMachineOf<T, I>>> out;
+    for (size_t i = 0;  i < inputs.size();  i++) {
+      out.push_back(copy_program());
+    }
+    kernel::parallel_tasks((int64_t)inputs.size(), [&](int64_t i) {
+      out[(size_t)i].get()->run(inputs[(size_t)i]);
+    }, num_threads);
+    return out;
+  }
+
   template <typename T, typename I>
   util::ForthError
   ForthMachineOf<T, I>::call(const std::string& name) {
@@ -1258,6 +1391,10 @@ namespace awkward {
   void
   ForthMachineOf<T, I>::maybe_throw(util::ForthError err,
                                     const std::set<util::ForthError>& ignore) const {
+    // A streaming input's source failing is not an AwkwardForth error.
+    for (auto input : current_inputs_) {
+      input.get()->maybe_throw();
+    }
     if (ignore.count(current_error_) == 0) {
       switch (current_error_) {
         case util::ForthError::not_ready: {
@@ -1319,6 +1456,11 @@ namespace awkward {
             "'varint too big' in AwkwardForth runtime: variable-length integer is "
             "greater than 2**63");
         }
+        case util::ForthError::lookup_beyond: {
+          throw std::invalid_argument(
+            "'lookup beyond' in AwkwardForth runtime: an index read by '#@' is "
+            "negative or beyond the end of its dictionary output");
+        }
         default:
           break;
       }
@@ -1527,6 +1669,9 @@ namespace awkward {
       if (~bytecode & READ_DIRECT) {
         total++;
       }
+      if (~bytecode & READ_LOOKUP) {
+        total++;
+      }
       return total;
     }
     else if (bytecode >= BOUND_DICTIONARY  &&
@@ -1736,6 +1881,99 @@ namespace awkward {
     }
   }
 
+  template <typename T, typename I>
+  void
+  ForthMachineOf<T, I>::thread_bytecodes() {
+    // Every position gets the instruction it would be if it were executed,
+    // so that operands (which never are) need not be told apart.
+    threaded_ = true;
+    threaded_bytecodes_.clear();
+    for (IndexTypeOf<int64_t> segment = 0;
+         segment + 1 < bytecodes_offsets_.size();
+         segment++) {
+      for (int64_t i = bytecodes_offsets_[segment];
+           i < bytecodes_offsets_[segment + 1];
+           i++) {
+        I bytecode = bytecodes_[(IndexTypeOf<I>)i];
+        if (bytecode < 0) {
+          threaded_bytecodes_.push_back(THREADED_READ);
+        }
+        else if (bytecode >= BOUND_DICTIONARY) {
+          threaded_bytecodes_.push_back(THREADED_CALL);
+        }
+        else {
+          threaded_bytecodes_.push_back(bytecode);
+        }
+      }
+      threaded_bytecodes_.push_back(THREADED_END_SEGMENT);
+    }
+
+    // Walk the instructions of each segment to find fusable sequences.
+    // Control flow only lands on dictionary calls or on the instruction
+    // after one, never in the middle of these sequences.
+    for (IndexTypeOf<int64_t> segment = 0;
+         segment + 1 < bytecodes_offsets_.size();
+         segment++) {
+      int64_t stop = bytecodes_offsets_[segment + 1];
+      int64_t pos = bytecodes_offsets_[segment];
+      while (pos < stop) {
+        I bytecode = bytecodes_[(IndexTypeOf<I>)pos];
+        int64_t length;
+        if (bytecode < 0) {
+          length = 2;
+          if ((~bytecode & READ_MASK) == READ_NBIT) {
+            length++;
+          }
+          if (~bytecode & READ_DIRECT) {
+            length++;
+          }
+          if (~bytecode & READ_LOOKUP) {
+            length++;
+          }
+        }
+        else if (bytecode >= BOUND_DICTIONARY  ||
+                 bytecode == CODE_IF  ||  bytecode == CODE_IF_ELSE  ||
+                 bytecode == CODE_DO  ||  bytecode == CODE_DO_STEP  ||
+                 bytecode == CODE_AGAIN  ||  bytecode == CODE_UNTIL  ||
+                 bytecode == CODE_WHILE) {
+          length = 1;
+        }
+        else {
+          length = bytecodes_per_instruction(pos);
+        }
+
+        if (bytecode < 0  &&  length == 2  &&
+            (~bytecode & READ_REPEATED) == 0  &&
+            pos + 3 < stop  &&
+            bytecodes_[(IndexTypeOf<I>)pos + 2] == CODE_WRITE) {
+          threaded_bytecodes_[(IndexTypeOf<I>)(pos + (int64_t)segment)] =
+              THREADED_READ_WRITE;
+        }
+
+        else if (bytecode == CODE_DO  &&  pos + 1 < stop  &&
+                 bytecodes_[(IndexTypeOf<I>)pos + 1] >= BOUND_DICTIONARY) {
+          IndexTypeOf<int64_t> body = (IndexTypeOf<int64_t>)(
+              bytecodes_[(IndexTypeOf<I>)pos + 1] - BOUND_DICTIONARY);
+          int64_t start = bytecodes_offsets_[body];
+          I read = bytecodes_[(IndexTypeOf<I>)start];
+          I format = ~read & READ_MASK;
+          if (bytecodes_offsets_[body + 1] - start == 3  &&
+              read < 0  &&
+              (~read & READ_DIRECT) != 0  &&
+              (~read & READ_REPEATED) == 0  &&
+              format != READ_VARINT  &&
+              format != READ_ZIGZAG  &&
+              format != READ_NBIT) {
+            threaded_bytecodes_[(IndexTypeOf<I>)(pos + (int64_t)segment)] =
+                THREADED_DO_READ;
+          }
+        }
+
+        pos += length;
+      }
+    }
+  }
+
   template <typename T, typename I>
   void
   ForthMachineOf<T, I>::parse(const std::string& defn,
@@ -2348,7 +2586,24 @@ namespace awkward {
             parser = parser.substr(1, parser.length() - 1);
           }
 
-          bool must_be_writable = ((bytecode & READ_REPEATED) != 0);
+          if (parser.length() != 0  &&  (bytecode & READ_REPEATED) != 0) {
+            if (parser[0] == '+') {
+              bytecode |= READ_ACCUMULATE;
+            }
+            else if (parser[0] == '%') {
+              bytecode |= READ_SPLIT;
+            }
+            else if (parser[0] == '@') {
+              bytecode |= READ_LOOKUP;
+            }
+            if (bytecode & READ_BULK) {
+              parser = parser.substr(1, parser.length() - 1);
+            }
+          }
+
+          // Bulk reads byte-swap copies, never the input itself.
+          bool must_be_writable = ((bytecode & READ_REPEATED) != 0  &&
+                                   (bytecode & READ_BULK) == 0);
           if (NATIVELY_BIG_ENDIAN) {
             must_be_writable &= ((bytecode & READ_BIGENDIAN) == 0);
           }
@@ -2445,9 +2700,34 @@ namespace awkward {
             );
           }
 
+          if (bytecode & READ_BULK) {
+            I format = bytecode & READ_MASK;
+            bool integer = (format != READ_BOOL  &&
+                            format != READ_FLOAT32  &&
+                            format != READ_FLOAT64  &&
+                            format != READ_NBIT);
+            bool multibyte = (format != READ_BOOL  &&
+                              format != READ_INT8  &&
+                              format != READ_UINT8  &&
+                              format != READ_VARINT  &&
+                              format != READ_ZIGZAG  &&
+                              format != READ_NBIT);
+            if (((bytecode & READ_ACCUMULATE) != 0  &&  !integer)  ||
+                ((bytecode & READ_SPLIT) != 0  &&  !multibyte)  ||
+                ((bytecode & READ_LOOKUP) != 0  &&  (!integer  ||  format == READ_ZIGZAG))) {
+              throw std::invalid_argument(
+                err_linecol(linecol, pos, pos + 3,
+                            "'#+' and '#@' parsers need an integer type and "
+                            "'#%' needs a multi-byte type")
+                + FILENAME(__LINE__)
+              );
+            }
+          }
+
           bool found_output = false;
           IndexTypeOf<I> output_index = 0;
-          if (pos + 2 < stop  &&  tokenized[(IndexTypeOf<std::string>)pos + 2] == "stack") {
+          if (pos + 2 < stop  &&  tokenized[(IndexTypeOf<std::string>)pos + 2] == "stack"  &&
+              (bytecode & READ_BULK) == 0) {
             // not READ_DIRECT
           }
           else if (pos + 2 < stop  &&  is_output(tokenized[(IndexTypeOf<std::string>)pos + 2])) {
@@ -2459,6 +2739,14 @@ namespace awkward {
             }
             bytecode |= READ_DIRECT;
           }
+          else if (bytecode & READ_BULK) {
+            throw std::invalid_argument(
+              err_linecol(linecol, pos, pos + 3,
+                          "missing 'output' after bulk '#*->' (bulk parsers "
+                          "cannot write to the stack)")
+              + FILENAME(__LINE__)
+            );
+          }
           else {
             throw std::invalid_argument(
               err_linecol(linecol, pos, pos + 3,
@@ -2467,6 +2755,32 @@ namespace awkward {
             );
           }
 
+          IndexTypeOf<I> dictionary_index = 0;
+          if (bytecode & READ_LOOKUP) {
+            if (pos + 3 < stop  &&  is_output(tokenized[(IndexTypeOf<std::string>)pos + 3])) {
+              for (;  dictionary_index < output_names_.size();  dictionary_index++) {
+                if (output_names_[dictionary_index] == tokenized[(IndexTypeOf<std::string>)pos + 3]) {
+                  break;
+                }
+              }
+            }
+            else {
+              throw std::invalid_argument(
+                err_linecol(linecol, pos, pos + 4,
+                            "missing dictionary 'output' after '#@*-> output'")
+                + FILENAME(__LINE__)
+              );
+            }
+            if (output_dtypes_[dictionary_index] != output_dtypes_[output_index]) {
+              throw std::invalid_argument(
+                err_linecol(linecol, pos, pos + 4,
+                            "dictionary output must have the same type as the "
+                            "output it is looked up into")
+                + FILENAME(__LINE__)
+              );
+            }
+          }
+
           // Parser instructions are bit-flipped to detect them by the sign bit.
           bytecodes.push_back(~bytecode);
           bytecodes.push_back((int32_t)input_index);
@@ -2476,6 +2790,10 @@ namespace awkward {
           if (found_output) {
             bytecodes.push_back((int32_t)output_index);
           }
+          if (bytecode & READ_LOOKUP) {
+            bytecodes.push_back((int32_t)dictionary_index);
+            pos++;
+          }
 
           pos += 3;
         }
@@ -2649,12 +2967,110 @@ namespace awkward {
   template <typename T, typename I>
   void
   ForthMachineOf<T, I>::internal_run(bool single_step, int64_t recursion_target_depth_top) { // noexcept
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+    // Indexed by threaded-code instruction: CODE_*, then THREADED_*.
+    static void* const dispatch_table[] = {
+      &&threaded_CODE_LITERAL,
+      &&threaded_CODE_HALT,
+      &&threaded_CODE_PAUSE,
+      &&threaded_CODE_IF,
+      &&threaded_CODE_IF_ELSE,
+      &&threaded_CODE_DO,
+      &&threaded_CODE_DO_STEP,
+      &&threaded_CODE_AGAIN,
+      &&threaded_CODE_UNTIL,
+      &&threaded_CODE_WHILE,
+      &&threaded_CODE_EXIT,
+      &&threaded_CODE_PUT,
+      &&threaded_CODE_INC,
+      &&threaded_CODE_GET,
+      &&threaded_CODE_LEN_INPUT,
+      &&threaded_CODE_POS,
+      &&threaded_CODE_END,
+      &&threaded_CODE_SEEK,
+      &&threaded_CODE_SKIP,
+      &&threaded_CODE_WRITE,
+      &&threaded_CODE_WRITE_ADD,
+      &&threaded_CODE_WRITE_DUP,
+      &&threaded_CODE_LEN_OUTPUT,
+      &&threaded_CODE_REWIND,
+      &&threaded_CODE_STRING,
+      &&threaded_CODE_PRINT_STRING,
+      &&threaded_CODE_PRINT,
+      &&threaded_CODE_PRINT_CR,
+      &&threaded_CODE_PRINT_STACK,
+      &&threaded_CODE_I,
+      &&threaded_CODE_J,
+      &&threaded_CODE_K,
+      &&threaded_CODE_DUP,
+      &&threaded_CODE_DROP,
+      &&threaded_CODE_SWAP,
+      &&threaded_CODE_OVER,
+      &&threaded_CODE_ROT,
+      &&threaded_CODE_NIP,
+      &&threaded_CODE_TUCK,
+      &&threaded_CODE_ADD,
+      &&threaded_CODE_SUB,
+      &&threaded_CODE_MUL,
+      &&threaded_CODE_DIV,
+      &&threaded_CODE_MOD,
+      &&threaded_CODE_DIVMOD,
+      &&threaded_CODE_NEGATE,
+      &&threaded_CODE_ADD1,
+      &&threaded_CODE_SUB1,
+      &&threaded_CODE_ABS,
+      &&threaded_CODE_MIN,
+      &&threaded_CODE_MAX,
+      &&threaded_CODE_EQ,
+      &&threaded_CODE_NE,
+      &&threaded_CODE_GT,
+      &&threaded_CODE_GE,
+      &&threaded_CODE_LT,
+      &&threaded_CODE_LE,
+      &&threaded_CODE_EQ0,
+      &&threaded_CODE_INVERT,
+      &&threaded_CODE_AND,
+      &&threaded_CODE_OR,
+      &&threaded_CODE_XOR,
+      &&threaded_CODE_LSHIFT,
+      &&threaded_CODE_RSHIFT,
+      &&threaded_CODE_FALSE,
+      &&threaded_CODE_TRUE,
+      &&threaded_call,
+      &&threaded_read,
+      &&threaded_read_write,
+      &&threaded_do_read,
+      &&threaded_end_segment
+    };
+#endif
+    bool use_threaded = threaded_  &&  !single_step;
+
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+    if (use_threaded  &&  threaded_code_.empty()) {
+      threaded_code_.reserve(threaded_bytecodes_.size());
+      for (IndexTypeOf<int64_t> segment = 0;
+           segment + 1 < bytecodes_offsets_.size();
+           segment++) {
+        int64_t start = bytecodes_offsets_[segment];
+        int64_t stop = bytecodes_offsets_[segment + 1];
+        for (int64_t i = start;  i <= stop;  i++) {
+          I instruction = threaded_bytecodes_[(IndexTypeOf<I>)(i + (int64_t)segment)];
+          I bytecode = (i < stop ? bytecodes_[(IndexTypeOf<I>)i] : 0);
+          threaded_code_.push_back({ dispatch_table[instruction], bytecode });
+        }
+      }
+    }
+#endif
+
     while (recursion_current_depth_ != recursion_target_depth_top) {
       while (bytecodes_pointer_where() < (
                  bytecodes_offsets_[(IndexTypeOf<int64_t>)bytecodes_pointer_which() + 1] -
                  bytecodes_offsets_[(IndexTypeOf<int64_t>)bytecodes_pointer_which()]
              )) {
-        I bytecode = bytecode_get();
+        int64_t position =
+            bytecodes_offsets_[(IndexTypeOf<int64_t>)bytecodes_pointer_which()] +
+            bytecodes_pointer_where();
+        I bytecode = bytecodes_[(IndexTypeOf<I>)position];
 
         if (do_current_depth_ == 0  ||
             do_abs_recursion_depth() != recursion_current_depth_) {
@@ -2669,7 +3085,70 @@ namespace awkward {
         }
         // else... don't increase bytecode_pointer_where()
 
+        if (use_threaded) {
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+          goto *threaded_code_[(IndexTypeOf<int64_t>)(
+                   position + bytecodes_pointer_which())].label;
+
+        threaded_next:
+          // Direct-threaded dispatch: every instruction but 'do' (and those
+          // that end the run) comes here, without the bounds and 'do' checks
+          // above; a segment's last instruction is followed by an
+          // end-of-segment instruction that does them.
+          {
+            int64_t which = bytecodes_pointer_which();
+            position = bytecodes_offsets_[(IndexTypeOf<int64_t>)which] +
+                       bytecodes_pointer_where()++;
+            const ThreadedInstruction& next =
+                threaded_code_[(IndexTypeOf<int64_t>)(position + which)];
+            bytecode = next.bytecode;
+            goto *next.label;
+          }
+
+        threaded_end_segment:
+          goto after_end_of_segment;
+
+        threaded_read_write:
+          if (read_write_fused(position)) {
+            if (current_error_ != util::ForthError::none) {
+              return;
+            }
+            goto threaded_next;
+          }
+          goto threaded_read;
+
+        threaded_do_read:
+          if (do_read_fused(position)) {
+            if (current_error_ != util::ForthError::none) {
+              return;
+            }
+            goto threaded_next;
+          }
+          goto threaded_CODE_DO;
+#else
+          I instruction = threaded_bytecodes_[(IndexTypeOf<I>)(
+              position + bytecodes_pointer_which())];
+          if (instruction == THREADED_READ_WRITE) {
+            if (read_write_fused(position)) {
+              if (current_error_ != util::ForthError::none) {
+                return;
+              }
+              continue;
+            }
+          }
+          else if (instruction == THREADED_DO_READ) {
+            if (do_read_fused(position)) {
+              if (current_error_ != util::ForthError::none) {
+                return;
+              }
+              continue;
+            }
+          }
+#endif
+        }
+
         if (bytecode < 0) {
+          THREADED_LABEL(read)
           bool byteswap;
           if (NATIVELY_BIG_ENDIAN) {
             byteswap = ((~bytecode & READ_BIGENDIAN) == 0);
@@ -2692,7 +3171,23 @@ namespace awkward {
 
           I format = ~bytecode & READ_MASK;
 
-          if (format == READ_VARINT) {
+          if (~bytecode & READ_BULK) {
+            I out_num = bytecode_get();
+            bytecodes_pointer_where()++;
+            I dict_num = 0;
+            if (~bytecode & READ_LOOKUP) {
+              dict_num = bytecode_get();
+              bytecodes_pointer_where()++;
+            }
+            read_bulk(~bytecode, in_num, out_num, dict_num, num_items, byteswap);
+            if (current_error_ != util::ForthError::none) {
+              return;
+            }
+
+            count_writes_++;
+          }
+
+          else if (format == READ_VARINT) {
             ForthInputBuffer* input = current_inputs_[(IndexTypeOf<int64_t>)in_num].get();
             ForthOutputBuffer* output = nullptr;
             if (~bytecode & READ_DIRECT) {
@@ -2978,6 +3473,7 @@ namespace awkward {
         } // end if bytecode < 0
 
         else if (bytecode >= BOUND_DICTIONARY) {
+          THREADED_LABEL(call)
           if (recursion_current_depth_ == recursion_max_depth_) {
             current_error_ = util::ForthError::recursion_depth_exceeded;
             return;
@@ -2988,6 +3484,7 @@ namespace awkward {
         else {
           switch (bytecode) {
             case CODE_LITERAL: {
+              THREADED_LABEL(CODE_LITERAL)
               I num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -2999,6 +3496,7 @@ namespace awkward {
             }
 
             case CODE_HALT: {
+              THREADED_LABEL(CODE_HALT)
               is_ready_ = false;
               recursion_current_depth_ = 0;
               while (recursion_target_depth_.size() > 1) {
@@ -3013,6 +3511,7 @@ namespace awkward {
             }
 
             case CODE_PAUSE: {
+              THREADED_LABEL(CODE_PAUSE)
               // In case of 'do ... pause loop/+loop', update the do-stack.
               if (is_segment_done()) {
                 bytecodes_pointer_pop();
@@ -3039,6 +3538,7 @@ namespace awkward {
             }
 
             case CODE_IF: {
+              THREADED_LABEL(CODE_IF)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3051,6 +3551,7 @@ namespace awkward {
             }
 
             case CODE_IF_ELSE: {
+              THREADED_LABEL(CODE_IF_ELSE)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3078,6 +3579,7 @@ namespace awkward {
             }
 
             case CODE_DO: {
+              THREADED_LABEL(CODE_DO)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3088,11 +3590,19 @@ namespace awkward {
                 return;
               }
               do_loop_push(pair[1], pair[0]);
-
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+              if (use_threaded) {
+                // The top of the loop over instructions runs (or skips) the
+                // body for each step.
+                count_instructions_++;
+                continue;
+              }
+#endif
               break;
             }
 
             case CODE_DO_STEP: {
+              THREADED_LABEL(CODE_DO_STEP)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3103,16 +3613,24 @@ namespace awkward {
                 return;
               }
               do_steploop_push(pair[1], pair[0]);
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+              if (use_threaded) {
+                count_instructions_++;
+                continue;
+              }
+#endif
               break;
             }
 
             case CODE_AGAIN: {
+              THREADED_LABEL(CODE_AGAIN)
               // Go back and do the body again.
               bytecodes_pointer_where() -= 2;
               break;
             }
 
             case CODE_UNTIL: {
+              THREADED_LABEL(CODE_UNTIL)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3125,6 +3643,7 @@ namespace awkward {
             }
 
             case CODE_WHILE: {
+              THREADED_LABEL(CODE_WHILE)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3151,6 +3670,7 @@ namespace awkward {
             }
 
             case CODE_EXIT: {
+              THREADED_LABEL(CODE_EXIT)
               I exitdepth = bytecode_get();
               bytecodes_pointer_where()++;
               recursion_current_depth_ -= exitdepth;
@@ -3176,6 +3696,7 @@ namespace awkward {
             }
 
             case CODE_PUT: {
+              THREADED_LABEL(CODE_PUT)
               I num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3188,6 +3709,7 @@ namespace awkward {
             }
 
             case CODE_INC: {
+              THREADED_LABEL(CODE_INC)
               I num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3200,6 +3722,7 @@ namespace awkward {
             }
 
             case CODE_GET: {
+              THREADED_LABEL(CODE_GET)
               I num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3211,6 +3734,7 @@ namespace awkward {
             }
 
             case CODE_LEN_INPUT: {
+              THREADED_LABEL(CODE_LEN_INPUT)
               I in_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3222,6 +3746,7 @@ namespace awkward {
             }
 
             case CODE_POS: {
+              THREADED_LABEL(CODE_POS)
               I in_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3233,6 +3758,7 @@ namespace awkward {
             }
 
             case CODE_END: {
+              THREADED_LABEL(CODE_END)
               I in_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3244,6 +3770,7 @@ namespace awkward {
             }
 
             case CODE_SEEK: {
+              THREADED_LABEL(CODE_SEEK)
               I in_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3258,6 +3785,7 @@ namespace awkward {
             }
 
             case CODE_SKIP: {
+              THREADED_LABEL(CODE_SKIP)
               I in_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3272,6 +3800,7 @@ namespace awkward {
             }
 
             case CODE_WRITE: {
+              THREADED_LABEL(CODE_WRITE)
               I out_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3287,6 +3816,7 @@ namespace awkward {
             }
 
             case CODE_WRITE_ADD: {
+              THREADED_LABEL(CODE_WRITE_ADD)
               I out_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3302,6 +3832,7 @@ namespace awkward {
             }
 
             case CODE_WRITE_DUP: {
+              THREADED_LABEL(CODE_WRITE_DUP)
               I out_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3318,6 +3849,7 @@ namespace awkward {
             }
 
             case CODE_LEN_OUTPUT: {
+              THREADED_LABEL(CODE_LEN_OUTPUT)
               I out_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3329,6 +3861,7 @@ namespace awkward {
             }
 
             case CODE_REWIND: {
+              THREADED_LABEL(CODE_REWIND)
               I out_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_pop()) {
@@ -3343,6 +3876,7 @@ namespace awkward {
             }
 
             case CODE_STRING: {
+              THREADED_LABEL(CODE_STRING)
               I string_num = bytecode_get();
               bytecodes_pointer_where()++;
               if (stack_cannot_push()) {
@@ -3354,6 +3888,7 @@ namespace awkward {
             }
 
             case CODE_PRINT_STRING: {
+              THREADED_LABEL(CODE_PRINT_STRING)
               I string_num = bytecode_get();
               bytecodes_pointer_where()++;
               printf("%s", strings_[(IndexTypeOf<int64_t>)string_num].c_str());
@@ -3361,6 +3896,7 @@ namespace awkward {
             }
 
             case CODE_PRINT: {
+              THREADED_LABEL(CODE_PRINT)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3370,11 +3906,13 @@ namespace awkward {
             }
 
             case CODE_PRINT_CR: {
+              THREADED_LABEL(CODE_PRINT_CR)
               printf("\n");
               break;
             }
 
             case CODE_PRINT_STACK: {
+              THREADED_LABEL(CODE_PRINT_STACK)
               printf("<%lld> ", stack_depth_);
               for (int64_t i = 0;  i < stack_depth_;  i++) {
                 print_number(stack_buffer_[i]);
@@ -3384,6 +3922,7 @@ namespace awkward {
             }
 
             case CODE_I: {
+              THREADED_LABEL(CODE_I)
               if (stack_cannot_push()) {
                 current_error_ = util::ForthError::stack_overflow;
                 return;
@@ -3393,6 +3932,7 @@ namespace awkward {
             }
 
             case CODE_J: {
+              THREADED_LABEL(CODE_J)
               if (stack_cannot_push()) {
                 current_error_ = util::ForthError::stack_overflow;
                 return;
@@ -3402,6 +3942,7 @@ namespace awkward {
             }
 
             case CODE_K: {
+              THREADED_LABEL(CODE_K)
               if (stack_cannot_push()) {
                 current_error_ = util::ForthError::stack_overflow;
                 return;
@@ -3411,6 +3952,7 @@ namespace awkward {
             }
 
             case CODE_DUP: {
+              THREADED_LABEL(CODE_DUP)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3425,6 +3967,7 @@ namespace awkward {
             }
 
             case CODE_DROP: {
+              THREADED_LABEL(CODE_DROP)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3434,6 +3977,7 @@ namespace awkward {
             }
 
             case CODE_SWAP: {
+              THREADED_LABEL(CODE_SWAP)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3445,6 +3989,7 @@ namespace awkward {
             }
 
             case CODE_OVER: {
+              THREADED_LABEL(CODE_OVER)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3458,6 +4003,7 @@ namespace awkward {
             }
 
             case CODE_ROT: {
+              THREADED_LABEL(CODE_ROT)
               if (stack_cannot_pop3()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3470,6 +4016,7 @@ namespace awkward {
             }
 
             case CODE_NIP: {
+              THREADED_LABEL(CODE_NIP)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3480,6 +4027,7 @@ namespace awkward {
             }
 
             case CODE_TUCK: {
+              THREADED_LABEL(CODE_TUCK)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3496,6 +4044,7 @@ namespace awkward {
             }
 
             case CODE_ADD: {
+              THREADED_LABEL(CODE_ADD)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3506,6 +4055,7 @@ namespace awkward {
             }
 
             case CODE_SUB: {
+              THREADED_LABEL(CODE_SUB)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3516,6 +4066,7 @@ namespace awkward {
             }
 
             case CODE_MUL: {
+              THREADED_LABEL(CODE_MUL)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3526,6 +4077,7 @@ namespace awkward {
             }
 
             case CODE_DIV: {
+              THREADED_LABEL(CODE_DIV)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3543,6 +4095,7 @@ namespace awkward {
             }
 
             case CODE_MOD: {
+              THREADED_LABEL(CODE_MOD)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3559,6 +4112,7 @@ namespace awkward {
             }
 
             case CODE_DIVMOD: {
+              THREADED_LABEL(CODE_DIVMOD)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3579,6 +4133,7 @@ namespace awkward {
             }
 
             case CODE_NEGATE: {
+              THREADED_LABEL(CODE_NEGATE)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3589,6 +4144,7 @@ namespace awkward {
             }
 
             case CODE_ADD1: {
+              THREADED_LABEL(CODE_ADD1)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3599,6 +4155,7 @@ namespace awkward {
             }
 
             case CODE_SUB1: {
+              THREADED_LABEL(CODE_SUB1)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3609,6 +4166,7 @@ namespace awkward {
             }
 
             case CODE_ABS: {
+              THREADED_LABEL(CODE_ABS)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3619,6 +4177,7 @@ namespace awkward {
             }
 
             case CODE_MIN: {
+              THREADED_LABEL(CODE_MIN)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3629,6 +4188,7 @@ namespace awkward {
             }
 
             case CODE_MAX: {
+              THREADED_LABEL(CODE_MAX)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3639,6 +4199,7 @@ namespace awkward {
             }
 
             case CODE_EQ: {
+              THREADED_LABEL(CODE_EQ)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3649,6 +4210,7 @@ namespace awkward {
             }
 
             case CODE_NE: {
+              THREADED_LABEL(CODE_NE)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3659,6 +4221,7 @@ namespace awkward {
             }
 
             case CODE_GT: {
+              THREADED_LABEL(CODE_GT)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3669,6 +4232,7 @@ namespace awkward {
             }
 
             case CODE_GE: {
+              THREADED_LABEL(CODE_GE)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3679,6 +4243,7 @@ namespace awkward {
             }
 
             case CODE_LT: {
+              THREADED_LABEL(CODE_LT)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3689,6 +4254,7 @@ namespace awkward {
             }
 
             case CODE_LE: {
+              THREADED_LABEL(CODE_LE)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3699,6 +4265,7 @@ namespace awkward {
             }
 
             case CODE_EQ0: {
+              THREADED_LABEL(CODE_EQ0)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3709,6 +4276,7 @@ namespace awkward {
             }
 
             case CODE_INVERT: {
+              THREADED_LABEL(CODE_INVERT)
               if (stack_cannot_pop()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3719,6 +4287,7 @@ namespace awkward {
             }
 
             case CODE_AND: {
+              THREADED_LABEL(CODE_AND)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3729,6 +4298,7 @@ namespace awkward {
             }
 
             case CODE_OR: {
+              THREADED_LABEL(CODE_OR)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3739,6 +4309,7 @@ namespace awkward {
             }
 
             case CODE_XOR: {
+              THREADED_LABEL(CODE_XOR)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3749,6 +4320,7 @@ namespace awkward {
             }
 
             case CODE_LSHIFT: {
+              THREADED_LABEL(CODE_LSHIFT)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3759,6 +4331,7 @@ namespace awkward {
             }
 
             case CODE_RSHIFT: {
+              THREADED_LABEL(CODE_RSHIFT)
               if (stack_cannot_pop2()) {
                 current_error_ = util::ForthError::stack_underflow;
                 return;
@@ -3769,6 +4342,7 @@ namespace awkward {
             }
 
             case CODE_FALSE: {
+              THREADED_LABEL(CODE_FALSE)
               if (stack_cannot_push()) {
                 current_error_ = util::ForthError::stack_overflow;
                 return;
@@ -3778,6 +4352,7 @@ namespace awkward {
             }
 
             case CODE_TRUE: {
+              THREADED_LABEL(CODE_TRUE)
               if (stack_cannot_push()) {
                 current_error_ = util::ForthError::stack_overflow;
                 return;
@@ -3789,6 +4364,11 @@ namespace awkward {
         } // end handle one instruction
 
         count_instructions_++;
+#ifdef AWKWARD_FORTH_COMPUTED_GOTO
+        if (use_threaded) {
+          goto threaded_next;
+        }
+#endif
         if (single_step) {
           if (is_segment_done()) {
             bytecodes_pointer_pop();
@@ -3819,6 +4399,395 @@ namespace awkward {
     } // end of all segments
   }
 
+  namespace {
+    /// @brief Reads one `TYPE` for a superinstruction, as the interpreter
+    /// would for `num_items == 1`.
+    template <typename TYPE>
+    bool
+    read_one(ForthInputBuffer* input,
+             bool byteswap,
+             TYPE& out,
+             util::ForthError& err) noexcept {
+      TYPE* ptr = reinterpret_cast<TYPE*>(input->read((int64_t)sizeof(TYPE), err));
+      if (err != util::ForthError::none) {
+        return false;
+      }
+      out = *ptr;
+      if (byteswap) {
+        switch (sizeof(TYPE)) {
+          case 2:
+            byteswap16(1, &out);
+            break;
+          case 4:
+            byteswap32(1, &out);
+            break;
+          case 8:
+            byteswap64(1, &out);
+            break;
+        }
+      }
+      return true;
+    }
+
+    /// @brief Reads one varint for a superinstruction.
+    bool
+    read_varint(ForthInputBuffer* input,
+                int64_t& out,
+                util::ForthError& err) noexcept {
+      int64_t shift = 0;
+      uint8_t* byte;
+      out = 0;
+      do {
+        byte = reinterpret_cast<uint8_t*>(input->read(1, err));
+        if (err != util::ForthError::none) {
+          return false;
+        }
+        if (shift == 7 * 9) {
+          err = util::ForthError::varint_too_big;
+          return false;
+        }
+        out |= (int64_t)(*byte & 0x7f) << shift;
+        shift += 7;
+      } while (*byte & 0x80);
+      return true;
+    }
+
+    /// @brief Number of items that bulk parsers decode at a time, into a
+    /// buffer on the C++ stack.
+    const int64_t kBulkChunk = 1024;
+
+    /// @brief Reads `num_items` (at most #kBulkChunk) fixed-width integers
+    /// into `out`, byte-swapping a copy if necessary.
+    template <typename TYPE>
+    bool
+    read_integers(ForthInputBuffer* input,
+                  bool byteswap,
+                  int64_t num_items,
+                  int64_t* out,
+                  util::ForthError& err) noexcept {
+      TYPE* ptr = reinterpret_cast<TYPE*>(
+          input->read(num_items * (int64_t)sizeof(TYPE), err));
+      if (err != util::ForthError::none) {
+        return false;
+      }
+      if (byteswap  &&  sizeof(TYPE) > 1) {
+        TYPE swapped[kBulkChunk];
+        std::memcpy(swapped, ptr, sizeof(TYPE) * (size_t)num_items);
+        switch (sizeof(TYPE)) {
+          case 2:
+            byteswap16(num_items, swapped);
+            break;
+          case 4:
+            byteswap32(num_items, swapped);
+            break;
+          case 8:
+            byteswap64(num_items, swapped);
+            break;
+        }
+        for (int64_t i = 0;  i < num_items;  i++) {
+          out[i] = (int64_t)swapped[i];
+        }
+      }
+      else {
+        for (int64_t i = 0;  i < num_items;  i++) {
+          out[i] = (int64_t)ptr[i];
+        }
+      }
+      return true;
+    }
+
+    /// @brief Reads `num_items` varints (or zigzags) into `out`.
+    bool
+    read_varints(ForthInputBuffer* input,
+                 bool zigzag,
+                 int64_t num_items,
+                 int64_t* out,
+                 util::ForthError& err) noexcept {
+      for (int64_t i = 0;  i < num_items;  i++) {
+        if (!read_varint(input, out[i], err)) {
+          return false;
+        }
+        if (zigzag) {
+          out[i] = (out[i] >> 1) ^ (-(out[i] & 1));
+        }
+      }
+      return true;
+    }
+
+    /// @brief Interleaves items `[start, start + num_items)` of `SIZE`-byte
+    /// values stored as `SIZE` streams of `stride` bytes each (the first
+    /// bytes of all values, then the second bytes, etc.) into `out`.
+    template <size_t SIZE>
+    void
+    unsplit_bytes(const uint8_t* streams,
+                  int64_t stride,
+                  int64_t start,
+                  int64_t num_items,
+                  uint8_t* out) noexcept {
+      for (size_t b = 0;  b < SIZE;  b++) {
+        const uint8_t* stream = streams + (int64_t)b * stride + start;
+        for (int64_t i = 0;  i < num_items;  i++) {
+          out[(size_t)i * SIZE + b] = stream[i];
+        }
+      }
+    }
+  }
+
+  template <typename T, typename I>
+  bool
+  ForthMachineOf<T, I>::read_write_fused(int64_t position) noexcept {
+    // The value takes the same conversions that it would on the stack: (I)
+    // for multi-byte numbers, none for single bytes, varints, and zigzags.
+    if (stack_cannot_push()) {
+      return false;
+    }
+    I bytecode = bytecodes_[(IndexTypeOf<I>)position];
+    I in_num = bytecodes_[(IndexTypeOf<I>)position + 1];
+    I out_num = bytecodes_[(IndexTypeOf<I>)position + 3];
+    ForthInputBuffer* input = current_inputs_[(IndexTypeOf<int64_t>)in_num].get();
+    bool byteswap;
+    if (NATIVELY_BIG_ENDIAN) {
+      byteswap = ((~bytecode & READ_BIGENDIAN) == 0);
+    }
+    else {
+      byteswap = ((~bytecode & READ_BIGENDIAN) != 0);
+    }
+
+    // Past the input number, as the interpreter would be if the read fails.
+    bytecodes_pointer_where()++;
+
+    T value = 0;
+    bool good = false;
+    switch (~bytecode & READ_MASK) {
+      #define READ_ONE(TYPE, CAST) {                              \
+          TYPE x;                                                 \
+          good = read_one<TYPE>(input, byteswap, x, current_error_); \
+          value = (T)(CAST)x;                                     \
+          break;                                                  \
+        }
+      case READ_BOOL:    READ_ONE(bool, T)
+      case READ_INT8:    READ_ONE(int8_t, T)
+      case READ_INT16:   READ_ONE(int16_t, I)
+      case READ_INT32:   READ_ONE(int32_t, I)
+      case READ_INT64:   READ_ONE(int64_t, I)
+      case READ_INTP:    READ_ONE(ssize_t, I)
+      case READ_UINT8:   READ_ONE(uint8_t, T)
+      case READ_UINT16:  READ_ONE(uint16_t, I)
+      case READ_UINT32:  READ_ONE(uint32_t, I)
+      case READ_UINT64:  READ_ONE(uint64_t, I)
+      case READ_UINTP:   READ_ONE(size_t, I)
+      case READ_FLOAT32: READ_ONE(float, I)
+      case READ_FLOAT64: READ_ONE(double, I)
+      #undef READ_ONE
+      case READ_VARINT: {
+        int64_t result;
+        good = read_varint(input, result, current_error_);
+        value = (T)result;
+        break;
+      }
+      case READ_ZIGZAG: {
+        int64_t result;
+        good = read_varint(input, result, current_error_);
+        value = (T)((result >> 1) ^ (-(result & 1)));
+        break;
+      }
+    }
+    if (!good) {
+      return true;
+    }
+    count_reads_++;
+    count_instructions_++;
+
+    bytecodes_pointer_where() += 2;
+    write_from_stack(out_num, &value);
+    count_writes_++;
+    count_instructions_++;
+    return true;
+  }
+
+  template <typename T, typename I>
+  bool
+  ForthMachineOf<T, I>::do_read_fused(int64_t position) noexcept {
+    // Anything that would stop the loop with an error, including a read
+    // that fails partway, is left to the interpreter.
+    if (stack_cannot_pop2()  ||  do_current_depth_ == recursion_max_depth_) {
+      return false;
+    }
+    T* pair = &stack_buffer_[stack_depth_ - 2];
+    int64_t start = pair[1];
+    int64_t stop = pair[0];
+    int64_t num_items = stop > start ? stop - start : 0;
+    if (num_items != 0  &&  recursion_current_depth_ == recursion_max_depth_) {
+      return false;
+    }
+
+    I body = bytecodes_[(IndexTypeOf<I>)position + 1] - BOUND_DICTIONARY;
+    int64_t body_start = bytecodes_offsets_[(IndexTypeOf<int64_t>)body];
+    I bytecode = bytecodes_[(IndexTypeOf<I>)body_start];
+    I in_num = bytecodes_[(IndexTypeOf<I>)body_start + 1];
+    I out_num = bytecodes_[(IndexTypeOf<I>)body_start + 2];
+    bool byteswap;
+    if (NATIVELY_BIG_ENDIAN) {
+      byteswap = ((~bytecode & READ_BIGENDIAN) == 0);
+    }
+    else {
+      byteswap = ((~bytecode & READ_BIGENDIAN) != 0);
+    }
+    I format = ~bytecode & READ_MASK;
+    if (byteswap  &&  format != READ_BOOL  &&  format != READ_INT8  &&
+        format != READ_UINT8) {
+      // Bulk writes would swap the bytes of the input in place.
+      return false;
+    }
+
+    ForthInputBuffer* input = current_inputs_[(IndexTypeOf<int64_t>)in_num].get();
+    ForthOutputBuffer* output = current_outputs_[(IndexTypeOf<int64_t>)out_num].get();
+    util::ForthError err = util::ForthError::none;
+    switch (format) {
+      #define READ_ALL(TYPE, SUFFIX) {                                   \
+          TYPE* ptr = reinterpret_cast<TYPE*>(                           \
+              input->read(num_items * (int64_t)sizeof(TYPE), err));      \
+          if (err != util::ForthError::none) {                           \
+            return false;                                                \
+          }                                                              \
+          output->write_##SUFFIX(num_items, ptr, false);                 \
+          break;                                                         \
+        }
+      case READ_BOOL:    READ_ALL(bool, bool)
+      case READ_INT8:    READ_ALL(int8_t, int8)
+      case READ_INT16:   READ_ALL(int16_t, int16)
+      case READ_INT32:   READ_ALL(int32_t, int32)
+      case READ_INT64:   READ_ALL(int64_t, int64)
+      case READ_INTP:    READ_ALL(ssize_t, intp)
+      case READ_UINT8:   READ_ALL(uint8_t, uint8)
+      case READ_UINT16:  READ_ALL(uint16_t, uint16)
+      case READ_UINT32:  READ_ALL(uint32_t, uint32)
+      case READ_UINT64:  READ_ALL(uint64_t, uint64)
+      case READ_UINTP:   READ_ALL(size_t, uintp)
+      case READ_FLOAT32: READ_ALL(float, float32)
+      case READ_FLOAT64: READ_ALL(double, float64)
+      #undef READ_ALL
+      default:
+        return false;
+    }
+
+    // As if the loop had run: 'do', then a call and a read per item.
+    stack_depth_ -= 2;
+    bytecodes_pointer_where()++;
+    count_instructions_ += 1 + 2 * num_items;
+    count_reads_ += num_items;
+    count_writes_ += num_items;
+    return true;
+  }
+
+  template <typename T, typename I>
+  void
+  ForthMachineOf<T, I>::read_bulk(I parser,
+                                  I in_num,
+                                  I out_num,
+                                  I dict_num,
+                                  int64_t num_items,
+                                  bool byteswap) noexcept {
+    ForthInputBuffer* input = current_inputs_[(IndexTypeOf<int64_t>)in_num].get();
+    ForthOutputBuffer* output = current_outputs_[(IndexTypeOf<int64_t>)out_num].get();
+    I format = parser & READ_MASK;
+
+    if (parser & READ_SPLIT) {
+      // The byte streams are num_items apart, so they are read all at once
+      // and interleaved a chunk at a time.
+      #define WRITE_UNSPLIT(TYPE, SUFFIX) {                                    \
+          uint8_t* streams = reinterpret_cast<uint8_t*>(input->read(           \
+              num_items * (int64_t)sizeof(TYPE), current_error_));             \
+          if (current_error_ != util::ForthError::none) {                      \
+            return;                                                            \
+          }                                                                    \
+          TYPE chunk[kBulkChunk];                                              \
+          for (int64_t start = 0;  start < num_items;  start += kBulkChunk) {  \
+            int64_t size = std::min(kBulkChunk, num_items - start);            \
+            unsplit_bytes<sizeof(TYPE)>(streams, num_items, start, size,       \
+                                        reinterpret_cast<uint8_t*>(chunk));    \
+            output->write_##SUFFIX(size, chunk, byteswap);                     \
+          }                                                                    \
+          break;                                                               \
+        }
+
+      switch (format) {
+        case READ_INT16:   WRITE_UNSPLIT(int16_t, int16)
+        case READ_INT32:   WRITE_UNSPLIT(int32_t, int32)
+        case READ_INT64:   WRITE_UNSPLIT(int64_t, int64)
+        case READ_INTP:    WRITE_UNSPLIT(ssize_t, intp)
+        case READ_UINT16:  WRITE_UNSPLIT(uint16_t, uint16)
+        case READ_UINT32:  WRITE_UNSPLIT(uint32_t, uint32)
+        case READ_UINT64:  WRITE_UNSPLIT(uint64_t, uint64)
+        case READ_UINTP:   WRITE_UNSPLIT(size_t, uintp)
+        case READ_FLOAT32: WRITE_UNSPLIT(float, float32)
+        case READ_FLOAT64: WRITE_UNSPLIT(double, float64)
+      }
+      return;
+    }
+
+    // Running sums and lookups decode integers a chunk at a time.
+    ForthOutputBuffer* dictionary = nullptr;
+    if (parser & READ_LOOKUP) {
+      dictionary = current_outputs_[(IndexTypeOf<int64_t>)dict_num].get();
+    }
+    int64_t chunk[kBulkChunk];
+    for (int64_t start = 0;  start < num_items;  start += kBulkChunk) {
+      int64_t size = std::min(kBulkChunk, num_items - start);
+      bool ok = false;
+      switch (format) {
+        case READ_INT8:
+          ok = read_integers<int8_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_INT16:
+          ok = read_integers<int16_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_INT32:
+          ok = read_integers<int32_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_INT64:
+          ok = read_integers<int64_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_INTP:
+          ok = read_integers<ssize_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_UINT8:
+          ok = read_integers<uint8_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_UINT16:
+          ok = read_integers<uint16_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_UINT32:
+          ok = read_integers<uint32_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_UINT64:
+          ok = read_integers<uint64_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_UINTP:
+          ok = read_integers<size_t>(input, byteswap, size, chunk, current_error_);
+          break;
+        case READ_VARINT:
+          ok = read_varints(input, false, size, chunk, current_error_);
+          break;
+        case READ_ZIGZAG:
+          ok = read_varints(input, true, size, chunk, current_error_);
+          break;
+      }
+      if (!ok) {
+        return;
+      }
+      if (dictionary == nullptr) {
+        output->write_add_int64(size, chunk);
+      }
+      else {
+        output->write_lookup(size, chunk, *dictionary, current_error_);
+        if (current_error_ != util::ForthError::none) {
+          return;
+        }
+      }
+    }
+  }
+
   template <>
   void
   ForthMachineOf<int32_t, int32_t>::write_from_stack(int64_t num, int32_t* top) noexcept {
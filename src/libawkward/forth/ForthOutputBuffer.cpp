@@ -706,6 +706,51 @@ namespace awkward {
     ptr_.get()[length_ - 1] = previous + (OUT)value;
   }
 
+  template <typename OUT>
+  void
+  ForthOutputBufferOf<OUT>::write_add_int64(int64_t num_items,
+                                            int64_t* values) noexcept {
+    OUT previous = 0;
+    if (length_ != 0) {
+      previous = ptr_.get()[length_ - 1];
+    }
+    int64_t next = length_ + num_items;
+    maybe_resize(next);
+    OUT* ptr = &ptr_.get()[length_];
+    for (int64_t i = 0;  i < num_items;  i++) {
+      previous += (OUT)values[i];
+      ptr[i] = previous;
+    }
+    length_ = next;
+  }
+
+  template <typename OUT>
+  void
+  ForthOutputBufferOf<OUT>::write_lookup(int64_t num_items,
+                                         int64_t* index,
+                                         const ForthOutputBuffer& dictionary,
+                                         util::ForthError& err) noexcept {
+    // Check all indexes first (a loop without early exit vectorizes).
+    int64_t dictionary_length = dictionary.len();
+    bool in_range = true;
+    for (int64_t i = 0;  i < num_items;  i++) {
+      in_range &= ((uint64_t)index[i] < (uint64_t)dictionary_length);
+    }
+    if (!in_range) {
+      err = util::ForthError::lookup_beyond;
+      return;
+    }
+    int64_t next = length_ + num_items;
+    // Resizing first: the dictionary may be this buffer.
+    maybe_resize(next);
+    const OUT* values = reinterpret_cast<const OUT*>(dictionary.ptr().get());
+    OUT* ptr = &ptr_.get()[length_];
+    for (int64_t i = 0;  i < num_items;  i++) {
+      ptr[i] = values[index[i]];
+    }
+    length_ = next;
+  }
+
   template <typename OUT>
   void
   ForthOutputBufferOf<OUT>::maybe_resize(int64_t next) {
@@ -716,7 +761,7 @@ namespace awkward {
       }
       std::shared_ptr<OUT> new_buffer = std::shared_ptr<OUT>(new OUT[reservation],
                                                              kernel::array_deleter<OUT>());
-      std::memcpy(new_buffer.get(), ptr_.get(), sizeof(OUT) * (size_t)reserved_);
+      std::memcpy(new_buffer.get(), ptr_.get(), sizeof(OUT) * (size_t)length_);
       ptr_ = new_buffer;
       reserved_ = reservation;
     }
@@ -0,0 +1,1313 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/io/json-reader.cpp", line)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale.h>
+#if defined(__APPLE__)
+  #include <xlocale.h>
+#endif
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/TypedArrayBuilder.h"
+#include "awkward/partition/IrregularlyPartitionedArray.h"
+#include "awkward/Content.h"
+#include "awkward/kernel-parallel.h"
+
+#include "awkward/io/json.h"
+
+namespace awkward {
+  ////////// reading from JSON
+
+  // JSON is read in two stages, as in simdjson. The first (index_structure)
+  // finds where every structural character ({}[]:,), string, and other value
+  // in a block of text begins and ends, and whether strings have escapes or
+  // whitespace has newlines; it is a tight loop that mostly skips whitespace
+  // and the insides of strings, eight bytes at a time. The second (Reader)
+  // walks those tokens, checking the grammar and filling an ArrayBuilder,
+  // without scanning whitespace or strings again. Blocks always end between
+  // top-level documents, so a large file or string is read in bounded
+  // memory.
+  //
+  // If the caller knows the Form of the output, the Reader fills a
+  // TypedArrayBuilder instead, which has a buffer for each Form node from
+  // the start and looks up record keys in a hash table: there is no type
+  // discovery and no virtual call per token.
+  //
+  // JSON-lines input can also be cut into chunks at newlines, which are
+  // read on separate threads into separate builders (FromJsonLinesString
+  // and FromJsonLinesFile).
+
+  namespace {
+    const uint8_t kValue = 0;
+    const uint8_t kSpace = 1;
+    const uint8_t kStructural = 2;
+    const uint8_t kQuote = 3;
+
+    /// @brief Character classes: #kValue for any character that can be in a
+    /// number or a literal (or is a syntax error).
+    struct CharClasses {
+      CharClasses() {
+        for (int i = 0;  i < 256;  i++) {
+          classes[i] = kValue;
+        }
+        classes[(uint8_t)' '] = kSpace;
+        classes[(uint8_t)'\t'] = kSpace;
+        classes[(uint8_t)'\n'] = kSpace;
+        classes[(uint8_t)'\r'] = kSpace;
+        classes[(uint8_t)'{'] = kStructural;
+        classes[(uint8_t)'}'] = kStructural;
+        classes[(uint8_t)'['] = kStructural;
+        classes[(uint8_t)']'] = kStructural;
+        classes[(uint8_t)':'] = kStructural;
+        classes[(uint8_t)','] = kStructural;
+        classes[(uint8_t)'"'] = kQuote;
+      }
+      uint8_t classes[256];
+    };
+
+    const CharClasses chars;
+
+    inline uint8_t
+    charclass(char c) {
+      return chars.classes[(uint8_t)c];
+    }
+
+    /// @brief Token flags: a string has backslash escapes.
+    const uint8_t kEscapes = 1;
+    /// @brief Token flags: a string has unescaped control characters (which
+    /// JSON does not allow).
+    const uint8_t kControl = 2;
+    /// @brief Token flags: the whitespace before the token has a newline.
+    const uint8_t kNewline = 4;
+
+    /// @brief True if any of the eight bytes in `word` is a quote, a
+    /// backslash, or a control character.
+    inline bool
+    has_special(uint64_t word) {
+      const uint64_t ones = 0x0101010101010101ULL;
+      const uint64_t highs = 0x8080808080808080ULL;
+      uint64_t quotes = word ^ (ones * (uint8_t)'"');
+      uint64_t backslashes = word ^ (ones * (uint8_t)'\\');
+      return (((quotes - ones) & ~quotes) |
+              ((backslashes - ones) & ~backslashes) |
+              ((word - ones * 0x20) & ~word)) & highs;
+    }
+
+    /// @brief Position just after the quote that closes a string whose
+    /// contents begin at `start`, or -1 if it isn't closed by `length`;
+    /// adds #kEscapes and #kControl to `flags` if it has them.
+    inline int64_t
+    string_end(const char* data,
+               int64_t start,
+               int64_t length,
+               uint8_t& flags) {
+      int64_t i = start;
+      while (true) {
+        uint64_t word;
+        while (i + 8 <= length) {
+          std::memcpy(&word, data + i, 8);
+          if (has_special(word)) {
+            break;
+          }
+          i += 8;
+        }
+        if (i >= length) {
+          return -1;
+        }
+        uint8_t c = (uint8_t)data[i];
+        if (c == '"') {
+          return i + 1;
+        }
+        else if (c == '\\') {
+          flags |= kEscapes;
+          i += 2;
+        }
+        else {
+          if (c < 0x20) {
+            flags |= kControl;
+          }
+          i++;
+        }
+      }
+    }
+
+    /// @brief Position just after a number or literal that begins at
+    /// `start`.
+    inline int64_t
+    value_end(const char* data, int64_t start, int64_t length) {
+      int64_t i = start + 1;
+      while (i < length  &&  charclass(data[i]) == kValue) {
+        i++;
+      }
+      return i;
+    }
+
+    /// @brief An end in Structure::ends for a string that isn't closed.
+    const uint32_t kUnclosed = std::numeric_limits<uint32_t>::max();
+
+    /// @brief The structural index of a block (stage 1).
+    struct Structure {
+      /// @brief Position of each structural character and of the first
+      /// character of each string, number, and literal.
+      std::vector<uint32_t> tokens;
+      /// @brief Position just after each of the #tokens, or #kUnclosed.
+      std::vector<uint32_t> ends;
+      /// @brief Flags (#kEscapes, #kControl, #kNewline) of each of the
+      /// #tokens.
+      std::vector<uint8_t> flags;
+      /// @brief Number of #tokens in complete documents.
+      size_t complete_tokens;
+      /// @brief Number of bytes of complete documents and the whitespace
+      /// after them.
+      int64_t complete_bytes;
+      /// @brief True if the whitespace at the end of the #complete_bytes
+      /// has a newline.
+      bool trailing_newline;
+    };
+
+    /// @brief Indexes a block of `length` bytes (less than 4 GiB) that
+    /// begins between documents. Unless the block is `final`, the last
+    /// document may be incomplete; it is left out of the complete counts.
+    void
+    index_structure(const char* data,
+                    int64_t length,
+                    bool final,
+                    Structure& out) {
+      out.tokens.clear();
+      out.ends.clear();
+      out.flags.clear();
+      out.complete_tokens = 0;
+      out.complete_bytes = 0;
+      out.trailing_newline = false;
+      int64_t depth = 0;
+      int64_t i = 0;
+      while (true) {
+        bool newline = false;
+        while (i < length  &&  charclass(data[i]) == kSpace) {
+          newline |= (data[i] == '\n');
+          i++;
+        }
+        if (depth == 0) {
+          out.complete_tokens = out.tokens.size();
+          out.complete_bytes = i;
+          out.trailing_newline = newline;
+        }
+        if (i == length) {
+          break;
+        }
+        out.tokens.push_back((uint32_t)i);
+        uint8_t flags = (newline ? kNewline : 0);
+        int64_t end;
+        char c = data[i];
+        switch (charclass(c)) {
+          case kStructural:
+            if (c == '{'  ||  c == '[') {
+              depth++;
+            }
+            else if ((c == '}'  ||  c == ']')  &&  depth > 0) {
+              depth--;
+            }
+            end = i + 1;
+            i = end;
+            break;
+          case kQuote:
+            end = string_end(data, i + 1, length, flags);
+            i = end;
+            break;
+          default:
+            end = value_end(data, i, length);
+            // if it reaches the end, it may continue in the next block
+            i = (end == length ? -1 : end);
+        }
+        out.ends.push_back(end < 0 ? kUnclosed : (uint32_t)end);
+        out.flags.push_back(flags);
+        if (i < 0) {
+          break;
+        }
+      }
+      if (final) {
+        out.complete_tokens = out.tokens.size();
+        out.complete_bytes = length;
+      }
+    }
+
+    const double kPowersOfTen[23] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    /// @brief std::strtod in the "C" locale, so that the decimal point is
+    /// always '.', whatever the process's LC_NUMERIC.
+    inline double
+    strtod_c(const char* str) {
+#if defined(_MSC_VER)
+      static const _locale_t c_locale = _create_locale(LC_ALL, "C");
+      return _strtod_l(str, nullptr, c_locale);
+#else
+      static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+      return strtod_l(str, nullptr, c_locale);
+#endif
+    }
+
+    inline void
+    select_field(ArrayBuilder& builder, const std::string& key) {
+      builder.field_check(key);
+    }
+
+    inline void
+    select_field(TypedArrayBuilder& builder, const std::string& key) {
+      builder.field(key);
+    }
+
+    /// @brief Checks the grammar of indexed blocks and fills an ArrayBuilder
+    /// or a TypedArrayBuilder (stage 2).
+    template <typename BUILDER>
+    class Reader {
+    public:
+      Reader(BUILDER& builder,
+             const char* nan_string,
+             const char* infinity_string,
+             const char* minus_infinity_string,
+             bool lines)
+          : builder_(builder)
+          , nan_string_(nan_string)
+          , infinity_string_(infinity_string)
+          , minus_infinity_string_(minus_infinity_string)
+          , lines_(lines)
+          , documents_(0)
+          , expect_(Expect::value)
+          , offset_(0)
+          , position_(0)
+          , failed_(false)
+          , newline_(false)
+          , scratch_data_(nullptr)
+          , scratch_length_(0) { }
+
+      /// @brief Number of top-level documents read so far.
+      int64_t
+      documents() const {
+        return documents_;
+      }
+
+      /// @brief Position in the whole input of the last token read.
+      int64_t
+      position() const {
+        return position_;
+      }
+
+      /// @brief True if the Reader (rather than the builder) has raised an
+      /// error.
+      bool
+      failed() const {
+        return failed_;
+      }
+
+      /// @brief Reads the complete documents of a block that begins at
+      /// `offset` bytes in the whole input (for error messages).
+      void
+      parse(const char* data,
+            int64_t length,
+            const Structure& structure,
+            int64_t offset,
+            bool final) {
+        offset_ = offset;
+        for (size_t t = 0;  t < structure.complete_tokens;  t++) {
+          int64_t pos = (int64_t)structure.tokens[t];
+          uint32_t end = structure.ends[t];
+          uint8_t flags = structure.flags[t];
+          position_ = offset_ + pos;
+          char c = data[pos];
+          if (lines_  &&  (flags & kNewline)) {
+            if (!stack_.empty()) {
+              syntax_error(data, pos, "newline inside a JSON-lines document");
+            }
+            newline_ = true;
+          }
+          switch (expect_) {
+            case Expect::value_or_endlist:
+              if (c == ']') {
+                end_container(pos);
+                break;
+              }
+              value(data, pos, end, flags);
+              break;
+            case Expect::value:
+              value(data, pos, end, flags);
+              break;
+            case Expect::comma_or_endlist:
+              if (c == ',') {
+                expect_ = Expect::value;
+              }
+              else if (c == ']') {
+                end_container(pos);
+              }
+              else {
+                syntax_error(data, pos, "expected ',' or ']'");
+              }
+              break;
+            case Expect::key_or_endrecord:
+              if (c == '}') {
+                end_container(pos);
+                break;
+              }
+              key(data, pos, end, flags);
+              break;
+            case Expect::key:
+              key(data, pos, end, flags);
+              break;
+            case Expect::colon:
+              if (c != ':') {
+                syntax_error(data, pos, "expected ':'");
+              }
+              expect_ = Expect::value;
+              break;
+            case Expect::comma_or_endrecord:
+              if (c == ',') {
+                expect_ = Expect::key;
+              }
+              else if (c == '}') {
+                end_container(pos);
+              }
+              else {
+                syntax_error(data, pos, "expected ',' or '}'");
+              }
+              break;
+          }
+        }
+        if (!stack_.empty()  ||  expect_ != Expect::value) {
+          if (final) {
+            fail(std::string("incomplete JSON object at the end of the stream")
+                 + FILENAME(__LINE__));
+          }
+        }
+        newline_ = newline_  ||  structure.trailing_newline;
+      }
+
+    private:
+      enum class Expect {
+        value,
+        value_or_endlist,
+        comma_or_endlist,
+        key_or_endrecord,
+        key,
+        colon,
+        comma_or_endrecord
+      };
+
+      void
+      fail(const std::string& message) {
+        failed_ = true;
+        throw std::invalid_argument(message);
+      }
+
+      void
+      syntax_error(const char* data, int64_t pos, const char* expected) {
+        fail(std::string("JSON syntax error at char ")
+             + std::to_string(offset_ + pos) + std::string(": \'")
+             + data[pos] + std::string("\' (") + expected + std::string(")")
+             + FILENAME(__LINE__));
+      }
+
+      /// @brief Sets what comes after a value.
+      void
+      end_value() {
+        if (stack_.empty()) {
+          documents_++;
+          newline_ = false;
+          expect_ = Expect::value;
+        }
+        else if (stack_.back() == '[') {
+          expect_ = Expect::comma_or_endlist;
+        }
+        else {
+          expect_ = Expect::comma_or_endrecord;
+        }
+      }
+
+      void
+      end_container(int64_t pos) {
+        if (stack_.back() == '[') {
+          builder_.endlist();
+        }
+        else {
+          builder_.endrecord();
+        }
+        stack_.pop_back();
+        end_value();
+      }
+
+      void
+      value(const char* data, int64_t pos, uint32_t end, uint8_t flags) {
+        if (stack_.empty()) {
+          begin_document(data, pos);
+        }
+        switch (data[pos]) {
+          case '[':
+            builder_.beginlist();
+            stack_.push_back('[');
+            expect_ = Expect::value_or_endlist;
+            return;
+          case '{':
+            builder_.beginrecord();
+            stack_.push_back('{');
+            expect_ = Expect::key_or_endrecord;
+            return;
+          case '"':
+            string(data, pos, end, flags);
+            string_value(scratch_data_, scratch_length_);
+            end_value();
+            return;
+          default:
+            if (!literal(data + pos, data + end)  &&
+                !number(data + pos, data + end)) {
+              syntax_error(data, pos, "expected a value");
+            }
+            end_value();
+        }
+      }
+
+      void
+      key(const char* data, int64_t pos, uint32_t end, uint8_t flags) {
+        if (data[pos] != '"') {
+          syntax_error(data, pos, "expected a string key");
+        }
+        string(data, pos, end, flags);
+        key_.assign(scratch_data_, (size_t)scratch_length_);
+        select_field(builder_, key_);
+        expect_ = Expect::colon;
+      }
+
+      /// @brief In JSON-lines mode, checks that there's a newline between
+      /// this document and the previous one.
+      void
+      begin_document(const char* data, int64_t pos) {
+        if (lines_  &&  documents_ > 0  &&  !newline_) {
+          syntax_error(data, pos, "expected one JSON document per line");
+        }
+      }
+
+      /// @brief Decodes the string that begins with a quote at `pos` and
+      /// ends at `end` into #scratch_data_ and #scratch_length_ (pointing
+      /// into the block if it has no escapes).
+      void
+      string(const char* data, int64_t pos, uint32_t end, uint8_t flags) {
+        if (end == kUnclosed) {
+          fail(std::string("incomplete JSON object at the end of the stream")
+               + FILENAME(__LINE__));
+        }
+        if (flags & kControl) {
+          syntax_error(data, pos, "unescaped control character in string");
+        }
+        const char* begin = data + pos + 1;
+        size_t size = (size_t)(end - pos - 2);
+        if ((flags & kEscapes) == 0) {
+          scratch_data_ = begin;
+          scratch_length_ = (int64_t)size;
+        }
+        else {
+          if (!unescape(begin, begin + size)) {
+            syntax_error(data, pos, "invalid escape sequence in string");
+          }
+          scratch_data_ = scratch_.data();
+          scratch_length_ = (int64_t)scratch_.size();
+        }
+      }
+
+      void
+      string_value(const char* x, int64_t length) {
+        if (matches(x, length, nan_string_)) {
+          builder_.real(std::numeric_limits<double>::quiet_NaN());
+        }
+        else if (matches(x, length, infinity_string_)) {
+          builder_.real(std::numeric_limits<double>::infinity());
+        }
+        else if (matches(x, length, minus_infinity_string_)) {
+          builder_.real(-std::numeric_limits<double>::infinity());
+        }
+        else {
+          builder_.string(x, length);
+        }
+      }
+
+      static bool
+      matches(const char* x, int64_t length, const char* special) {
+        return special != nullptr  &&
+               std::strlen(special) == (size_t)length  &&
+               std::memcmp(x, special, (size_t)length) == 0;
+      }
+
+      /// @brief Decodes the JSON escape sequences in a string into
+      /// #scratch_, returning false if any are invalid.
+      bool
+      unescape(const char* p, const char* end) {
+        scratch_.clear();
+        while (p < end) {
+          if (*p != '\\') {
+            scratch_.push_back(*p++);
+            continue;
+          }
+          if (++p == end) {
+            return false;
+          }
+          switch (*p++) {
+            case '"':  scratch_.push_back('"');  break;
+            case '\\': scratch_.push_back('\\'); break;
+            case '/':  scratch_.push_back('/');  break;
+            case 'b':  scratch_.push_back('\b'); break;
+            case 'f':  scratch_.push_back('\f'); break;
+            case 'n':  scratch_.push_back('\n'); break;
+            case 'r':  scratch_.push_back('\r'); break;
+            case 't':  scratch_.push_back('\t'); break;
+            case 'u': {
+              uint32_t code;
+              if (!hex4(p, end, code)) {
+                return false;
+              }
+              p += 4;
+              if (code >= 0xD800  &&  code <= 0xDBFF) {
+                uint32_t low;
+                if (end - p < 6  ||  p[0] != '\\'  ||  p[1] != 'u'  ||
+                    !hex4(p + 2, end, low)  ||
+                    low < 0xDC00  ||  low > 0xDFFF) {
+                  return false;
+                }
+                p += 6;
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+              }
+              else if (code >= 0xDC00  &&  code <= 0xDFFF) {
+                return false;
+              }
+              utf8(code);
+              break;
+            }
+            default:
+              return false;
+          }
+        }
+        return true;
+      }
+
+      static bool
+      hex4(const char* p, const char* end, uint32_t& out) {
+        if (end - p < 4) {
+          return false;
+        }
+        out = 0;
+        for (int i = 0;  i < 4;  i++) {
+          char c = p[i];
+          out <<= 4;
+          if (c >= '0'  &&  c <= '9') {
+            out |= (uint32_t)(c - '0');
+          }
+          else if (c >= 'a'  &&  c <= 'f') {
+            out |= (uint32_t)(c - 'a' + 10);
+          }
+          else if (c >= 'A'  &&  c <= 'F') {
+            out |= (uint32_t)(c - 'A' + 10);
+          }
+          else {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      void
+      utf8(uint32_t code) {
+        if (code < 0x80) {
+          scratch_.push_back((char)code);
+        }
+        else if (code < 0x800) {
+          scratch_.push_back((char)(0xC0 | (code >> 6)));
+          scratch_.push_back((char)(0x80 | (code & 0x3F)));
+        }
+        else if (code < 0x10000) {
+          scratch_.push_back((char)(0xE0 | (code >> 12)));
+          scratch_.push_back((char)(0x80 | ((code >> 6) & 0x3F)));
+          scratch_.push_back((char)(0x80 | (code & 0x3F)));
+        }
+        else {
+          scratch_.push_back((char)(0xF0 | (code >> 18)));
+          scratch_.push_back((char)(0x80 | ((code >> 12) & 0x3F)));
+          scratch_.push_back((char)(0x80 | ((code >> 6) & 0x3F)));
+          scratch_.push_back((char)(0x80 | (code & 0x3F)));
+        }
+      }
+
+      bool
+      literal(const char* p, const char* end) {
+        size_t size = (size_t)(end - p);
+        if (size == 4  &&  std::memcmp(p, "null", 4) == 0) {
+          builder_.null();
+        }
+        else if (size == 4  &&  std::memcmp(p, "true", 4) == 0) {
+          builder_.boolean(true);
+        }
+        else if (size == 5  &&  std::memcmp(p, "false", 5) == 0) {
+          builder_.boolean(false);
+        }
+        else {
+          return false;
+        }
+        return true;
+      }
+
+      /// @brief Appends a JSON number as an integer if it has no fraction or
+      /// exponent and fits in 64 bits, and as a real otherwise; returns
+      /// false if it isn't a JSON number.
+      ///
+      /// Reals with at most 19 significant digits (all that fit in the
+      /// mantissa without rounding) and a power of ten of at most 22 are
+      /// computed exactly with one multiplication or division; others use
+      /// strtod (in the "C" locale).
+      bool
+      number(const char* p, const char* end) {
+        const char* q = p;
+        bool negative = (*q == '-');
+        if (negative) {
+          q++;
+        }
+        if (q == end  ||  *q < '0'  ||  *q > '9') {
+          return false;
+        }
+        uint64_t mantissa = 0;
+        int64_t digits = 0;
+        int64_t exponent = 0;
+        bool isreal = false;
+        if (*q == '0') {
+          q++;
+        }
+        else {
+          while (q < end  &&  *q >= '0'  &&  *q <= '9') {
+            if (digits < 19) {
+              mantissa = 10*mantissa + (uint64_t)(*q - '0');
+            }
+            else {
+              exponent++;
+            }
+            digits++;
+            q++;
+          }
+        }
+        if (q < end  &&  *q == '.') {
+          isreal = true;
+          q++;
+          if (q == end  ||  *q < '0'  ||  *q > '9') {
+            return false;
+          }
+          while (q < end  &&  *q >= '0'  &&  *q <= '9') {
+            if (mantissa == 0  &&  *q == '0') {
+              exponent--;
+            }
+            else if (digits < 19) {
+              mantissa = 10*mantissa + (uint64_t)(*q - '0');
+              exponent--;
+              digits++;
+            }
+            else {
+              digits++;
+            }
+            q++;
+          }
+        }
+        if (q < end  &&  (*q == 'e'  ||  *q == 'E')) {
+          isreal = true;
+          q++;
+          bool negative_exponent = false;
+          if (q < end  &&  (*q == '+'  ||  *q == '-')) {
+            negative_exponent = (*q == '-');
+            q++;
+          }
+          if (q == end  ||  *q < '0'  ||  *q > '9') {
+            return false;
+          }
+          int64_t e = 0;
+          while (q < end  &&  *q >= '0'  &&  *q <= '9') {
+            if (e < 100000) {
+              e = 10*e + (int64_t)(*q - '0');
+            }
+            q++;
+          }
+          exponent += (negative_exponent ? -e : e);
+        }
+        if (q != end) {
+          return false;
+        }
+
+        if (!isreal  &&  digits <= 19) {
+          if (!negative  &&
+              mantissa <= (uint64_t)std::numeric_limits<int64_t>::max()) {
+            builder_.integer((int64_t)mantissa);
+            return true;
+          }
+          if (negative  &&
+              mantissa <= (uint64_t)std::numeric_limits<int64_t>::max() + 1) {
+            builder_.integer((int64_t)(~mantissa + 1));
+            return true;
+          }
+        }
+        if (digits <= 19  &&  mantissa <= (1ULL << 53)  &&
+            -22 <= exponent  &&  exponent <= 22) {
+          double x = (double)mantissa;
+          if (exponent < 0) {
+            x /= kPowersOfTen[-exponent];
+          }
+          else {
+            x *= kPowersOfTen[exponent];
+          }
+          builder_.real(negative ? -x : x);
+          return true;
+        }
+        number_.assign(p, (size_t)(end - p));
+        double x = strtod_c(number_.c_str());
+        if (std::isinf(x)) {
+          fail(std::string("JSON number too big to be stored in double: ")
+               + number_ + FILENAME(__LINE__));
+        }
+        builder_.real(x);
+        return true;
+      }
+
+      BUILDER& builder_;
+      const char* nan_string_;
+      const char* infinity_string_;
+      const char* minus_infinity_string_;
+      const bool lines_;
+      int64_t documents_;
+      /// @brief What the next token may be.
+      Expect expect_;
+      /// @brief The lists ('[') and records ('{') that have begun but not
+      /// ended, innermost last.
+      std::vector<char> stack_;
+      /// @brief Position of the current block in the whole input.
+      int64_t offset_;
+      /// @brief See #position.
+      int64_t position_;
+      /// @brief See #failed.
+      bool failed_;
+      /// @brief True if there has been a newline since the last document
+      /// ended.
+      bool newline_;
+      /// @brief The last string read, unescaped.
+      const char* scratch_data_;
+      int64_t scratch_length_;
+      std::string scratch_;
+      std::string key_;
+      std::string number_;
+    };
+
+    /// @brief Blocks of a string, referenced in place.
+    class StringBlocks {
+    public:
+      StringBlocks(const char* source, int64_t length, int64_t blocksize)
+          : source_(source)
+          , length_(length)
+          , position_(0)
+          , blocksize_(blocksize) { }
+
+      const char*
+      data() const {
+        return source_ + position_;
+      }
+
+      int64_t
+      length() const {
+        return std::min(blocksize_, length_ - position_);
+      }
+
+      bool
+      final() const {
+        return position_ + blocksize_ >= length_;
+      }
+
+      void
+      consume(int64_t bytes) {
+        position_ += bytes;
+      }
+
+      void
+      grow() {
+        blocksize_ *= 2;
+      }
+
+    private:
+      const char* source_;
+      const int64_t length_;
+      int64_t position_;
+      int64_t blocksize_;
+    };
+
+    /// @brief Blocks of a file, read into a buffer that grows if one
+    /// document doesn't fit.
+    class FileBlocks {
+    public:
+      FileBlocks(FILE* source, int64_t buffersize)
+          : source_(source)
+          , buffer_((size_t)std::max(buffersize, (int64_t)1))
+          , filled_(0)
+          , eof_(false) {
+        fill();
+      }
+
+      const char*
+      data() const {
+        return buffer_.data();
+      }
+
+      int64_t
+      length() const {
+        return filled_;
+      }
+
+      bool
+      final() const {
+        return eof_;
+      }
+
+      void
+      consume(int64_t bytes) {
+        std::memmove(buffer_.data(),
+                     buffer_.data() + bytes,
+                     (size_t)(filled_ - bytes));
+        filled_ -= bytes;
+        fill();
+      }
+
+      void
+      grow() {
+        buffer_.resize(2*buffer_.size());
+        fill();
+      }
+
+    private:
+      void
+      fill() {
+        while (!eof_  &&  filled_ < (int64_t)buffer_.size()) {
+          size_t num = std::fread(buffer_.data() + filled_,
+                                  1,
+                                  buffer_.size() - (size_t)filled_,
+                                  source_);
+          if (num == 0) {
+            if (std::ferror(source_)) {
+              throw std::invalid_argument(
+                std::string("error reading JSON file") + FILENAME(__LINE__));
+            }
+            eof_ = true;
+          }
+          filled_ += (int64_t)num;
+        }
+      }
+
+      FILE* source_;
+      std::vector<char> buffer_;
+      int64_t filled_;
+      bool eof_;
+    };
+
+    /// @brief Largest block that 32-bit token positions can index.
+    const int64_t kMaxBlock = (int64_t)std::numeric_limits<uint32_t>::max();
+
+    /// @brief Reads all of the `blocks` into the `builder`, returning the
+    /// number of top-level documents. The `blocks` begin at `offset` in the
+    /// whole input (for error messages).
+    template <typename BLOCKS, typename BUILDER>
+    int64_t
+    read_documents(BLOCKS& blocks,
+                   BUILDER& builder,
+                   const char* nan_string,
+                   const char* infinity_string,
+                   const char* minus_infinity_string,
+                   bool lines,
+                   int64_t offset = 0) {
+      Reader<BUILDER> reader(builder,
+                             nan_string,
+                             infinity_string,
+                             minus_infinity_string,
+                             lines);
+      Structure structure;
+      while (true) {
+        if (blocks.length() > kMaxBlock) {
+          throw std::invalid_argument(
+            std::string("JSON document at char ") + std::to_string(offset)
+            + std::string(" is too large (4 GiB or more)")
+            + FILENAME(__LINE__));
+        }
+        bool final = blocks.final();
+        index_structure(blocks.data(), blocks.length(), final, structure);
+        try {
+          reader.parse(blocks.data(),
+                       blocks.length(),
+                       structure,
+                       offset,
+                       final);
+        }
+        catch (const std::invalid_argument& err) {
+          if (reader.failed()) {
+            throw;
+          }
+          // the builder refused a value: say where it is in the JSON
+          throw std::invalid_argument(
+            std::string("JSON at char ") + std::to_string(reader.position())
+            + std::string(": ") + err.what());
+        }
+        if (final) {
+          break;
+        }
+        if (structure.complete_bytes == 0) {
+          blocks.grow();
+        }
+        else {
+          offset += structure.complete_bytes;
+          blocks.consume(structure.complete_bytes);
+        }
+      }
+      return reader.documents();
+    }
+
+    template <typename BLOCKS>
+    const ContentPtr
+    read_json(BLOCKS& blocks,
+              const ArrayBuilderOptions& options,
+              const char* nan_string,
+              const char* infinity_string,
+              const char* minus_infinity_string,
+              bool lines,
+              const FormPtr& form) {
+      if (form.get() == nullptr) {
+        ArrayBuilder builder(options);
+        int64_t documents = read_documents(blocks,
+                                           builder,
+                                           nan_string,
+                                           infinity_string,
+                                           minus_infinity_string,
+                                           lines);
+        ContentPtr out = builder.snapshot();
+        if (!lines  &&  documents == 1) {
+          return out.get()->getitem_at_nowrap(0);
+        }
+        return out;
+      }
+
+      if (lines) {
+        TypedArrayBuilder builder(form, options);
+        read_documents(blocks,
+                       builder,
+                       nan_string,
+                       infinity_string,
+                       minus_infinity_string,
+                       lines);
+        return builder.snapshot();
+      }
+
+      // Without lines, the output array is one JSON array.
+      FormPtr listform = std::make_shared<ListOffsetForm>(false,
+                                                          util::Parameters(),
+                                                          FormKey(nullptr),
+                                                          Index::Form::i64,
+                                                          form);
+      TypedArrayBuilder builder(listform, options);
+      int64_t documents = read_documents(blocks,
+                                         builder,
+                                         nan_string,
+                                         infinity_string,
+                                         minus_infinity_string,
+                                         lines);
+      if (documents == 0) {
+        return TypedArrayBuilder(form, options).snapshot();
+      }
+      if (documents != 1) {
+        throw std::invalid_argument(
+          std::string("JSON with a form must be one array of items (or "
+                      "one item per line, with 'lines'), not ")
+          + std::to_string(documents) + std::string(" documents")
+          + FILENAME(__LINE__));
+      }
+      return builder.snapshot().get()->getitem_at_nowrap(0);
+    }
+
+    /// @brief Smallest chunk of JSON lines that is read as one task.
+    const int64_t kMinLinesChunk = (int64_t)1 << 22;
+
+    /// @brief Reads one chunk of JSON lines, which begins at `offset` in the
+    /// whole input, with its own builder.
+    const ContentPtr
+    read_lines_chunk(const char* data,
+                     int64_t length,
+                     int64_t offset,
+                     const ArrayBuilderOptions& options,
+                     const char* nan_string,
+                     const char* infinity_string,
+                     const char* minus_infinity_string,
+                     const FormPtr& form) {
+      StringBlocks blocks(data, length, 1 << 20);
+      if (form.get() == nullptr) {
+        ArrayBuilder builder(options);
+        read_documents(blocks,
+                       builder,
+                       nan_string,
+                       infinity_string,
+                       minus_infinity_string,
+                       true,
+                       offset);
+        return builder.snapshot();
+      }
+      else {
+        TypedArrayBuilder builder(form, options);
+        read_documents(blocks,
+                       builder,
+                       nan_string,
+                       infinity_string,
+                       minus_infinity_string,
+                       true,
+                       offset);
+        return builder.snapshot();
+      }
+    }
+
+    /// @brief Cuts the first `length` bytes of `data`, which end at a line
+    /// boundary, into chunks of about `chunksize` bytes that each end after
+    /// a newline, appending their ends to `stops`.
+    void
+    split_lines(const char* data,
+                int64_t length,
+                int64_t chunksize,
+                std::vector<int64_t>& stops) {
+      int64_t start = 0;
+      while (start < length) {
+        int64_t stop = std::min(start + chunksize, length);
+        if (stop < length) {
+          const void* newline = std::memchr(data + stop - 1,
+                                            '\n',
+                                            (size_t)(length - stop + 1));
+          stop = (newline == nullptr
+                    ? length
+                    : (int64_t)((const char*)newline - data) + 1);
+        }
+        stops.push_back(stop);
+        start = stop;
+      }
+    }
+
+    /// @brief Reads the chunks of `data` that end at `stops` on up to
+    /// `num_threads` threads, appending one array per chunk to `out`.
+    void
+    read_lines_chunks(const char* data,
+                      const std::vector<int64_t>& stops,
+                      int64_t offset,
+                      const ArrayBuilderOptions& options,
+                      int64_t num_threads,
+                      const char* nan_string,
+                      const char* infinity_string,
+                      const char* minus_infinity_string,
+                      const FormPtr& form,
+                      ContentPtrVec& out) {
+      ContentPtrVec chunks(stops.size());
+      kernel::parallel_tasks((int64_t)stops.size(), [&](int64_t i) -> void {
+        int64_t start = (i == 0 ? 0 : stops[(size_t)i - 1]);
+        chunks[(size_t)i] = read_lines_chunk(data + start,
+                                             stops[(size_t)i] - start,
+                                             offset + start,
+                                             options,
+                                             nan_string,
+                                             infinity_string,
+                                             minus_infinity_string,
+                                             form);
+      }, num_threads);
+      out.insert(out.end(), chunks.begin(), chunks.end());
+    }
+
+    /// @brief Makes a PartitionedArray of the non-empty `chunks`. Chunks
+    /// read without a Form may have different types, so they are merged
+    /// into one partition.
+    const PartitionedArrayPtr
+    lines_partitions(const ContentPtrVec& chunks, const FormPtr& form) {
+      ContentPtrVec partitions;
+      for (auto chunk : chunks) {
+        if (chunk.get()->length() != 0) {
+          partitions.push_back(chunk);
+        }
+      }
+      if (partitions.empty()) {
+        partitions.push_back(chunks[0]);
+      }
+      if (form.get() == nullptr  &&  partitions.size() > 1) {
+        ContentPtrVec others(partitions.begin() + 1, partitions.end());
+        ContentPtr merged = partitions[0].get()->mergemany(others);
+        partitions = ContentPtrVec({ merged });
+      }
+      std::vector<int64_t> stops;
+      int64_t stop = 0;
+      for (auto partition : partitions) {
+        stop += partition.get()->length();
+        stops.push_back(stop);
+      }
+      return std::make_shared<IrregularlyPartitionedArray>(partitions, stops);
+    }
+
+    int64_t
+    effective_threads(int64_t num_threads) {
+      if (num_threads > 0) {
+        return num_threads;
+      }
+      int64_t out = (int64_t)std::thread::hardware_concurrency();
+      return out > 0 ? out : 1;
+    }
+  }
+
+  const ContentPtr
+  FromJsonString(const char* source,
+                 const ArrayBuilderOptions& options,
+                 const char* nan_string,
+                 const char* infinity_string,
+                 const char* minus_infinity_string,
+                 bool lines,
+                 const FormPtr& form) {
+    StringBlocks blocks(source, (int64_t)std::strlen(source), 1 << 20);
+    return read_json(blocks,
+                     options,
+                     nan_string,
+                     infinity_string,
+                     minus_infinity_string,
+                     lines,
+                     form);
+  }
+
+  const ContentPtr
+  FromJsonFile(FILE* source,
+               const ArrayBuilderOptions& options,
+               int64_t buffersize,
+               const char* nan_string,
+               const char* infinity_string,
+               const char* minus_infinity_string,
+               bool lines,
+               const FormPtr& form) {
+    FileBlocks blocks(source, buffersize);
+    return read_json(blocks,
+                     options,
+                     nan_string,
+                     infinity_string,
+                     minus_infinity_string,
+                     lines,
+                     form);
+  }
+
+  const PartitionedArrayPtr
+  FromJsonLinesString(const char* source,
+                      const ArrayBuilderOptions& options,
+                      int64_t num_threads,
+                      const char* nan_string,
+                      const char* infinity_string,
+                      const char* minus_infinity_string,
+                      const FormPtr& form) {
+    int64_t length = (int64_t)std::strlen(source);
+    // A few chunks per thread, so that uneven chunks even out.
+    int64_t chunksize = std::max(
+      kMinLinesChunk, length / (4*effective_threads(num_threads)) + 1);
+    std::vector<int64_t> stops;
+    split_lines(source, length, chunksize, stops);
+    if (stops.empty()) {
+      stops.push_back(0);
+    }
+    ContentPtrVec chunks;
+    read_lines_chunks(source,
+                      stops,
+                      0,
+                      options,
+                      num_threads,
+                      nan_string,
+                      infinity_string,
+                      minus_infinity_string,
+                      form,
+                      chunks);
+    return lines_partitions(chunks, form);
+  }
+
+  const PartitionedArrayPtr
+  FromJsonLinesFile(FILE* source,
+                    const ArrayBuilderOptions& options,
+                    int64_t buffersize,
+                    int64_t num_threads,
+                    const char* nan_string,
+                    const char* infinity_string,
+                    const char* minus_infinity_string,
+                    const FormPtr& form) {
+    // Each round reads up to one chunk per thread, ending at the last
+    // newline; the rest of the last line is kept for the next round. The
+    // buffer starts at one chunk, so that small files stay small.
+    int64_t chunksize = std::max(kMinLinesChunk, buffersize);
+    size_t roundsize = (size_t)(chunksize * effective_threads(num_threads));
+    std::vector<char> buffer((size_t)chunksize);
+    int64_t filled = 0;
+    int64_t offset = 0;
+    bool eof = false;
+    ContentPtrVec chunks;
+    while (!eof) {
+      while (!eof  &&  filled < (int64_t)buffer.size()) {
+        size_t num = std::fread(buffer.data() + filled,
+                                1,
+                                buffer.size() - (size_t)filled,
+                                source);
+        if (num == 0) {
+          if (std::ferror(source)) {
+            throw std::invalid_argument(
+              std::string("error reading JSON file") + FILENAME(__LINE__));
+          }
+          eof = true;
+        }
+        filled += (int64_t)num;
+      }
+      int64_t complete = filled;
+      if (!eof) {
+        while (complete > 0  &&  buffer[(size_t)complete - 1] != '\n') {
+          complete--;
+        }
+        if (complete == 0) {
+          // one line is longer than the whole buffer
+          buffer.resize(2*buffer.size());
+          continue;
+        }
+      }
+      std::vector<int64_t> stops;
+      split_lines(buffer.data(), complete, chunksize, stops);
+      read_lines_chunks(buffer.data(),
+                        stops,
+                        offset,
+                        options,
+                        num_threads,
+                        nan_string,
+                        infinity_string,
+                        minus_infinity_string,
+                        form,
+                        chunks);
+      std::memmove(buffer.data(),
+                   buffer.data() + complete,
+                   (size_t)(filled - complete));
+      filled -= complete;
+      offset += complete;
+      if (buffer.size() < roundsize) {
+        buffer.resize(std::min(2*buffer.size(), roundsize));
+      }
+    }
+    if (chunks.empty()) {
+      chunks.push_back(read_lines_chunk(buffer.data(),
+                                        0,
+                                        0,
+                                        options,
+                                        nan_string,
+                                        infinity_string,
+                                        minus_infinity_string,
+                                        form));
+    }
+    return lines_partitions(chunks, form);
+  }
+}
@@ -5,15 +5,13 @@
 #include <complex>
 
 #include "rapidjson/document.h"
-#include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/stringbuffer.h"
-#include "rapidjson/filereadstream.h"
 #include "rapidjson/filewritestream.h"
-#include "rapidjson/error/en.h"
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
-#include "awkward/builder/ArrayBuilder.h"
 #include "awkward/Content.h"
 
 #include "awkward/io/json.h"
@@ -34,6 +32,20 @@ namespace awkward {
     field(x.c_str());
   }
 
+  void
+  ToJson::integers(const int64_t* x, int64_t length) {
+    for (int64_t i = 0;  i < length;  i++) {
+      integer(x[i]);
+    }
+  }
+
+  void
+  ToJson::reals(const double* x, int64_t length) {
+    for (int64_t i = 0;  i < length;  i++) {
+      real(x[i]);
+    }
+  }
+
   template <typename DOCUMENT, typename WRITER>
   void copyjson(const DOCUMENT& value, WRITER& writer) {
     if (value.IsNull()) {
@@ -72,6 +84,60 @@ namespace awkward {
     }
   }
 
+  /// @brief Size of the local buffer in which #writeintegers and
+  /// #writereals format numbers.
+  const int64_t kBulkBuffer = 4096;
+
+  /// @brief Writes integers as rapidjson's Writer::Int64 would, but formats
+  /// them into a local buffer and passes each full buffer to the writer as
+  /// one raw value (commas included), rather than one call per number.
+  template <typename WRITER>
+  void writeintegers(WRITER& writer, const int64_t* x, int64_t length) {
+    char buffer[kBulkBuffer];
+    char* end = buffer;
+    for (int64_t i = 0;  i < length;  i++) {
+      // comma and up to 20 characters
+      if (end + 21 > buffer + kBulkBuffer) {
+        writer.RawValue(buffer, (size_t)(end - buffer), rj::kNumberType);
+        end = buffer;
+      }
+      if (end != buffer) {
+        *end++ = ',';
+      }
+      end = rj::internal::i64toa(x[i], end);
+    }
+    if (end != buffer) {
+      writer.RawValue(buffer, (size_t)(end - buffer), rj::kNumberType);
+    }
+  }
+
+  /// @brief Writes reals as rapidjson's Writer::Double would (shortest
+  /// representation that reads back the same, up to the maximum number of
+  /// decimals), in bulk like #writeintegers. Stops before the first NaN or
+  /// infinity, which the caller must handle, and returns how many it wrote.
+  template <typename WRITER>
+  int64_t writereals(WRITER& writer, const double* x, int64_t length) {
+    char buffer[kBulkBuffer];
+    char* end = buffer;
+    int maxdecimals = writer.GetMaxDecimalPlaces();
+    int64_t i = 0;
+    for (;  i < length  &&  std::isfinite(x[i]);  i++) {
+      // comma and up to 25 characters
+      if (end + 26 > buffer + kBulkBuffer) {
+        writer.RawValue(buffer, (size_t)(end - buffer), rj::kNumberType);
+        end = buffer;
+      }
+      if (end != buffer) {
+        *end++ = ',';
+      }
+      end = rj::internal::dtoa(x[i], end, maxdecimals);
+    }
+    if (end != buffer) {
+      writer.RawValue(buffer, (size_t)(end - buffer), rj::kNumberType);
+    }
+    return i;
+  }
+
   class ToJsonString::Impl {
   public:
     Impl(int64_t maxdecimals): buffer_(), writer_(buffer_) {
@@ -83,6 +149,12 @@ namespace awkward {
     void boolean(bool x) { writer_.Bool(x); }
     void integer(int64_t x) { writer_.Int64(x); }
     void real(double x) { writer_.Double(x); }
+    void integers(const int64_t* x, int64_t length) {
+      writeintegers(writer_, x, length);
+    }
+    int64_t reals(const double* x, int64_t length) {
+      return writereals(writer_, x, length);
+    }
     void complex(std::complex<double> x,
                  const char* complex_real_string,
                  const char* complex_imag_string) {
@@ -159,6 +231,24 @@ namespace awkward {
     }
   }
 
+  void
+  ToJsonString::integers(const int64_t* x, int64_t length) {
+    impl_->integers(x, length);
+  }
+
+  void
+  ToJsonString::reals(const double* x, int64_t length) {
+    int64_t i = 0;
+    while (i < length) {
+      i += impl_->reals(x + i, length - i);
+      if (i < length) {
+        // NaN or infinity
+        real(x[i]);
+        i++;
+      }
+    }
+  }
+
   void
   ToJsonString::complex(std::complex<double> x) {
     if (complex_real_string_ != nullptr  &&  complex_imag_string_ != nullptr) {
@@ -369,6 +459,12 @@ namespace awkward {
     void boolean(bool x) { writer_.Bool(x); }
     void integer(int64_t x) { writer_.Int64(x); }
     void real(double x) { writer_.Double(x); }
+    void integers(const int64_t* x, int64_t length) {
+      writeintegers(writer_, x, length);
+    }
+    int64_t reals(const double* x, int64_t length) {
+      return writereals(writer_, x, length);
+    }
     void complex(std::complex<double> x,
                  const char* complex_real_string,
                  const char* complex_imag_string) {
@@ -445,6 +541,24 @@ namespace awkward {
     }
   }
 
+  void
+  ToJsonFile::integers(const int64_t* x, int64_t length) {
+    impl_->integers(x, length);
+  }
+
+  void
+  ToJsonFile::reals(const double* x, int64_t length) {
+    int64_t i = 0;
+    while (i < length) {
+      i += impl_->reals(x + i, length - i);
+      if (i < length) {
+        // NaN or infinity
+        real(x[i]);
+        i++;
+      }
+    }
+  }
+
   void
   ToJsonFile::complex(std::complex<double> x) {
     if (complex_real_string_ != nullptr  &&  complex_imag_string_ != nullptr) {
@@ -634,216 +748,4 @@ namespace awkward {
   ToJsonPrettyFile::json(const char* x) {
     impl_->json(x);
   }
-
-  ////////// reading from JSON
-
-  class Handler: public rj::BaseReaderHandler<rj::UTF8<>, Handler> {
-  public:
-    Handler(const ArrayBuilderOptions& options,
-            const char* nan_string,
-            const char* infinity_string,
-            const char* minus_infinity_string)
-        : builder_(options)
-        , moved_(false)
-        , nan_string_(nan_string)
-        , infinity_string_(infinity_string)
-        , minus_infinity_string_(minus_infinity_string) { }
-
-    void
-    reset_moved() {
-      moved_ = false;
-    }
-
-    bool
-    moved() const {
-      return moved_;
-    }
-
-    bool Null() {
-      moved_ = true;
-      builder_.null();
-      return true;
-    }
-
-    bool Bool(bool x) {
-      moved_ = true;
-      builder_.boolean(x);
-      return true;
-    }
-
-    bool Int(int x) {
-      moved_ = true;
-      builder_.integer((int64_t)x);
-      return true;
-    }
-
-    bool Uint(unsigned int x) {
-      moved_ = true;
-      builder_.integer((int64_t)x);
-      return true;
-    }
-
-    bool Int64(int64_t x) {
-      moved_ = true;
-      builder_.integer(x);
-      return true;
-    }
-
-    bool Uint64(uint64_t x) {
-      moved_ = true;
-      builder_.integer((int64_t)x);
-      return true;
-    }
-
-    bool Double(double x) {
-      builder_.real(x);
-      moved_ = true;
-      return true;
-    }
-
-    bool
-    String(const char* str, rj::SizeType length, bool copy) {
-      moved_ = true;
-      if (nan_string_ != nullptr  &&  strcmp(str, nan_string_) == 0) {
-        builder_.real(std::numeric_limits<double>::quiet_NaN());
-        return true;
-      }
-      else if (infinity_string_ != nullptr  &&  strcmp(str, infinity_string_) == 0) {
-        builder_.real(std::numeric_limits<double>::infinity());
-        return true;
-      }
-      else if (minus_infinity_string_ != nullptr  &&  strcmp(str, minus_infinity_string_) == 0) {
-        builder_.real(-std::numeric_limits<double>::infinity());
-        return true;
-      }
-      else {
-        builder_.string(str, (int64_t)length);
-        return true;
-      }
-    }
-
-    bool
-    StartArray() {
-      moved_ = true;
-      builder_.beginlist();
-      return true;
-    }
-
-    bool
-    EndArray(rj::SizeType numfields) {
-      moved_ = true;
-      builder_.endlist();
-      return true;
-    }
-
-    bool
-    StartObject() {
-      moved_ = true;
-      builder_.beginrecord();
-      return true;
-    }
-
-    bool
-    EndObject(rj::SizeType numfields) {
-      moved_ = true;
-      builder_.endrecord();
-      return true;
-    }
-
-    bool
-    Key(const char* str, rj::SizeType length, bool copy) {
-      moved_ = true;
-      builder_.field_check(str);
-      return true;
-    }
-
-    const ContentPtr snapshot() const {
-      return builder_.snapshot();
-    }
-
-  private:
-    ArrayBuilder builder_;
-    bool moved_;
-    const char* nan_string_;
-    const char* infinity_string_;
-    const char* minus_infinity_string_;
-  };
-
-  template<typename HANDLER, typename STREAM>
-  const ContentPtr
-  do_parse(HANDLER& handler, rj::Reader& reader, STREAM& stream) {
-    int64_t number = 0;
-    while (stream.Peek() != 0) {
-      handler.reset_moved();
-      bool fully_parsed = reader.Parse<rj::kParseStopWhenDoneFlag>(stream, handler);
-      if (handler.moved()) {
-        if (!fully_parsed) {
-          if (stream.Peek() == 0) {
-            throw std::invalid_argument(
-                std::string("incomplete JSON object at the end of the stream")
-                + FILENAME(__LINE__));
-          }
-          else {
-            throw std::invalid_argument(
-              std::string("JSON File error at char ")
-              + std::to_string(stream.Tell()) + std::string(": \'")
-              + stream.Peek() + std::string("\'")
-              + FILENAME(__LINE__));
-          }
-        }
-        else {
-          number++;
-        }
-      }
-      else if (stream.Peek() != 0) {
-        throw std::invalid_argument(
-          std::string("JSON File error at char ")
-          + std::to_string(stream.Tell()) + std::string(": \'")
-          + stream.Peek() + std::string("\'")
-          + FILENAME(__LINE__));
-      }
-    }
-
-    ContentPtr obj = handler.snapshot();
-    if (number == 1) {
-      return obj.get()->getitem_at_nowrap(0);
-    }
-    else {
-      return obj;
-    }
-  }
-
-  const ContentPtr
-  FromJsonString(const char* source,
-                 const ArrayBuilderOptions& options,
-                 const char* nan_string,
-                 const char* infinity_string,
-                 const char* minus_infinity_string) {
-    rj::Reader reader;
-    rj::StringStream stream(source);
-    Handler handler(options,
-                    nan_string,
-                    infinity_string,
-                    minus_infinity_string);
-    return do_parse(handler, reader, stream);
-  }
-
-  const ContentPtr
-  FromJsonFile(FILE* source,
-               const ArrayBuilderOptions& options,
-               int64_t buffersize,
-               const char* nan_string,
-               const char* infinity_string,
-               const char* minus_infinity_string) {
-    rj::Reader reader;
-    std::shared_ptr<char> buffer = kernel::malloc<char>(kernel::lib::cpu, buffersize);
-    rj::FileReadStream stream(source,
-                              buffer.get(),
-                              ((size_t)buffersize)*sizeof(char));
-    Handler handler(options,
-                    nan_string,
-                    infinity_string,
-                    minus_infinity_string);
-    return do_parse(handler, reader, stream);
-  }
 }
@@ -0,0 +1,366 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/kernel-allocator.cpp", line)
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+  #include <malloc.h>
+#endif
+#ifdef __linux__
+  #include <sys/mman.h>
+#endif
+
+#include "awkward/kernel-utils.h"
+#include "awkward/util.h"
+
+#include "awkward/kernel-allocator.h"
+
+namespace awkward {
+  namespace kernel {
+    ////////// Allocator
+
+    Allocator::Allocator()
+        : num_allocations_(0)
+        , num_deallocations_(0)
+        , bytes_allocated_(0)
+        , bytes_in_use_(0)
+        , peak_bytes_in_use_(0) { }
+
+    Allocator::~Allocator() = default;
+
+    void*
+    Allocator::allocate(int64_t bytelength) {
+      if (bytelength == 0) {
+        return nullptr;
+      }
+      void* out = allocate_bytes(bytelength);
+      num_allocations_.fetch_add(1);
+      bytes_allocated_.fetch_add(bytelength);
+      int64_t in_use = bytes_in_use_.fetch_add(bytelength) + bytelength;
+      int64_t peak = peak_bytes_in_use_.load();
+      while (in_use > peak  &&
+             !peak_bytes_in_use_.compare_exchange_weak(peak, in_use)) { }
+      return out;
+    }
+
+    void
+    Allocator::deallocate(void* ptr, int64_t bytelength) {
+      if (ptr == nullptr) {
+        return;
+      }
+      deallocate_bytes(ptr, bytelength);
+      num_deallocations_.fetch_add(1);
+      bytes_in_use_.fetch_sub(bytelength);
+    }
+
+    const AllocatorStats
+    Allocator::stats() const {
+      AllocatorStats out;
+      out.num_allocations = num_allocations_.load();
+      out.num_deallocations = num_deallocations_.load();
+      out.bytes_allocated = bytes_allocated_.load();
+      out.bytes_in_use = bytes_in_use_.load();
+      out.peak_bytes_in_use = peak_bytes_in_use_.load();
+      return out;
+    }
+
+    void
+    Allocator::reset_stats() {
+      num_allocations_.store(0);
+      num_deallocations_.store(0);
+      bytes_allocated_.store(0);
+      peak_bytes_in_use_.store(bytes_in_use_.load());
+    }
+
+    ////////// MallocAllocator
+
+    const std::string
+    MallocAllocator::classname() const {
+      return "malloc";
+    }
+
+    void*
+    MallocAllocator::allocate_bytes(int64_t bytelength) {
+      return awkward_malloc(bytelength);
+    }
+
+    void
+    MallocAllocator::deallocate_bytes(void* ptr, int64_t bytelength) {
+      awkward_free(ptr);
+    }
+
+    ////////// ArenaAllocator
+
+    namespace {
+      /// @brief Alignment of every buffer in a block; the block's live count
+      /// is stored in its first (otherwise unused) slot.
+      const int64_t kArenaAlignment = 64;
+
+      void*
+      aligned_block(int64_t bytelength) {
+#ifdef _MSC_VER
+        void* out = _aligned_malloc((size_t)bytelength, (size_t)bytelength);
+#else
+        void* out = nullptr;
+        if (posix_memalign(&out, (size_t)bytelength, (size_t)bytelength) != 0) {
+          out = nullptr;
+        }
+#endif
+        if (out == nullptr) {
+          throw std::bad_alloc();
+        }
+        return out;
+      }
+
+      void
+      free_aligned_block(void* ptr) {
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+      }
+    }
+
+    struct ArenaAllocator::Impl {
+      int64_t blocksize;
+      std::mutex mutex;
+      /// @brief The block being filled (or nullptr).
+      uint8_t* current;
+      /// @brief Bytes of #current in use, including its header.
+      int64_t used;
+      int64_t num_blocks;
+
+      static int64_t&
+      live(uint8_t* block) {
+        return *reinterpret_cast<int64_t*>(block);
+      }
+    };
+
+    ArenaAllocator::ArenaAllocator(int64_t blocksize)
+        : impl_(new Impl) {
+      int64_t size = 4096;
+      while (size < blocksize) {
+        size *= 2;
+      }
+      impl_.get()->blocksize = size;
+      impl_.get()->current = nullptr;
+      impl_.get()->used = 0;
+      impl_.get()->num_blocks = 0;
+    }
+
+    ArenaAllocator::~ArenaAllocator() {
+      // Every buffer holds this allocator alive, so only the empty current
+      // block can be left.
+      if (impl_.get()->current != nullptr) {
+        free_aligned_block(impl_.get()->current);
+      }
+    }
+
+    const std::string
+    ArenaAllocator::classname() const {
+      return "arena";
+    }
+
+    int64_t
+    ArenaAllocator::blocksize() const {
+      return impl_.get()->blocksize;
+    }
+
+    int64_t
+    ArenaAllocator::num_blocks() const {
+      std::lock_guard<std::mutex> lock(impl_.get()->mutex);
+      return impl_.get()->num_blocks;
+    }
+
+    void*
+    ArenaAllocator::allocate_bytes(int64_t bytelength) {
+      Impl& impl = *impl_.get();
+      if (bytelength > impl.blocksize / 4) {
+        return awkward_malloc(bytelength);
+      }
+      int64_t size = (bytelength + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+      std::lock_guard<std::mutex> lock(impl.mutex);
+      if (impl.current == nullptr  ||  impl.used + size > impl.blocksize) {
+        // The old block is freed by its last buffer.
+        impl.current = reinterpret_cast<uint8_t*>(aligned_block(impl.blocksize));
+        Impl::live(impl.current) = 0;
+        impl.used = kArenaAlignment;
+        impl.num_blocks++;
+      }
+      void* out = impl.current + impl.used;
+      impl.used += size;
+      Impl::live(impl.current)++;
+      return out;
+    }
+
+    void
+    ArenaAllocator::deallocate_bytes(void* ptr, int64_t bytelength) {
+      Impl& impl = *impl_.get();
+      if (bytelength > impl.blocksize / 4) {
+        awkward_free(ptr);
+        return;
+      }
+      uint8_t* block = reinterpret_cast<uint8_t*>(
+        reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t)(impl.blocksize - 1));
+      std::lock_guard<std::mutex> lock(impl.mutex);
+      if (--Impl::live(block) == 0) {
+        if (block == impl.current) {
+          impl.used = kArenaAlignment;
+        }
+        else {
+          free_aligned_block(block);
+          impl.num_blocks--;
+        }
+      }
+    }
+
+    ////////// HugePageAllocator
+
+    const std::string
+    HugePageAllocator::classname() const {
+      return "hugepage";
+    }
+
+    void*
+    HugePageAllocator::allocate_bytes(int64_t bytelength) {
+#ifdef __linux__
+      if (bytelength >= page_size) {
+        size_t length = (size_t)((bytelength + page_size - 1) & ~(page_size - 1));
+        // Map one page more than needed and trim both ends, so that the
+        // buffer starts on a huge-page boundary.
+        size_t mapped = length + (size_t)page_size;
+        void* raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+          throw std::bad_alloc();
+        }
+        uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (start + (uintptr_t)page_size - 1) &
+                            ~(uintptr_t)(page_size - 1);
+        if (aligned > start) {
+          munmap(raw, aligned - start);
+        }
+        uintptr_t stop = start + mapped;
+        if (stop > aligned + length) {
+          munmap(reinterpret_cast<void*>(aligned + length),
+                 stop - (aligned + length));
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+      }
+#endif
+      return awkward_malloc(bytelength);
+    }
+
+    void
+    HugePageAllocator::deallocate_bytes(void* ptr, int64_t bytelength) {
+#ifdef __linux__
+      if (bytelength >= page_size) {
+        munmap(ptr, (size_t)((bytelength + page_size - 1) & ~(page_size - 1)));
+        return;
+      }
+#endif
+      awkward_free(ptr);
+    }
+
+    ////////// registry and per-thread selection
+
+    namespace {
+      std::mutex registry_mutex;
+
+      /// @brief Never destroyed, so that buffers freed during static
+      /// destruction can still reach their allocators by name.
+      std::map<std::string, AllocatorPtr>&
+      registry() {
+        static std::map<std::string, AllocatorPtr>* out =
+          new std::map<std::string, AllocatorPtr>({
+            { "malloc", std::make_shared<MallocAllocator>() },
+            { "arena", std::make_shared<ArenaAllocator>(4194304) },
+            { "hugepage", std::make_shared<HugePageAllocator>() }
+          });
+        return *out;
+      }
+
+      thread_local AllocatorPtr current_allocator;
+    }
+
+    void
+    register_allocator(const std::string& name,
+                       const AllocatorPtr& allocator) {
+      if (name.empty()  ||  allocator.get() == nullptr) {
+        throw std::invalid_argument(
+          std::string("register_allocator needs a name and an allocator")
+          + FILENAME(__LINE__));
+      }
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      registry()[name] = allocator;
+    }
+
+    const AllocatorPtr
+    get_allocator(const std::string& name) {
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      auto found = registry().find(name);
+      if (found == registry().end()) {
+        throw std::invalid_argument(
+          std::string("no allocator named ") + util::quote(name)
+          + FILENAME(__LINE__));
+      }
+      return found->second;
+    }
+
+    const std::vector<std::string>
+    allocator_names() {
+      std::lock_guard<std::mutex> lock(registry_mutex);
+      std::vector<std::string> out;
+      for (auto const& pair : registry()) {
+        out.push_back(pair.first);
+      }
+      return out;
+    }
+
+    const AllocatorPtr&
+    thread_allocator() {
+      return current_allocator;
+    }
+
+    void
+    set_thread_allocator(const AllocatorPtr& allocator) {
+      current_allocator = allocator;
+    }
+
+    void
+    set_thread_allocator(const std::string& name) {
+      if (name.empty()) {
+        current_allocator.reset();
+      }
+      else {
+        current_allocator = get_allocator(name);
+      }
+    }
+
+    ////////// AllocatorScope
+
+    AllocatorScope::AllocatorScope(const AllocatorPtr& allocator)
+        : previous_(current_allocator) {
+      current_allocator = allocator;
+    }
+
+    AllocatorScope::AllocatorScope(const std::string& name)
+        : previous_(current_allocator) {
+      set_thread_allocator(name);
+    }
+
+    AllocatorScope::~AllocatorScope() {
+      current_allocator = previous_;
+    }
+  }
+}
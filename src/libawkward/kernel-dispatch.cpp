@@ -11,6 +11,7 @@
 #include "awkward/cuda-utils.h"
 
 #include "awkward/kernel-dispatch.h"
+#include "awkward/kernel-parallel.h"
 
 #define CREATE_KERNEL(libFnName, ptr_lib)          \
   auto handle = acquire_handle(ptr_lib);         \
@@ -1245,12 +1246,14 @@ namespace awkward {
       int64_t stride,
       const int64_t *pos) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_getitem_next_null_64(
-          toptr,
-          fromptr,
-          len,
-          stride,
-          pos);
+        return parallel_for(len, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_getitem_next_null_64(
+            toptr + start*stride,
+            fromptr,
+            stop - start,
+            stride,
+            pos + start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -1476,6 +1479,41 @@ namespace awkward {
       }
     }
 
+    ERROR NumpyArray_fused_elementwise_64(
+      kernel::lib ptr_lib,
+      double *toptr,
+      const double **fromptrs,
+      const int64_t *program,
+      int64_t programlength,
+      const double *constants,
+      double *stack,
+      int64_t stackdepth,
+      int64_t blocksize,
+      int64_t length) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_NumpyArray_fused_elementwise_64(
+          toptr,
+          fromptrs,
+          program,
+          programlength,
+          constants,
+          stack,
+          stackdepth,
+          blocksize,
+          length);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for NumpyArray_fused_elementwise_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for NumpyArray_fused_elementwise_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     template<>
     ERROR ListArray_getitem_next_at_64<int32_t>(
       kernel::lib ptr_lib,
@@ -2135,14 +2173,16 @@ namespace awkward {
       int64_t lenstarts,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray32_getitem_carry_64(
-          tostarts,
-          tostops,
-          fromstarts,
-          fromstops,
-          fromcarry,
-          lenstarts,
-          lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_ListArray32_getitem_carry_64(
+            tostarts + start,
+            tostops + start,
+            fromstarts,
+            fromstops,
+            fromcarry + start,
+            lenstarts,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2167,14 +2207,16 @@ namespace awkward {
       int64_t lenstarts,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-       return awkward_ListArrayU32_getitem_carry_64(
-         tostarts,
-         tostops,
-         fromstarts,
-         fromstops,
-         fromcarry,
-         lenstarts,
-         lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_ListArrayU32_getitem_carry_64(
+            tostarts + start,
+            tostops + start,
+            fromstarts,
+            fromstops,
+            fromcarry + start,
+            lenstarts,
+            stop - start);
+        });
      }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2199,14 +2241,16 @@ namespace awkward {
       int64_t lenstarts,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray64_getitem_carry_64(
-          tostarts,
-          tostops,
-          fromstarts,
-          fromstops,
-          fromcarry,
-          lenstarts,
-          lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_ListArray64_getitem_carry_64(
+            tostarts + start,
+            tostops + start,
+            fromstarts,
+            fromstops,
+            fromcarry + start,
+            lenstarts,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2397,11 +2441,13 @@ namespace awkward {
       int64_t lencarry,
       int64_t size) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_RegularArray_getitem_carry_64(
-          tocarry,
-          fromcarry,
-          lencarry,
-          size);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_RegularArray_getitem_carry_64(
+            tocarry + start*size,
+            fromcarry + start,
+            stop - start,
+            size);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2839,12 +2885,14 @@ namespace awkward {
       int64_t lenindex,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-       return awkward_IndexedArray32_getitem_carry_64(
-         toindex,
-         fromindex,
-         fromcarry,
-         lenindex,
-         lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_IndexedArray32_getitem_carry_64(
+            toindex + start,
+            fromindex,
+            fromcarry + start,
+            lenindex,
+            stop - start);
+        });
      }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2867,12 +2915,14 @@ namespace awkward {
       int64_t lenindex,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_IndexedArrayU32_getitem_carry_64(
-          toindex,
-          fromindex,
-          fromcarry,
-          lenindex,
-          lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_IndexedArrayU32_getitem_carry_64(
+            toindex + start,
+            fromindex,
+            fromcarry + start,
+            lenindex,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2895,12 +2945,14 @@ namespace awkward {
       int64_t lenindex,
       int64_t lencarry) {
       if (ptr_lib == kernel::lib::cpu) {
-       return awkward_IndexedArray64_getitem_carry_64(
-         toindex,
-         fromindex,
-         fromcarry,
-         lenindex,
-         lencarry);
+        return parallel_for(lencarry, [&](int64_t start, int64_t stop) {
+          return awkward_IndexedArray64_getitem_carry_64(
+            toindex + start,
+            fromindex,
+            fromcarry + start,
+            lenindex,
+            stop - start);
+        });
      }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -2914,6 +2966,35 @@ namespace awkward {
       }
      }
 
+    ERROR IndexedArray64_getitem_compose_64(
+      kernel::lib ptr_lib,
+      int64_t *toindex,
+      const int64_t *outerindex,
+      const int64_t *innerindex,
+      int64_t lenouter,
+      int64_t leninner) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(lenouter, [&](int64_t start, int64_t stop) {
+          return awkward_IndexedArray64_getitem_compose_64(
+            toindex + start,
+            outerindex + start,
+            innerindex,
+            stop - start,
+            leninner);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for IndexedArray64_getitem_compose_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for IndexedArray64_getitem_compose_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     template<>
     ERROR UnionArray_regular_index_getsize<int8_t>(
       kernel::lib ptr_lib,
@@ -5030,11 +5111,13 @@ namespace awkward {
       const int32_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray32_num_64(
-          tonum,
-          fromstarts,
-          fromstops,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_ListArray32_num_64(
+            tonum + start,
+            fromstarts + start,
+            fromstops + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         CREATE_KERNEL(awkward_ListArray32_num_64, ptr_lib);
@@ -5059,11 +5142,13 @@ namespace awkward {
       const uint32_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArrayU32_num_64(
-          tonum,
-          fromstarts,
-          fromstops,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_ListArrayU32_num_64(
+            tonum + start,
+            fromstarts + start,
+            fromstops + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         CREATE_KERNEL(awkward_ListArrayU32_num_64, ptr_lib);
@@ -5088,11 +5173,13 @@ namespace awkward {
       const int64_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray64_num_64(
-          tonum,
-          fromstarts,
-          fromstops,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_ListArray64_num_64(
+            tonum + start,
+            fromstarts + start,
+            fromstops + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         CREATE_KERNEL(awkward_ListArray64_num_64, ptr_lib);
@@ -6156,11 +6243,16 @@ namespace awkward {
       const int32_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray32_compact_offsets_64(
+        return parallel_offsets(
           tooffsets,
-          fromstarts,
-          fromstops,
-          length);
+          length,
+          [&](int64_t* chunkoffsets, int64_t start, int64_t stop) {
+            return awkward_ListArray32_compact_offsets_64(
+              chunkoffsets,
+              fromstarts + start,
+              fromstops + start,
+              stop - start);
+          });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6182,11 +6274,16 @@ namespace awkward {
       const uint32_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArrayU32_compact_offsets_64(
+        return parallel_offsets(
           tooffsets,
-          fromstarts,
-          fromstops,
-          length);
+          length,
+          [&](int64_t* chunkoffsets, int64_t start, int64_t stop) {
+            return awkward_ListArrayU32_compact_offsets_64(
+              chunkoffsets,
+              fromstarts + start,
+              fromstops + start,
+              stop - start);
+          });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6208,11 +6305,16 @@ namespace awkward {
       const int64_t *fromstops,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray64_compact_offsets_64(
+        return parallel_offsets(
           tooffsets,
-          fromstarts,
-          fromstops,
-          length);
+          length,
+          [&](int64_t* chunkoffsets, int64_t start, int64_t stop) {
+            return awkward_ListArray64_compact_offsets_64(
+              chunkoffsets,
+              fromstarts + start,
+              fromstops + start,
+              stop - start);
+          });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6333,13 +6435,23 @@ namespace awkward {
       const int32_t *fromstops,
       int64_t lencontent) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray32_broadcast_tooffsets_64(
-          tocarry,
-          fromoffsets,
-          offsetslength,
-          fromstarts,
-          fromstops,
-          lencontent);
+        // Each chunk of lists writes where its offsets say; check that those
+        // are in range before writing, as a chunk cannot see the lists
+        // before it.
+        return parallel_for(offsetslength - 1, [&](int64_t start, int64_t stop) -> ERROR {
+          if (start != 0  &&
+              (fromoffsets[start] < fromoffsets[0]  ||
+               fromoffsets[stop] > fromoffsets[offsetslength - 1])) {
+            return failure("broadcast's offsets must be monotonically increasing", 0, kSliceNone, nullptr);
+          }
+          return awkward_ListArray32_broadcast_tooffsets_64(
+            tocarry + (fromoffsets[start] - fromoffsets[0]),
+            fromoffsets + start,
+            stop - start + 1,
+            fromstarts + start,
+            fromstops + start,
+            lencontent);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6363,13 +6475,23 @@ namespace awkward {
       const uint32_t *fromstops,
       int64_t lencontent) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArrayU32_broadcast_tooffsets_64(
-          tocarry,
-          fromoffsets,
-          offsetslength,
-          fromstarts,
-          fromstops,
-          lencontent);
+        // Each chunk of lists writes where its offsets say; check that those
+        // are in range before writing, as a chunk cannot see the lists
+        // before it.
+        return parallel_for(offsetslength - 1, [&](int64_t start, int64_t stop) -> ERROR {
+          if (start != 0  &&
+              (fromoffsets[start] < fromoffsets[0]  ||
+               fromoffsets[stop] > fromoffsets[offsetslength - 1])) {
+            return failure("broadcast's offsets must be monotonically increasing", 0, kSliceNone, nullptr);
+          }
+          return awkward_ListArrayU32_broadcast_tooffsets_64(
+            tocarry + (fromoffsets[start] - fromoffsets[0]),
+            fromoffsets + start,
+            stop - start + 1,
+            fromstarts + start,
+            fromstops + start,
+            lencontent);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6393,13 +6515,23 @@ namespace awkward {
       const int64_t *fromstops,
       int64_t lencontent) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_ListArray64_broadcast_tooffsets_64(
-          tocarry,
-          fromoffsets,
-          offsetslength,
-          fromstarts,
-          fromstops,
-          lencontent);
+        // Each chunk of lists writes where its offsets say; check that those
+        // are in range before writing, as a chunk cannot see the lists
+        // before it.
+        return parallel_for(offsetslength - 1, [&](int64_t start, int64_t stop) -> ERROR {
+          if (start != 0  &&
+              (fromoffsets[start] < fromoffsets[0]  ||
+               fromoffsets[stop] > fromoffsets[offsetslength - 1])) {
+            return failure("broadcast's offsets must be monotonically increasing", 0, kSliceNone, nullptr);
+          }
+          return awkward_ListArray64_broadcast_tooffsets_64(
+            tocarry + (fromoffsets[start] - fromoffsets[0]),
+            fromoffsets + start,
+            stop - start + 1,
+            fromstarts + start,
+            fromstops + start,
+            lencontent);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6413,6 +6545,35 @@ namespace awkward {
       }
     }
 
+    ERROR RecordArray_getitem_carry_fields_64(
+      kernel::lib ptr_lib,
+      uint8_t **toptrs,
+      const uint8_t **fromptrs,
+      const int64_t *strides,
+      int64_t numfields,
+      const int64_t *carry,
+      int64_t lencarry) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_RecordArray_getitem_carry_fields_64(
+          toptrs,
+          fromptrs,
+          strides,
+          numfields,
+          carry,
+          lencarry);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for RecordArray_getitem_carry_fields_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for RecordArray_getitem_carry_fields_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     ERROR RegularArray_broadcast_tooffsets_64(
       kernel::lib ptr_lib,
       const int64_t *fromoffsets,
@@ -6541,11 +6702,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6567,11 +6730,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6593,11 +6758,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6619,11 +6786,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6645,11 +6814,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6671,11 +6842,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6697,11 +6870,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6723,11 +6898,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6749,11 +6926,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6775,11 +6954,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6801,11 +6982,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6879,11 +7062,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6904,11 +7089,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6929,11 +7116,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6954,11 +7143,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -6979,11 +7170,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7004,11 +7197,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7029,11 +7224,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7054,11 +7251,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7079,11 +7278,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7104,11 +7305,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7129,11 +7332,13 @@ namespace awkward {
       const bool *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_frombool(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_frombool(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7205,11 +7410,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7230,11 +7437,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7255,11 +7464,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7280,11 +7491,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7305,11 +7518,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7330,11 +7545,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7355,11 +7572,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7380,11 +7599,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7405,11 +7626,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7430,11 +7653,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7455,11 +7680,13 @@ namespace awkward {
       const int8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7531,11 +7758,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7556,11 +7785,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7581,11 +7812,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7606,11 +7839,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7631,11 +7866,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7656,11 +7893,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7681,11 +7920,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7706,11 +7947,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7731,11 +7974,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7756,11 +8001,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7781,11 +8028,13 @@ namespace awkward {
       const int16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7857,11 +8106,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7882,11 +8133,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7907,11 +8160,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7932,11 +8187,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7957,11 +8214,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -7982,11 +8241,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8007,11 +8268,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8032,11 +8295,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8057,11 +8322,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8082,11 +8349,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8107,11 +8376,13 @@ namespace awkward {
       const int32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8183,11 +8454,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8208,11 +8481,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8233,11 +8508,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8258,11 +8535,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8283,11 +8562,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8308,11 +8589,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8333,11 +8616,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8358,11 +8643,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8383,11 +8670,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8408,11 +8697,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8433,11 +8724,13 @@ namespace awkward {
       const int64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8509,11 +8802,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8534,11 +8829,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8559,11 +8856,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8584,11 +8883,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8609,11 +8910,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8634,11 +8937,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8659,11 +8964,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8684,11 +8991,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8709,11 +9018,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8734,11 +9045,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8759,11 +9072,13 @@ namespace awkward {
       const uint8_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromuint8(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromuint8(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8835,11 +9150,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8860,11 +9177,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8885,11 +9204,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8910,11 +9231,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8935,11 +9258,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8960,11 +9285,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -8985,11 +9312,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9010,11 +9339,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9035,11 +9366,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9060,11 +9393,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9085,11 +9420,13 @@ namespace awkward {
       const uint16_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromuint16(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromuint16(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9161,11 +9498,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9186,11 +9525,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9211,11 +9552,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9236,11 +9579,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9261,11 +9606,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9286,11 +9633,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9311,11 +9660,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9336,11 +9687,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9361,11 +9714,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9386,11 +9741,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9411,11 +9768,13 @@ namespace awkward {
       const uint32_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromuint32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromuint32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9487,11 +9846,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9512,11 +9873,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9537,11 +9900,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9562,11 +9927,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9587,11 +9954,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9612,11 +9981,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9637,11 +10008,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9662,11 +10035,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9687,11 +10062,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9712,11 +10089,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9737,11 +10116,13 @@ namespace awkward {
       const uint64_t *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromuint64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromuint64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9813,11 +10194,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9838,11 +10221,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9863,11 +10248,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9888,11 +10275,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9913,11 +10302,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9938,11 +10329,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9963,11 +10356,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -9988,11 +10383,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10013,11 +10410,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10038,11 +10437,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10063,11 +10464,13 @@ namespace awkward {
       const float *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromfloat32(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromfloat32(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10139,11 +10542,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tobool_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tobool_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10164,11 +10569,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint8_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint8_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10189,11 +10596,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint16_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint16_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10214,11 +10623,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint32_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint32_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10239,11 +10650,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_toint64_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_toint64_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10264,11 +10677,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint8_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint8_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10289,11 +10704,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint16_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint16_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10314,11 +10731,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint32_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint32_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10339,11 +10758,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_touint64_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_touint64_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10364,11 +10785,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat32_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat32_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -10389,11 +10812,13 @@ namespace awkward {
       const double *fromptr,
       int64_t length) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_NumpyArray_fill_tofloat64_fromfloat64(
-          toptr,
-          tooffset,
-          fromptr,
-          length);
+        return parallel_for(length, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_fill_tofloat64_fromfloat64(
+            toptr,
+            tooffset + start,
+            fromptr + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
@@ -13333,6 +13758,45 @@ namespace awkward {
       }
     }
 
+    ERROR ListArray_combinations_chunk_64(
+      kernel::lib ptr_lib,
+      int64_t **tocarry,
+      int64_t *toparents,
+      int64_t *tolength,
+      int64_t *index,
+      int64_t *position,
+      int64_t n,
+      bool replacement,
+      const int64_t *starts,
+      const int64_t *stops,
+      int64_t length,
+      int64_t maxlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_ListArray_combinations_chunk_64(
+          tocarry,
+          toparents,
+          tolength,
+          index,
+          position,
+          n,
+          replacement,
+          starts,
+          stops,
+          length,
+          maxlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for ListArray_combinations_chunk_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for ListArray_combinations_chunk_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     ERROR RegularArray_combinations_64(
       kernel::lib ptr_lib,
       int64_t **tocarry,
@@ -13391,106 +13855,332 @@ namespace awkward {
       }
     }
 
-    ERROR BitMaskedArray_to_ByteMaskedArray(
+    ERROR BitMaskedArray_getitem_carry_64(
       kernel::lib ptr_lib,
-      int8_t *tobytemask,
+      uint8_t *tobitmask,
       const uint8_t *frombitmask,
-      int64_t bitmasklength,
-      bool validwhen,
+      int64_t length,
+      const int64_t *fromcarry,
+      int64_t lencarry,
       bool lsb_order) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_BitMaskedArray_to_ByteMaskedArray(
-          tobytemask,
+        return awkward_BitMaskedArray_getitem_carry_64(
+          tobitmask,
           frombitmask,
-          bitmasklength,
-          validwhen,
+          length,
+          fromcarry,
+          lencarry,
           lsb_order);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_to_ByteMaskedArray")
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_getitem_carry_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for BitMaskedArray_to_ByteMaskedArray")
+          std::string("unrecognized ptr_lib for BitMaskedArray_getitem_carry_64")
           + FILENAME(__LINE__));
       }
     }
 
-    ERROR BitMaskedArray_to_IndexedOptionArray64(
+    ERROR BitMaskedArray_getitem_nextcarry_64(
       kernel::lib ptr_lib,
-      int64_t *toindex,
+      int64_t *tocarry,
       const uint8_t *frombitmask,
-      int64_t bitmasklength,
+      int64_t length,
       bool validwhen,
       bool lsb_order) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_BitMaskedArray_to_IndexedOptionArray64(
-          toindex,
+        return awkward_BitMaskedArray_getitem_nextcarry_64(
+          tocarry,
           frombitmask,
-          bitmasklength,
+          length,
           validwhen,
           lsb_order);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_to_IndexedOptionArray64")
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_getitem_nextcarry_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for BitMaskedArray_to_IndexedOptionArray64")
+          std::string("unrecognized ptr_lib for BitMaskedArray_getitem_nextcarry_64")
           + FILENAME(__LINE__));
       }
     }
 
-    /////////////////////////////////// awkward/kernels/reducers.h
-
-    ERROR reduce_count_64(
+    ERROR BitMaskedArray_getitem_nextcarry_outindex_64(
       kernel::lib ptr_lib,
-      int64_t *toptr,
-      const int64_t *parents,
-      int64_t lenparents,
-      int64_t outlength) {
+      int64_t *tocarry,
+      int64_t *outindex,
+      const uint8_t *frombitmask,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_count_64(
-          toptr,
-          parents,
-          lenparents,
-          outlength);
+        return awkward_BitMaskedArray_getitem_nextcarry_outindex_64(
+          tocarry,
+          outindex,
+          frombitmask,
+          length,
+          validwhen,
+          lsb_order);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_count_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_getitem_nextcarry_outindex_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_count_64")
+          std::string("unrecognized ptr_lib for BitMaskedArray_getitem_nextcarry_outindex_64")
           + FILENAME(__LINE__));
       }
     }
 
-    template<>
-    ERROR reduce_countnonzero_64(
+    ERROR BitMaskedArray_getitem_range(
       kernel::lib ptr_lib,
-      int64_t *toptr,
-      const bool *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
-      int64_t outlength) {
+      uint8_t *tobitmask,
+      const uint8_t *frombitmask,
+      int64_t start,
+      int64_t length,
+      bool lsb_order) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_countnonzero_bool_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return awkward_BitMaskedArray_getitem_range(
+          tobitmask,
+          frombitmask,
+          start,
+          length,
+          lsb_order);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_getitem_range")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_getitem_range")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR BitMaskedArray_numnull(
+      kernel::lib ptr_lib,
+      int64_t *numnull,
+      const uint8_t *frombitmask,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_BitMaskedArray_numnull(
+          numnull,
+          frombitmask,
+          length,
+          validwhen,
+          lsb_order);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_numnull")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_numnull")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR BitMaskedArray_overlay_mask(
+      kernel::lib ptr_lib,
+      uint8_t *tobitmask,
+      const uint8_t *outerbitmask,
+      bool outervalidwhen,
+      const uint8_t *innerbitmask,
+      bool innervalidwhen,
+      int64_t bitmasklength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_BitMaskedArray_overlay_mask(
+          tobitmask,
+          outerbitmask,
+          outervalidwhen,
+          innerbitmask,
+          innervalidwhen,
+          bitmasklength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_overlay_mask")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_overlay_mask")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR BitMaskedArray_reduce_next_64(
+      kernel::lib ptr_lib,
+      int64_t *nextcarry,
+      int64_t *nextparents,
+      int64_t *outindex,
+      const uint8_t *frombitmask,
+      const int64_t *parents,
+      int64_t length,
+      bool validwhen,
+      bool lsb_order) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_BitMaskedArray_reduce_next_64(
+          nextcarry,
+          nextparents,
+          outindex,
+          frombitmask,
+          parents,
+          length,
+          validwhen,
+          lsb_order);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_reduce_next_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_reduce_next_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR BitMaskedArray_to_ByteMaskedArray(
+      kernel::lib ptr_lib,
+      int8_t *tobytemask,
+      const uint8_t *frombitmask,
+      int64_t bitmasklength,
+      bool validwhen,
+      bool lsb_order) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_BitMaskedArray_to_ByteMaskedArray(
+          tobytemask,
+          frombitmask,
+          bitmasklength,
+          validwhen,
+          lsb_order);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_to_ByteMaskedArray")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_to_ByteMaskedArray")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR BitMaskedArray_to_IndexedOptionArray64(
+      kernel::lib ptr_lib,
+      int64_t *toindex,
+      const uint8_t *frombitmask,
+      int64_t bitmasklength,
+      bool validwhen,
+      bool lsb_order) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_BitMaskedArray_to_IndexedOptionArray64(
+          toindex,
+          frombitmask,
+          bitmasklength,
+          validwhen,
+          lsb_order);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for BitMaskedArray_to_IndexedOptionArray64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for BitMaskedArray_to_IndexedOptionArray64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    /////////////////////////////////// awkward/kernels/reducers.h
+
+    ERROR reduce_count_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_count_64(
+          toptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_count_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_count_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    ERROR reduce_count_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_count_offsets_64(
+            toptr + start,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_count_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_count_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_countnonzero_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const bool *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_countnonzero_bool_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_64")
           + FILENAME(__LINE__));
       }
       else {
@@ -13837,309 +14527,309 @@ namespace awkward {
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
       const bool *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int64_bool_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_bool_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
-      const int8_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int64_int8_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
-      const uint8_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      int64_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint64_uint8_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
       const int16_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int64_int16_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      int64_t *toptr,
       const uint16_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint64_uint16_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
       const int32_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int64_int32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      int64_t *toptr,
       const uint32_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint64_uint32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
       const int64_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int64_int64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_int64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      int64_t *toptr,
       const uint64_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint64_uint64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_uint64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      float *toptr,
+      int64_t *toptr,
       const float *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_float32_float32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_float32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_64(
+    ERROR reduce_countnonzero_offsets_64(
       kernel::lib ptr_lib,
-      std::complex<float> *toptr,
-      const std::complex<float> *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      int64_t *toptr,
+      const double *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_complex64_complex64_64(
-          reinterpret_cast<float*>(toptr),
-          reinterpret_cast<const float*>(fromptr),
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_countnonzero_offsets_float64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_64")
+          std::string("unrecognized ptr_lib for reduce_countnonzero_offsets_64")
           + FILENAME(__LINE__));
       }
     }
@@ -14147,15 +14837,15 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      std::complex<double> *toptr,
-      const std::complex<double> *fromptr,
+      int64_t *toptr,
+      const bool *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_complex128_complex128_64(
-          reinterpret_cast<double*>(toptr),
-          reinterpret_cast<const double*>(fromptr),
+        return awkward_reduce_sum_int64_bool_64(
+          toptr,
+          fromptr,
           parents,
           lenparents,
           outlength);
@@ -14175,13 +14865,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      double *toptr,
-      const double *fromptr,
+      int64_t *toptr,
+      const int8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_float64_float64_64(
+        return awkward_reduce_sum_int64_int8_64(
           toptr,
           fromptr,
           parents,
@@ -14203,13 +14893,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      int32_t *toptr,
-      const bool *fromptr,
+      uint64_t *toptr,
+      const uint8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int32_bool_64(
+        return awkward_reduce_sum_uint64_uint8_64(
           toptr,
           fromptr,
           parents,
@@ -14231,13 +14921,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      int32_t *toptr,
-      const int8_t *fromptr,
+      int64_t *toptr,
+      const int16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int32_int8_64(
+        return awkward_reduce_sum_int64_int16_64(
           toptr,
           fromptr,
           parents,
@@ -14259,13 +14949,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      uint32_t *toptr,
-      const uint8_t *fromptr,
+      uint64_t *toptr,
+      const uint16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint32_uint8_64(
+        return awkward_reduce_sum_uint64_uint16_64(
           toptr,
           fromptr,
           parents,
@@ -14287,13 +14977,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      int32_t *toptr,
-      const int16_t *fromptr,
+      int64_t *toptr,
+      const int32_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int32_int16_64(
+        return awkward_reduce_sum_int64_int32_64(
           toptr,
           fromptr,
           parents,
@@ -14315,13 +15005,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      uint32_t *toptr,
-      const uint16_t *fromptr,
+      uint64_t *toptr,
+      const uint32_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint32_uint16_64(
+        return awkward_reduce_sum_uint64_uint32_64(
           toptr,
           fromptr,
           parents,
@@ -14343,13 +15033,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      int32_t *toptr,
-      const int32_t *fromptr,
+      int64_t *toptr,
+      const int64_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_int32_int32_64(
+        return awkward_reduce_sum_int64_int64_64(
           toptr,
           fromptr,
           parents,
@@ -14371,13 +15061,13 @@ namespace awkward {
     template<>
     ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      uint32_t *toptr,
-      const uint32_t *fromptr,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_uint32_uint32_64(
+        return awkward_reduce_sum_uint64_uint64_64(
           toptr,
           fromptr,
           parents,
@@ -14397,15 +15087,15 @@ namespace awkward {
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const bool *fromptr,
+      float *toptr,
+      const float *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_bool_64(
+        return awkward_reduce_sum_float32_float32_64(
           toptr,
           fromptr,
           parents,
@@ -14414,82 +15104,82 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const int8_t *fromptr,
+      std::complex<float> *toptr,
+      const std::complex<float> *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_int8_64(
-          toptr,
-          fromptr,
+        return awkward_reduce_sum_complex64_complex64_64(
+          reinterpret_cast<float*>(toptr),
+          reinterpret_cast<const float*>(fromptr),
           parents,
           lenparents,
           outlength);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const uint8_t *fromptr,
+      std::complex<double> *toptr,
+      const std::complex<double> *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_uint8_64(
-          toptr,
-          fromptr,
+        return awkward_reduce_sum_complex128_complex128_64(
+          reinterpret_cast<double*>(toptr),
+          reinterpret_cast<const double*>(fromptr),
           parents,
           lenparents,
           outlength);
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const int16_t *fromptr,
+      double *toptr,
+      const double *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_int16_64(
+        return awkward_reduce_sum_float64_float64_64(
           toptr,
           fromptr,
           parents,
@@ -14498,26 +15188,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const uint16_t *fromptr,
+      int32_t *toptr,
+      const bool *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_uint16_64(
+        return awkward_reduce_sum_int32_bool_64(
           toptr,
           fromptr,
           parents,
@@ -14526,26 +15216,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const int32_t *fromptr,
+      int32_t *toptr,
+      const int8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_int32_64(
+        return awkward_reduce_sum_int32_int8_64(
           toptr,
           fromptr,
           parents,
@@ -14554,26 +15244,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const uint32_t *fromptr,
+      uint32_t *toptr,
+      const uint8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_uint32_64(
+        return awkward_reduce_sum_uint32_uint8_64(
           toptr,
           fromptr,
           parents,
@@ -14582,26 +15272,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const int64_t *fromptr,
+      int32_t *toptr,
+      const int16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_int64_64(
+        return awkward_reduce_sum_int32_int16_64(
           toptr,
           fromptr,
           parents,
@@ -14610,26 +15300,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_sum_64(
       kernel::lib ptr_lib,
-      bool *toptr,
-      const uint64_t *fromptr,
+      uint32_t *toptr,
+      const uint16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_uint64_64(
+        return awkward_reduce_sum_uint32_uint16_64(
           toptr,
           fromptr,
           parents,
@@ -14638,26 +15328,1146 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_sum_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_int32_int32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_uint32_uint32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int64_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint64_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int64_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint64_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int64_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint64_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int64_int64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint64_uint64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      float *toptr,
+      const float *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_float32_float32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      double *toptr,
+      const double *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_float64_float64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int32_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint32_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int32_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint32_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_int32_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_offsets_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_sum_offsets_uint32_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const bool *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_bool_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const int8_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_int8_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const uint8_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_uint8_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const int16_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_int16_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const uint16_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_uint16_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const int32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_int32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const uint32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_uint32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const int64_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_int64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const uint64_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_uint64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const float *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_float32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const double *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_float64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const std::complex<float> *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_complex64_64(
+          toptr,
+          reinterpret_cast<const float*>(fromptr),
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_sum_bool_64(
+      kernel::lib ptr_lib,
+      bool *toptr,
+      const std::complex<double> *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_sum_bool_complex128_64(
+          toptr,
+          reinterpret_cast<const double*>(fromptr),
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const bool *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_int64_bool_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      bool *toptr,
+      int64_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_int64_int8_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint8_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_uint64_uint8_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_int64_int16_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_uint64_uint16_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_int64_int32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_uint64_uint32_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_int64_int64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_prod_uint64_uint64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_64(
+      kernel::lib ptr_lib,
+      float *toptr,
       const float *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_float32_64(
+        return awkward_reduce_prod_float32_float32_64(
           toptr,
           fromptr,
           parents,
@@ -14666,26 +16476,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_prod_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      bool *toptr,
+      double *toptr,
       const double *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_float64_64(
+        return awkward_reduce_prod_float64_float64_64(
           toptr,
           fromptr,
           parents,
@@ -14694,27 +16504,26 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_prod_64")
           + FILENAME(__LINE__));
       }
     }
-
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      bool *toptr,
+      std::complex<float> *toptr,
       const std::complex<float> *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_complex64_64(
-          toptr,
+        return awkward_reduce_prod_complex64_complex64_64(
+          reinterpret_cast<float*>(toptr),
           reinterpret_cast<const float*>(fromptr),
           parents,
           lenparents,
@@ -14722,27 +16531,27 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_prod_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_sum_bool_64(
+    ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      bool *toptr,
+      std::complex<double> *toptr,
       const std::complex<double> *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_sum_bool_complex128_64(
-          toptr,
+        return awkward_reduce_prod_complex128_complex128_64(
+          reinterpret_cast<double*>(toptr),
           reinterpret_cast<const double*>(fromptr),
           parents,
           lenparents,
@@ -14750,12 +16559,12 @@ namespace awkward {
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_sum_bool_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_sum_bool_64")
+          std::string("unrecognized ptr_lib for reduce_prod_64")
           + FILENAME(__LINE__));
       }
     }
@@ -14763,13 +16572,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      int64_t *toptr,
+      int32_t *toptr,
       const bool *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int64_bool_64(
+        return awkward_reduce_prod_int32_bool_64(
           toptr,
           fromptr,
           parents,
@@ -14791,13 +16600,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      int64_t *toptr,
+      int32_t *toptr,
       const int8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int64_int8_64(
+        return awkward_reduce_prod_int32_int8_64(
           toptr,
           fromptr,
           parents,
@@ -14819,13 +16628,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      uint32_t *toptr,
       const uint8_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint64_uint8_64(
+        return awkward_reduce_prod_uint32_uint8_64(
           toptr,
           fromptr,
           parents,
@@ -14847,13 +16656,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      int64_t *toptr,
+      int32_t *toptr,
       const int16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int64_int16_64(
+        return awkward_reduce_prod_int32_int16_64(
           toptr,
           fromptr,
           parents,
@@ -14875,13 +16684,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      uint32_t *toptr,
       const uint16_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint64_uint16_64(
+        return awkward_reduce_prod_uint32_uint16_64(
           toptr,
           fromptr,
           parents,
@@ -14903,13 +16712,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      int64_t *toptr,
+      int32_t *toptr,
       const int32_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int64_int32_64(
+        return awkward_reduce_prod_int32_int32_64(
           toptr,
           fromptr,
           parents,
@@ -14931,13 +16740,13 @@ namespace awkward {
     template<>
     ERROR reduce_prod_64(
       kernel::lib ptr_lib,
-      uint64_t *toptr,
+      uint32_t *toptr,
       const uint32_t *fromptr,
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint64_uint32_64(
+        return awkward_reduce_prod_uint32_uint32_64(
           toptr,
           fromptr,
           parents,
@@ -14957,364 +16766,449 @@ namespace awkward {
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       int64_t *toptr,
-      const int64_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int8_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int64_int64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int64_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       uint64_t *toptr,
-      const uint64_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint64_uint64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint64_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
-      float *toptr,
-      const float *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      int64_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_float32_float32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int64_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
-      double *toptr,
-      const double *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      uint64_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_float64_float64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint64_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
+
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
-      std::complex<float> *toptr,
-      const std::complex<float> *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      int64_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_complex64_complex64_64(
-          reinterpret_cast<float*>(toptr),
-          reinterpret_cast<const float*>(fromptr),
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int64_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
-      std::complex<double> *toptr,
-      const std::complex<double> *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      uint64_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_complex128_complex128_64(
-          reinterpret_cast<double*>(toptr),
-          reinterpret_cast<const double*>(fromptr),
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint64_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
-      int32_t *toptr,
-      const bool *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      int64_t *toptr,
+      const int64_t *fromptr,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int32_bool_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int64_int64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint64_uint64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_offsets_64(
+      kernel::lib ptr_lib,
+      float *toptr,
+      const float *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_float32_float32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_offsets_64(
+      kernel::lib ptr_lib,
+      double *toptr,
+      const double *fromptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_float64_float64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       int32_t *toptr,
       const int8_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int32_int8_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int32_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       uint32_t *toptr,
       const uint8_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint32_uint8_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint32_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       int32_t *toptr,
       const int16_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int32_int16_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int32_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       uint32_t *toptr,
       const uint16_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint32_uint16_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint32_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       int32_t *toptr,
       const int32_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_int32_int32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_int32_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_prod_64(
+    ERROR reduce_prod_offsets_64(
       kernel::lib ptr_lib,
       uint32_t *toptr,
       const uint32_t *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      const int64_t *offsets,
       int64_t outlength) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_prod_uint32_uint32_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_prod_offsets_uint32_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_prod_64")
+          std::string("unrecognized ptr_lib for reduce_prod_offsets_64")
           + FILENAME(__LINE__));
       }
     }
@@ -15961,84 +17855,384 @@ namespace awkward {
       const int64_t *parents,
       int64_t lenparents,
       int64_t outlength,
-      double identity) {
+      double identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_min_float64_float64_64(
+          toptr,
+          fromptr,
+          parents,
+          lenparents,
+          outlength,
+          identity);
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_64(
+      kernel::lib ptr_lib,
+      std::complex<float> *toptr,
+      const std::complex<float> *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength,
+      std::complex<float> identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_min_complex64_complex64_64(
+          reinterpret_cast<float*>(toptr),
+          reinterpret_cast<const float*>(fromptr),
+          parents,
+          lenparents,
+          outlength,
+          identity.real());
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_64(
+      kernel::lib ptr_lib,
+      std::complex<double> *toptr,
+      const std::complex<double> *fromptr,
+      const int64_t *parents,
+      int64_t lenparents,
+      int64_t outlength,
+      std::complex<double> identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return awkward_reduce_min_complex128_complex128_64(
+          reinterpret_cast<double*>(toptr),
+          reinterpret_cast<const double*>(fromptr),
+          parents,
+          lenparents,
+          outlength,
+          identity.real());
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      int8_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int8_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_int8_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      uint8_t *toptr,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint8_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_uint8_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      int16_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int16_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_int16_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      uint16_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint16_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_uint16_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int32_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_int32_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint32_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_uint32_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int64_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_int64_int64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_min_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint64_t identity) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_min_float64_float64_64(
-          toptr,
-          fromptr,
-          parents,
-          lenparents,
-          outlength,
-          identity);
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_uint64_uint64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_min_64")
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_min_64(
+    ERROR reduce_min_offsets_64(
       kernel::lib ptr_lib,
-      std::complex<float> *toptr,
-      const std::complex<float> *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      float *toptr,
+      const float *fromptr,
+      const int64_t *offsets,
       int64_t outlength,
-      std::complex<float> identity) {
+      float identity) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_min_complex64_complex64_64(
-          reinterpret_cast<float*>(toptr),
-          reinterpret_cast<const float*>(fromptr),
-          parents,
-          lenparents,
-          outlength,
-          identity.real());
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_float32_float32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_min_64")
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
     }
 
     template<>
-    ERROR reduce_min_64(
+    ERROR reduce_min_offsets_64(
       kernel::lib ptr_lib,
-      std::complex<double> *toptr,
-      const std::complex<double> *fromptr,
-      const int64_t *parents,
-      int64_t lenparents,
+      double *toptr,
+      const double *fromptr,
+      const int64_t *offsets,
       int64_t outlength,
-      std::complex<double> identity) {
+      double identity) {
       if (ptr_lib == kernel::lib::cpu) {
-        return awkward_reduce_min_complex128_complex128_64(
-          reinterpret_cast<double*>(toptr),
-          reinterpret_cast<const double*>(fromptr),
-          parents,
-          lenparents,
-          outlength,
-          identity.real());
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_min_offsets_float64_float64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
       }
       else if (ptr_lib == kernel::lib::cuda) {
         throw std::runtime_error(
-          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_64")
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
       else {
         throw std::runtime_error(
-          std::string("unrecognized ptr_lib for reduce_min_64")
+          std::string("unrecognized ptr_lib for reduce_min_offsets_64")
           + FILENAME(__LINE__));
       }
     }
@@ -16403,6 +18597,306 @@ namespace awkward {
       }
     }
 
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      int8_t *toptr,
+      const int8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int8_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_int8_int8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      uint8_t *toptr,
+      const uint8_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint8_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_uint8_uint8_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      int16_t *toptr,
+      const int16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int16_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_int16_int16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      uint16_t *toptr,
+      const uint16_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint16_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_uint16_uint16_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      int32_t *toptr,
+      const int32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int32_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_int32_int32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      uint32_t *toptr,
+      const uint32_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint32_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_uint32_uint32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      int64_t *toptr,
+      const int64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      int64_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_int64_int64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      uint64_t *toptr,
+      const uint64_t *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      uint64_t identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_uint64_uint64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      float *toptr,
+      const float *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      float identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_float32_float32_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
+    template<>
+    ERROR reduce_max_offsets_64(
+      kernel::lib ptr_lib,
+      double *toptr,
+      const double *fromptr,
+      const int64_t *offsets,
+      int64_t outlength,
+      double identity) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_reduce_max_offsets_float64_float64_64(
+            toptr + start,
+            fromptr,
+            offsets + start,
+            stop - start,
+            identity);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for reduce_max_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     template<>
     ERROR reduce_argmin_64(
       kernel::lib ptr_lib,
@@ -17755,6 +20249,31 @@ namespace awkward {
       }
     }
 
+    ERROR NumpyArray_reduce_mask_ByteMaskedArray_offsets_64(
+      kernel::lib ptr_lib,
+      int8_t *toptr,
+      const int64_t *offsets,
+      int64_t outlength) {
+      if (ptr_lib == kernel::lib::cpu) {
+        return parallel_for(outlength, [&](int64_t start, int64_t stop) {
+          return awkward_NumpyArray_reduce_mask_ByteMaskedArray_offsets_64(
+            toptr + start,
+            offsets + start,
+            stop - start);
+        });
+      }
+      else if (ptr_lib == kernel::lib::cuda) {
+        throw std::runtime_error(
+          std::string("not implemented: ptr_lib == cuda_kernels for NumpyArray_reduce_mask_ByteMaskedArray_offsets_64")
+          + FILENAME(__LINE__));
+      }
+      else {
+        throw std::runtime_error(
+          std::string("unrecognized ptr_lib for NumpyArray_reduce_mask_ByteMaskedArray_offsets_64")
+          + FILENAME(__LINE__));
+      }
+    }
+
     ERROR ByteMaskedArray_reduce_next_64(
       kernel::lib ptr_lib,
       int64_t *nextcarry,
@@ -0,0 +1,465 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/kernel-parallel.cpp", line)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _MSC_VER
+  #include <unistd.h>
+#endif
+
+#include "awkward/kernel-allocator.h"
+#include "awkward/kernel-parallel.h"
+
+namespace awkward {
+  namespace kernel {
+    namespace {
+      /// @brief True on the worker threads of a ThreadPool, so that nested
+      /// parallel calls run serially instead of waiting on their own pool.
+      thread_local bool in_worker = false;
+
+      int64_t
+      hardware_threads() {
+        int64_t out = (int64_t)std::thread::hardware_concurrency();
+        return out > 0 ? out : 1;
+      }
+
+      int64_t
+      num_threads_from_environment() {
+        const char* value = std::getenv("AWKWARD_NUM_THREADS");
+        if (value == nullptr) {
+          return 1;
+        }
+        char* end = nullptr;
+        long long out = std::strtoll(value, &end, 10);
+        if (end == value  ||  *end != '\0'  ||  out < 0) {
+          return 1;
+        }
+        return out == 0 ? hardware_threads() : (int64_t)out;
+      }
+
+      std::atomic<int64_t> requested_threads(num_threads_from_environment());
+
+      /// @class ThreadPool
+      ///
+      /// @brief Fixed set of worker threads taking tasks from a queue.
+      class ThreadPool {
+      public:
+        ThreadPool(int64_t size)
+            : stopping_(false) {
+          for (int64_t i = 0;  i < size;  i++) {
+            workers_.emplace_back([this]() { work(); });
+          }
+        }
+
+        ~ThreadPool() {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+          }
+          ready_.notify_all();
+          for (auto& worker : workers_) {
+            worker.join();
+          }
+        }
+
+        int64_t
+        size() const {
+          std::lock_guard<std::mutex> lock(mutex_);
+          return (int64_t)workers_.size();
+        }
+
+        /// @brief Starts more workers, if needed, to have at least `size`.
+        void
+        grow(int64_t size) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          while ((int64_t)workers_.size() < size) {
+            workers_.emplace_back([this]() { work(); });
+          }
+        }
+
+        void
+        submit(const std::function<void()>& task) {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(task);
+          }
+          ready_.notify_one();
+        }
+
+      private:
+        void
+        work() {
+          in_worker = true;
+          while (true) {
+            std::function<void()> task;
+            {
+              std::unique_lock<std::mutex> lock(mutex_);
+              ready_.wait(lock, [this]() {
+                return stopping_  ||  !tasks_.empty();
+              });
+              if (tasks_.empty()) {
+                return;
+              }
+              task = tasks_.front();
+              tasks_.pop_front();
+            }
+            task();
+          }
+        }
+
+        std::vector<std::thread> workers_;
+        std::deque<std::function<void()>> tasks_;
+        mutable std::mutex mutex_;
+        std::condition_variable ready_;
+        bool stopping_;
+      };
+
+      std::mutex pool_mutex;
+      std::shared_ptr<ThreadPool> pool;
+#ifndef _MSC_VER
+      pid_t pool_pid = 0;
+#endif
+
+      /// @brief Returns a pool with at least `size` workers, (re)starting it
+      /// if it is smaller or if this process is a fork of the one that
+      /// started it (whose worker threads do not exist here).
+      std::shared_ptr<ThreadPool>
+      get_pool(int64_t size) {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+#ifndef _MSC_VER
+        if (pool.get() != nullptr  &&  pool_pid != getpid()) {
+          // Cannot join threads of the parent process: leak the old pool.
+          new std::shared_ptr<ThreadPool>(pool);
+          pool.reset();
+        }
+        pool_pid = getpid();
+#endif
+        if (pool.get() == nullptr  ||  pool.get()->size() < size) {
+          pool = std::make_shared<ThreadPool>(size);
+        }
+        return pool;
+      }
+
+      std::atomic<int64_t> requested_background_threads(4);
+
+      /// @brief Never destroyed (see kernel::background); protected by
+      /// pool_mutex, like pool.
+      ThreadPool* background_pool = nullptr;
+#ifndef _MSC_VER
+      pid_t background_pool_pid = 0;
+#endif
+
+      std::mutex background_wait_mutex;
+      std::function<void(const std::function<void()>&)> background_wait_wrap;
+
+      /// @brief Counts down finished tasks and holds the first exception.
+      class Latch {
+      public:
+        Latch(int64_t count)
+            : count_(count) { }
+
+        void
+        done(std::exception_ptr exception) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (exception  &&  !exception_) {
+            exception_ = exception;
+          }
+          count_--;
+          if (count_ == 0) {
+            finished_.notify_all();
+          }
+        }
+
+        void
+        wait() {
+          std::unique_lock<std::mutex> lock(mutex_);
+          finished_.wait(lock, [this]() { return count_ == 0; });
+          if (exception_) {
+            std::rethrow_exception(exception_);
+          }
+        }
+
+      private:
+        int64_t count_;
+        std::exception_ptr exception_;
+        std::mutex mutex_;
+        std::condition_variable finished_;
+      };
+
+      /// @brief Number of chunks to split `length` items into: 1 if the
+      /// work should stay on the calling thread.
+      int64_t
+      number_of_chunks(int64_t length) {
+        int64_t threads = requested_threads.load();
+        if (threads <= 1  ||  length < kParallelMinLength  ||  in_worker) {
+          return 1;
+        }
+        return std::min(threads, length / (kParallelMinLength / 4));
+      }
+
+      /// @brief Calls `task(i)` for each `i` in `[0, chunks)`, the first on
+      /// the calling thread and the rest on the pool, and waits for them.
+      void
+      run_chunks(int64_t chunks, const std::function<void(int64_t)>& task) {
+        // Size the pool by the setting, not by this call, so that it is not
+        // restarted for every different length.
+        std::shared_ptr<ThreadPool> workers =
+          get_pool(std::max(chunks, requested_threads.load()) - 1);
+        Latch latch(chunks - 1);
+        const AllocatorPtr& allocator = thread_allocator();
+        for (int64_t i = 1;  i < chunks;  i++) {
+          workers.get()->submit([&task, &latch, &allocator, i]() {
+            std::exception_ptr exception;
+            try {
+              AllocatorScope scope(allocator);
+              task(i);
+            }
+            catch (...) {
+              exception = std::current_exception();
+            }
+            latch.done(exception);
+          });
+        }
+        std::exception_ptr exception;
+        try {
+          task(0);
+        }
+        catch (...) {
+          exception = std::current_exception();
+        }
+        latch.wait();
+        if (exception) {
+          std::rethrow_exception(exception);
+        }
+      }
+
+      ERROR
+      first_failure(const std::vector<struct Error>& errors,
+                    const std::vector<int64_t>& starts) {
+        for (size_t i = 0;  i < errors.size();  i++) {
+          if (errors[i].str != nullptr) {
+            struct Error out = errors[i];
+            if (out.identity != kSliceNone) {
+              out.identity += starts[i];
+            }
+            return out;
+          }
+        }
+        return success();
+      }
+    }
+
+    int64_t
+    num_threads() {
+      return requested_threads.load();
+    }
+
+    void
+    set_num_threads(int64_t num_threads) {
+      if (num_threads < 0) {
+        throw std::invalid_argument(
+          std::string("num_threads must be non-negative")
+          + FILENAME(__LINE__));
+      }
+      requested_threads.store(num_threads == 0 ? hardware_threads()
+                                               : num_threads);
+    }
+
+    ERROR
+    parallel_for(int64_t length,
+                 const std::function<ERROR(int64_t start,
+                                           int64_t stop)>& chunk) {
+      int64_t chunks = number_of_chunks(length);
+      if (chunks == 1) {
+        return chunk(0, length);
+      }
+
+      std::vector<int64_t> starts((size_t)chunks + 1);
+      for (int64_t i = 0;  i <= chunks;  i++) {
+        starts[(size_t)i] = (length * i) / chunks;
+      }
+      std::vector<struct Error> errors((size_t)chunks);
+      run_chunks(chunks, [&](int64_t i) {
+        errors[(size_t)i] = chunk(starts[(size_t)i], starts[(size_t)i + 1]);
+      });
+      return first_failure(errors, starts);
+    }
+
+    void
+    parallel_tasks(int64_t numtasks,
+                   const std::function<void(int64_t i)>& task) {
+      parallel_tasks(numtasks, task, requested_threads.load());
+    }
+
+    void
+    parallel_tasks(int64_t numtasks,
+                   const std::function<void(int64_t i)>& task,
+                   int64_t num_threads) {
+      if (num_threads < 0) {
+        throw std::invalid_argument(
+          std::string("num_threads must be non-negative")
+          + FILENAME(__LINE__));
+      }
+      int64_t threads = std::min(num_threads == 0 ? hardware_threads()
+                                                  : num_threads,
+                                 numtasks);
+      bool was_in_worker = in_worker;
+      if (threads <= 1  ||  was_in_worker) {
+        for (int64_t i = 0;  i < numtasks;  i++) {
+          task(i);
+        }
+        return;
+      }
+
+      std::atomic<int64_t> next(0);
+      std::atomic<bool> failed(false);
+      in_worker = true;
+      try {
+        run_chunks(threads, [&](int64_t) {
+          int64_t i;
+          while (!failed.load()  &&  (i = next.fetch_add(1)) < numtasks) {
+            try {
+              task(i);
+            }
+            catch (...) {
+              failed.store(true);
+              throw;
+            }
+          }
+        });
+      }
+      catch (...) {
+        in_worker = was_in_worker;
+        throw;
+      }
+      in_worker = was_in_worker;
+    }
+
+    ERROR
+    parallel_offsets(int64_t* tooffsets,
+                     int64_t length,
+                     const std::function<ERROR(int64_t* chunkoffsets,
+                                               int64_t start,
+                                               int64_t stop)>& chunk) {
+      int64_t chunks = number_of_chunks(length);
+      if (chunks == 1) {
+        return chunk(tooffsets, 0, length);
+      }
+
+      std::vector<int64_t> starts((size_t)chunks + 1);
+      for (int64_t i = 0;  i <= chunks;  i++) {
+        starts[(size_t)i] = (length * i) / chunks;
+      }
+
+      // First pass: the first chunk goes straight into tooffsets; the others
+      // would overwrite their neighbor's last entry, so they get their own.
+      std::vector<std::vector<int64_t>> local((size_t)chunks);
+      std::vector<struct Error> errors((size_t)chunks);
+      run_chunks(chunks, [&](int64_t i) {
+        int64_t start = starts[(size_t)i];
+        int64_t stop = starts[(size_t)i + 1];
+        if (i == 0) {
+          errors[0] = chunk(tooffsets, start, stop);
+        }
+        else {
+          local[(size_t)i].resize((size_t)(stop - start + 1));
+          errors[(size_t)i] = chunk(local[(size_t)i].data(), start, stop);
+        }
+      });
+      struct Error err = first_failure(errors, starts);
+      if (err.str != nullptr) {
+        return err;
+      }
+
+      // Second pass: shift each chunk by the total before it.
+      std::vector<int64_t> bases((size_t)chunks);
+      bases[0] = 0;
+      bases[1] = tooffsets[starts[1]];
+      for (int64_t i = 2;  i < chunks;  i++) {
+        bases[(size_t)i] = bases[(size_t)i - 1] + local[(size_t)i - 1].back();
+      }
+      run_chunks(chunks, [&](int64_t i) {
+        if (i != 0) {
+          int64_t start = starts[(size_t)i];
+          int64_t base = bases[(size_t)i];
+          const std::vector<int64_t>& offsets = local[(size_t)i];
+          for (size_t j = 1;  j < offsets.size();  j++) {
+            tooffsets[start + (int64_t)j] = base + offsets[j];
+          }
+        }
+      });
+      return success();
+    }
+
+    int64_t
+    num_background_threads() {
+      return requested_background_threads.load();
+    }
+
+    void
+    set_num_background_threads(int64_t num_threads) {
+      if (num_threads < 0) {
+        throw std::invalid_argument(
+          std::string("num_threads must be non-negative")
+          + FILENAME(__LINE__));
+      }
+      requested_background_threads.store(num_threads == 0 ? hardware_threads()
+                                                          : num_threads);
+    }
+
+    void
+    background(const std::function<void()>& task) {
+      ThreadPool* workers;
+      {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+#ifndef _MSC_VER
+        if (background_pool != nullptr  &&  background_pool_pid != getpid()) {
+          // As in get_pool, the parent's worker threads do not exist here.
+          background_pool = nullptr;
+        }
+        background_pool_pid = getpid();
+#endif
+        if (background_pool == nullptr) {
+          background_pool = new ThreadPool(0);
+        }
+        background_pool->grow(requested_background_threads.load());
+        workers = background_pool;
+      }
+      workers->submit(task);
+    }
+
+    void
+    background_wait(const std::function<void()>& block) {
+      std::function<void(const std::function<void()>&)> wrap;
+      {
+        std::lock_guard<std::mutex> lock(background_wait_mutex);
+        wrap = background_wait_wrap;
+      }
+      if (wrap) {
+        wrap(block);
+      }
+      else {
+        block();
+      }
+    }
+
+    void
+    set_background_wait(
+      const std::function<void(const std::function<void()>& block)>& wrap) {
+      std::lock_guard<std::mutex> lock(background_wait_mutex);
+      background_wait_wrap = wrap;
+    }
+  }
+}
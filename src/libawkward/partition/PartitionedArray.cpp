@@ -4,6 +4,7 @@
 #define FILENAME_C(line) FILENAME_FOR_EXCEPTIONS_C("src/libawkward/partition/PartitionedArray.cpp", line)
 
 #include "awkward/kernel-utils.h"
+#include "awkward/kernel-parallel.h"
 #include "awkward/io/json.h"
 
 #include "awkward/partition/IrregularlyPartitionedArray.h"
@@ -52,6 +53,25 @@ namespace awkward {
       builder.endlist();
       return builder.tostring();
     }
+    else if (kernel::num_threads() > 1  &&  numpartitions() > 1) {
+      std::vector<std::string> parts(partitions_.size());
+      kernel::parallel_tasks(numpartitions(), [&](int64_t i) {
+        parts[(size_t)i] = partitions_[(size_t)i].get()->tojson(false,
+                                                               maxdecimals);
+      });
+      // Each part is a list, "[...]": join their insides.
+      std::string out("[");
+      for (auto part : parts) {
+        if (part.size() > 2) {
+          if (out.size() > 1) {
+            out.append(",");
+          }
+          out.append(part, 1, part.size() - 2);
+        }
+      }
+      out.append("]");
+      return out;
+    }
     else {
       ToJsonString builder(maxdecimals);
       builder.beginlist();
@@ -86,6 +106,22 @@ namespace awkward {
     }
   }
 
+  const PartitionedArrayPtr
+  PartitionedArray::map_partitions(
+    const std::function<const ContentPtr(const ContentPtr&)>& function) const {
+    ContentPtrVec partitions(partitions_.size());
+    kernel::parallel_tasks(numpartitions(), [&](int64_t i) {
+      partitions[(size_t)i] = function(partitions_[(size_t)i]);
+    });
+    std::vector<int64_t> stops;
+    int64_t total_length = 0;
+    for (auto p : partitions) {
+      total_length += p.get()->length();
+      stops.push_back(total_length);
+    }
+    return std::make_shared<IrregularlyPartitionedArray>(partitions, stops);
+  }
+
   const ContentPtr
   PartitionedArray::getitem_at(int64_t at) const {
     int64_t regular_at = at;
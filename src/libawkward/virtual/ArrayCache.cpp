@@ -1,6 +1,11 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
 
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/virtual/ArrayCache.cpp", line)
+
 #include <atomic>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
 
 #include "awkward/virtual/ArrayCache.h"
 
@@ -14,7 +19,240 @@ namespace awkward {
     return out;
   }
 
+  void
+  ArrayCache::pin(const std::string& key) { }
+
+  void
+  ArrayCache::unpin(const std::string& key) { }
+
   // Note: if you're creating a pure C++ cache (and it's not ridiculously
   // large), define it in
   // include/awkward/virtual/ArrayCache.h and implement it in this file.
+
+  ////////// LRUArrayCache
+
+  LRUArrayCache::LRUArrayCache(int64_t max_bytes, int64_t num_stripes)
+      : max_bytes_(max_bytes)
+      , nbytes_(0)
+      , length_(0)
+      , hits_(0)
+      , misses_(0)
+      , evictions_(0)
+      , next_victim_(0) {
+    if (max_bytes < 0) {
+      throw std::invalid_argument(
+        std::string("LRUArrayCache max_bytes must be non-negative")
+        + FILENAME(__LINE__));
+    }
+    if (num_stripes < 1) {
+      throw std::invalid_argument(
+        std::string("LRUArrayCache num_stripes must be at least 1")
+        + FILENAME(__LINE__));
+    }
+    for (int64_t i = 0;  i < num_stripes;  i++) {
+      stripes_.push_back(std::unique_ptr<Stripe>(new Stripe));
+    }
+  }
+
+  LRUArrayCache::Stripe&
+  LRUArrayCache::stripe(const std::string& key) const {
+    size_t hash = std::hash<std::string>()(key);
+    return *stripes_[hash % stripes_.size()].get();
+  }
+
+  ContentPtr
+  LRUArrayCache::get(const std::string& key) const {
+    Stripe& part = stripe(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    auto found = part.lookup.find(key);
+    if (found == part.lookup.end()) {
+      misses_++;
+      return ContentPtr(nullptr);
+    }
+    hits_++;
+    part.entries.splice(part.entries.begin(), part.entries, found->second);
+    return found->second->value;
+  }
+
+  void
+  LRUArrayCache::set(const std::string& key, const ContentPtr& value) {
+    int64_t size = value.get()->nbytes();
+    // Arrays are released only after their stripe is unlocked, since that
+    // may call back into Python, which may be waiting for this stripe.
+    ContentPtr replaced(nullptr);
+    {
+      Stripe& part = stripe(key);
+      std::lock_guard<std::mutex> lock(part.mutex);
+      auto found = part.lookup.find(key);
+      if (found != part.lookup.end()) {
+        replaced = found->second->value;
+        nbytes_ -= found->second->nbytes;
+        length_--;
+        part.entries.erase(found->second);
+        part.lookup.erase(found);
+      }
+      if (size > max_bytes_) {
+        return;
+      }
+      part.entries.push_front({ key, value, size });
+      part.lookup[key] = part.entries.begin();
+      nbytes_ += size;
+      length_++;
+    }
+    // No stripe is locked here, so evict can lock each in turn.
+    evict();
+  }
+
+  bool
+  LRUArrayCache::is_broken() const {
+    return false;
+  }
+
+  const std::string
+  LRUArrayCache::tostring_part(const std::string& indent,
+                               const std::string& pre,
+                               const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<LRUArrayCache length=\"" << length()
+        << "\" nbytes=\"" << nbytes() << "\" max_bytes=\"" << max_bytes_
+        << "\" hits=\"" << hits() << "\" misses=\"" << misses()
+        << "\" evictions=\"" << evictions() << "\"/>" << post;
+    return out.str();
+  }
+
+  bool
+  LRUArrayCache::erase(const std::string& key) {
+    ContentPtr erased(nullptr);
+    Stripe& part = stripe(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    auto found = part.lookup.find(key);
+    if (found == part.lookup.end()) {
+      return false;
+    }
+    erased = found->second->value;
+    nbytes_ -= found->second->nbytes;
+    length_--;
+    part.entries.erase(found->second);
+    part.lookup.erase(found);
+    return true;
+  }
+
+  void
+  LRUArrayCache::clear() {
+    for (auto& part : stripes_) {
+      std::list<Entry> erased;
+      std::lock_guard<std::mutex> lock(part.get()->mutex);
+      for (auto& entry : part.get()->entries) {
+        nbytes_ -= entry.nbytes;
+        length_--;
+      }
+      erased.swap(part.get()->entries);
+      part.get()->lookup.clear();
+      part.get()->pins.clear();
+    }
+  }
+
+  void
+  LRUArrayCache::pin(const std::string& key) {
+    Stripe& part = stripe(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    part.pins[key]++;
+  }
+
+  void
+  LRUArrayCache::unpin(const std::string& key) {
+    {
+      Stripe& part = stripe(key);
+      std::lock_guard<std::mutex> lock(part.mutex);
+      auto found = part.pins.find(key);
+      if (found == part.pins.end()) {
+        throw std::invalid_argument(
+          std::string("LRUArrayCache key is not pinned: ") + key
+          + FILENAME(__LINE__));
+      }
+      if (--found->second != 0) {
+        return;
+      }
+      part.pins.erase(found);
+    }
+    evict();
+  }
+
+  bool
+  LRUArrayCache::contains(const std::string& key) const {
+    Stripe& part = stripe(key);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    return part.lookup.find(key) != part.lookup.end();
+  }
+
+  int64_t
+  LRUArrayCache::max_bytes() const {
+    return max_bytes_;
+  }
+
+  int64_t
+  LRUArrayCache::num_stripes() const {
+    return (int64_t)stripes_.size();
+  }
+
+  int64_t
+  LRUArrayCache::nbytes() const {
+    return nbytes_.load();
+  }
+
+  int64_t
+  LRUArrayCache::length() const {
+    return length_.load();
+  }
+
+  int64_t
+  LRUArrayCache::hits() const {
+    return hits_.load();
+  }
+
+  int64_t
+  LRUArrayCache::misses() const {
+    return misses_.load();
+  }
+
+  int64_t
+  LRUArrayCache::evictions() const {
+    return evictions_.load();
+  }
+
+  void
+  LRUArrayCache::evict() {
+    int64_t numstripes = (int64_t)stripes_.size();
+    // Stop after a full round of stripes with nothing to evict: whatever
+    // is left over the budget is pinned.
+    int64_t idle = 0;
+    for (int64_t i = next_victim_.fetch_add(1);
+         nbytes_.load() > max_bytes_  &&  idle < numstripes;
+         i++) {
+      ContentPtr evicted(nullptr);
+      if (evict_one(*stripes_[(size_t)(i % numstripes)].get(), evicted)) {
+        idle = 0;
+      }
+      else {
+        idle++;
+      }
+    }
+  }
+
+  bool
+  LRUArrayCache::evict_one(Stripe& part, ContentPtr& evicted) {
+    std::lock_guard<std::mutex> lock(part.mutex);
+    for (auto it = part.entries.rbegin();  it != part.entries.rend();  ++it) {
+      if (part.pins.find(it->key) == part.pins.end()) {
+        evicted = it->value;
+        nbytes_ -= it->nbytes;
+        length_--;
+        evictions_++;
+        part.lookup.erase(it->key);
+        part.entries.erase(std::next(it).base());
+        return true;
+      }
+    }
+    return false;
+  }
 }
@@ -2,6 +2,7 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/libawkward/virtual/ArrayGenerator.cpp", line)
 
+#include <memory>
 #include "sstream"
 
 #include "awkward/array/VirtualArray.h"
@@ -17,8 +18,12 @@ namespace awkward {
 
   const FormPtr
   ArrayGenerator::form() const {
-    if (form_.get() == nullptr  &&  inferred_form_.get() != nullptr) {
-      return inferred_form_;
+    if (form_.get() == nullptr) {
+      // May be set by another thread (see VirtualArray::prefetch).
+      FormPtr inferred = std::atomic_load(&inferred_form_);
+      if (inferred.get() != nullptr) {
+        return inferred;
+      }
     }
     return form_;
   }
@@ -46,11 +51,26 @@ namespace awkward {
           + out.get()->form(true).get()->tostring() + FILENAME(__LINE__));
     }
     if (form_.get() == nullptr) {
-      inferred_form_ = out.get()->form(true);
+      std::atomic_store(&inferred_form_, out.get()->form(true));
     }
     return out;
   }
 
+  const std::shared_ptr<ArrayGenerator>
+  ArrayGenerator::getitem_range(int64_t start, int64_t stop) const {
+    return ArrayGeneratorPtr(nullptr);
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  ArrayGenerator::getitem_field(const std::string& key) const {
+    return ArrayGeneratorPtr(nullptr);
+  }
+
+  const std::shared_ptr<ArrayGenerator>
+  ArrayGenerator::getitem_fields(const std::vector<std::string>& keys) const {
+    return ArrayGeneratorPtr(nullptr);
+  }
+
   SliceGenerator::SliceGenerator(const FormPtr& form,
                                  int64_t length,
                                  const ContentPtr& content,
@@ -71,25 +91,25 @@ namespace awkward {
 
   const ContentPtr
   SliceGenerator::generate() const {
+    // Generate only the requested rows or fields if the content hasn't been
+    // generated already and its generator can.
+    ArrayGeneratorPtr projection = projected();
+    if (projection.get() != nullptr) {
+      return projection.get()->generate_and_check();
+    }
+    ContentPtr content = content_;
+    if (VirtualArray* a = dynamic_cast<VirtualArray*>(content_.get())) {
+      content = a->array();
+    }
     if (slice_.length() == 1) {
       SliceItemPtr head = slice_.head();
       if (SliceRange* raw = dynamic_cast<SliceRange*>(head.get())) {
         if (raw->step() == 1) {
-          if (VirtualArray* a = dynamic_cast<VirtualArray*>(content_.get())) {
-            return a->array().get()->getitem_range(raw->start(), raw->stop());
-          }
-          else {
-            return content_.get()->getitem_range(raw->start(), raw->stop());
-          }
+          return content.get()->getitem_range(raw->start(), raw->stop());
         }
       }
     }
-    if (VirtualArray* a = dynamic_cast<VirtualArray*>(content_.get())) {
-      return a->array().get()->getitem(slice_);
-    }
-    else {
-      return content_.get()->getitem(slice_);
-    }
+    return content.get()->getitem(slice_);
   }
 
   void
@@ -183,4 +203,48 @@ namespace awkward {
       return false;
     }
   }
+
+  const std::shared_ptr<ArrayGenerator>
+  SliceGenerator::projected() const {
+    VirtualArray* a = dynamic_cast<VirtualArray*>(content_.get());
+    if (a == nullptr  ||  a->peek_array().get() != nullptr  ||
+        slice_.length() != 1) {
+      return ArrayGeneratorPtr(nullptr);
+    }
+    // A chain of slices is projected from the generator at its root, unless
+    // an array along the way has already been generated.
+    ArrayGeneratorPtr source = a->generator();
+    if (SliceGenerator* raw = dynamic_cast<SliceGenerator*>(source.get())) {
+      source = raw->projected();
+      if (source.get() == nullptr) {
+        return ArrayGeneratorPtr(nullptr);
+      }
+    }
+    SliceItemPtr head = slice_.head();
+    if (const SliceRange* range = simple_range()) {
+      if (source.get()->length() >= range->stop()) {
+        return source.get()->getitem_range(range->start(), range->stop());
+      }
+    }
+    else if (SliceField* field = dynamic_cast<SliceField*>(head.get())) {
+      return source.get()->getitem_field(field->key());
+    }
+    else if (SliceFields* fields = dynamic_cast<SliceFields*>(head.get())) {
+      return source.get()->getitem_fields(fields->keys());
+    }
+    return ArrayGeneratorPtr(nullptr);
+  }
+
+  const SliceRange*
+  SliceGenerator::simple_range() const {
+    if (slice_.length() == 1) {
+      if (SliceRange* raw = dynamic_cast<SliceRange*>(slice_.head().get())) {
+        if (raw->step() == 1  &&  raw->hasstart()  &&  raw->hasstop()  &&
+            0 <= raw->start()  &&  raw->start() <= raw->stop()) {
+          return raw;
+        }
+      }
+    }
+    return nullptr;
+  }
 }
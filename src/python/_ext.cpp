@@ -9,6 +9,7 @@
 #include "awkward/python/index.h"
 #include "awkward/python/identities.h"
 #include "awkward/python/content.h"
+#include "awkward/python/broadcasting.h"
 #include "awkward/python/types.h"
 #include "awkward/python/forms.h"
 #include "awkward/python/virtual.h"
@@ -31,6 +32,10 @@ PYBIND11_MODULE(_ext, m) {
   ////////// kernel_utils.h
 
   make_lib_enum(m, "kernel_lib");
+  make_num_threads(m, "kernel_num_threads");
+  make_num_background_threads(m, "kernel_num_background_threads");
+  make_allocator(m, "kernel_allocator");
+  install_background_wait();
 
   ////////// index.h
 
@@ -48,7 +53,9 @@ PYBIND11_MODULE(_ext, m) {
   ////////// content.h
 
   make_Iterator(m, "Iterator");
+  make_CombinationsIterator(m, "CombinationsIterator");
   make_ArrayBuilder(m, "ArrayBuilder");
+  make_TypedArrayBuilder(m, "TypedArrayBuilder");
   make_PersistentSharedPtr(m, "_PersistentSharedPtr");
   make_Content(m, "Content");
 
@@ -89,6 +96,12 @@ PYBIND11_MODULE(_ext, m) {
     return toslice(obj).tostring();
   });
 
+  ////////// broadcasting.h
+
+  make_broadcast_and_apply(m, "broadcast_and_apply");
+  make_fused_elementwise(m, "fused_elementwise");
+  make_fused_operations(m, "fused_operations");
+
   ////////// types.h
 
   make_Type(m, "Type");
@@ -123,6 +136,7 @@ PYBIND11_MODULE(_ext, m) {
   make_PyArrayGenerator(m, "ArrayGenerator");
   make_SliceGenerator(m, "SliceGenerator");
   make_PyArrayCache(m, "ArrayCache");
+  make_LRUArrayCache(m, "LRUArrayCache");
 
   ////////// partition.h
 
@@ -133,10 +147,13 @@ PYBIND11_MODULE(_ext, m) {
 
   make_fromjson(m, "fromjson");
   make_fromjsonfile(m, "fromjsonfile");
+  make_fromjsonlines(m, "fromjsonlines");
+  make_fromjsonlinesfile(m, "fromjsonlinesfile");
   make_uproot_issue_90(m);
 
   ////////// forth.h
 
+  make_ForthInputBuffer(m, "ForthInputBuffer");
   make_ForthMachineOf<int32_t, int32_t>(m, "ForthMachine32");
   make_ForthMachineOf<int64_t, int32_t>(m, "ForthMachine64");
 
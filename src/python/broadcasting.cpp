@@ -0,0 +1,149 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+#define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/python/broadcasting.cpp", line)
+
+#include "awkward/python/content.h"
+
+#include "awkward/python/broadcasting.h"
+
+////////// PyBroadcastFunction
+
+PyBroadcastFunction::PyBroadcastFunction(const py::object& callable,
+                                         const py::object& custom,
+                                         const py::list& inputs)
+    : callable_(callable)
+    , custom_(custom)
+    , inputs_(inputs) { }
+
+bool
+PyBroadcastFunction::apply(const ak::ContentPtrVec& inputs,
+                           int64_t depth,
+                           ak::ContentPtrVec& outputs) {
+  py::list args;
+  for (size_t i = 0;  i < inputs.size();  i++) {
+    if (inputs[i].get() == nullptr) {
+      args.append(inputs_[i]);
+    }
+    else {
+      args.append(box(inputs[i]));
+    }
+  }
+  py::object out = callable_(args, depth);
+  if (out.is(py::none())) {
+    return false;
+  }
+  for (auto x : out.cast<py::tuple>()) {
+    outputs.push_back(unbox_content(x));
+  }
+  return true;
+}
+
+bool
+PyBroadcastFunction::has_custom_broadcast(const ak::ContentPtr& input) {
+  if (custom_.is_none()) {
+    return false;
+  }
+  return !custom_(box(input)).is_none();
+}
+
+const ak::ContentPtr
+PyBroadcastFunction::custom_broadcast(const ak::ContentPtr& input,
+                                      const ak::Index64& offsets) {
+  py::object boxed = box(input);
+  py::object fcn = custom_(boxed);
+  return unbox_content(fcn(boxed, py::cast(offsets)));
+}
+
+////////// broadcast_and_apply
+
+void
+make_broadcast_and_apply(py::module& m, const std::string& name) {
+  m.def(name.c_str(), [](const py::list& inputs,
+                         const py::object& function,
+                         int64_t depth,
+                         bool allow_records,
+                         bool left_broadcast,
+                         bool right_broadcast,
+                         bool numpy_to_regular,
+                         bool regular_to_jagged,
+                         bool leaves_only,
+                         const py::object& custom_broadcast) -> py::tuple {
+    ak::ContentPtrVec contents;
+    for (auto x : inputs) {
+      if (py::isinstance<ak::Content>(x)) {
+        contents.push_back(unbox_content(x));
+      }
+      else {
+        contents.push_back(ak::ContentPtr(nullptr));
+      }
+    }
+    ak::BroadcastOptions options;
+    options.allow_records = allow_records;
+    options.left_broadcast = left_broadcast;
+    options.right_broadcast = right_broadcast;
+    options.numpy_to_regular = numpy_to_regular;
+    options.regular_to_jagged = regular_to_jagged;
+    options.leaves_only = leaves_only;
+    PyBroadcastFunction pyfunction(function, custom_broadcast, inputs);
+    ak::ContentPtrVec outputs = ak::broadcast_and_apply(contents,
+                                                        pyfunction,
+                                                        options,
+                                                        depth);
+    py::tuple out(outputs.size());
+    for (size_t i = 0;  i < outputs.size();  i++) {
+      out[i] = box(outputs[i]);
+    }
+    return out;
+  }, py::arg("inputs"),
+     py::arg("function"),
+     py::arg("depth") = 0,
+     py::arg("allow_records") = true,
+     py::arg("left_broadcast") = true,
+     py::arg("right_broadcast") = true,
+     py::arg("numpy_to_regular") = false,
+     py::arg("regular_to_jagged") = false,
+     py::arg("leaves_only") = false,
+     py::arg("custom_broadcast") = py::none());
+}
+
+////////// fused_elementwise
+
+void
+make_fused_elementwise(py::module& m, const std::string& name) {
+  m.def(name.c_str(), [](const py::list& inputs,
+                         const py::list& program,
+                         const std::vector<double>& constants) -> py::object {
+    ak::ContentPtrVec contents;
+    for (auto x : inputs) {
+      contents.push_back(unbox_content(x));
+    }
+    std::vector<int64_t> flatprogram;
+    for (auto instruction : program) {
+      py::tuple pair = instruction.cast<py::tuple>();
+      std::string opname = pair[0].cast<std::string>();
+      int64_t opcode = ak::fused_opcode(opname);
+      if (opcode < 0) {
+        throw std::invalid_argument(
+          std::string("cannot fuse operation ") + opname + FILENAME(__LINE__));
+      }
+      flatprogram.push_back(opcode);
+      flatprogram.push_back(pair[1].cast<int64_t>());
+    }
+    ak::ContentPtr out = ak::fused_elementwise(contents,
+                                               flatprogram,
+                                               constants);
+    if (out.get() == nullptr) {
+      return py::none();
+    }
+    return box(out);
+  }, py::arg("inputs"),
+     py::arg("program"),
+     py::arg("constants"));
+}
+
+void
+make_fused_operations(py::module& m, const std::string& name) {
+  m.def(name.c_str(), []() -> std::vector<std::string> {
+    return ak::fused_operations();
+  });
+}
@@ -962,6 +962,59 @@ make_ArrayBuilder(const py::handle& m, const std::string& name) {
   );
 }
 
+////////// TypedArrayBuilder
+
+py::class_<ak::TypedArrayBuilder>
+make_TypedArrayBuilder(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::TypedArrayBuilder>(m, name.c_str())
+      .def(py::init([](const std::shared_ptr<ak::Form>& form,
+                       int64_t initial,
+                       double resize) -> ak::TypedArrayBuilder {
+        return ak::TypedArrayBuilder(form,
+                                     ak::ArrayBuilderOptions(initial, resize));
+      }), py::arg("form"), py::arg("initial") = 1024, py::arg("resize") = 1.5)
+      .def_property_readonly("_ptr",
+                             [](const ak::TypedArrayBuilder* self) -> size_t {
+        return reinterpret_cast<size_t>(self);
+      })
+      .def_property_readonly("form", &ak::TypedArrayBuilder::form)
+      .def("__repr__", &ak::TypedArrayBuilder::tostring)
+      .def("__len__", &ak::TypedArrayBuilder::length)
+      .def("clear", &ak::TypedArrayBuilder::clear)
+      .def("snapshot", [](const ak::TypedArrayBuilder& self) -> py::object {
+        return box(self.snapshot());
+      })
+      .def("null", &ak::TypedArrayBuilder::null)
+      .def("boolean", &ak::TypedArrayBuilder::boolean)
+      .def("integer", &ak::TypedArrayBuilder::integer)
+      .def("real", &ak::TypedArrayBuilder::real)
+      .def("bytestring",
+           [](ak::TypedArrayBuilder& self, const py::bytes& x) -> void {
+        self.string(x.cast<std::string>());
+      })
+      .def("string",
+           [](ak::TypedArrayBuilder& self, const py::str& x) -> void {
+        self.string(x.cast<std::string>());
+      })
+      .def("beginlist", &ak::TypedArrayBuilder::beginlist)
+      .def("endlist", &ak::TypedArrayBuilder::endlist)
+      .def("begintuple", &ak::TypedArrayBuilder::begintuple)
+      .def("index", &ak::TypedArrayBuilder::index)
+      .def("endtuple", &ak::TypedArrayBuilder::endtuple)
+      .def("beginrecord", &ak::TypedArrayBuilder::beginrecord)
+      .def("field",
+           [](ak::TypedArrayBuilder& self, const py::object& key) -> void {
+        if (py::isinstance<py::int_>(key)) {
+          self.field(key.cast<int64_t>());
+        }
+        else {
+          self.field(key.cast<std::string>());
+        }
+      })
+      .def("endrecord", &ak::TypedArrayBuilder::endrecord)
+  );
+}
+
 ////////// Iterator
 
 py::class_<ak::Iterator, std::shared_ptr<ak::Iterator>>
@@ -986,6 +1039,67 @@ make_Iterator(const py::handle& m, const std::string& name) {
   );
 }
 
+////////// CombinationsIterator
+
+py::class_<ak::CombinationsIterator, std::shared_ptr<ak::CombinationsIterator>>
+make_CombinationsIterator(const py::handle& m, const std::string& name) {
+  auto next = [](ak::CombinationsIterator& iterator) -> py::object {
+    if (iterator.isdone()) {
+      throw py::stop_iteration();
+    }
+    std::pair<ak::Index64, std::shared_ptr<ak::Content>> out =
+      iterator.next();
+    return py::make_tuple(py::cast(out.first), box(out.second));
+  };
+
+  return (py::class_<ak::CombinationsIterator,
+                     std::shared_ptr<ak::CombinationsIterator>>(m,
+                                                                name.c_str())
+      .def(py::init([](const py::object& content,
+                       int64_t n,
+                       bool replacement,
+                       const py::object& keys,
+                       const py::object& parameters,
+                       int64_t chunksize) -> ak::CombinationsIterator {
+        std::shared_ptr<ak::util::RecordLookup> recordlookup(nullptr);
+        if (!keys.is(py::none())) {
+          recordlookup = std::make_shared<ak::util::RecordLookup>();
+          for (auto x : keys.cast<py::iterable>()) {
+            recordlookup.get()->push_back(x.cast<std::string>());
+          }
+        }
+        return ak::CombinationsIterator(unbox_content(content),
+                                        n,
+                                        replacement,
+                                        recordlookup,
+                                        dict2parameters(parameters),
+                                        chunksize);
+      }), py::arg("content"),
+          py::arg("n"),
+          py::arg("replacement") = false,
+          py::arg("keys") = py::none(),
+          py::arg("parameters") = py::none(),
+          py::arg("chunksize") = 65536)
+      .def("__repr__", &ak::CombinationsIterator::tostring)
+      .def("__len__", &ak::CombinationsIterator::length)
+      .def_property_readonly("n", &ak::CombinationsIterator::n)
+      .def_property_readonly("replacement",
+                             &ak::CombinationsIterator::replacement)
+      .def_property_readonly("chunksize",
+                             &ak::CombinationsIterator::chunksize)
+      .def_property_readonly("offsets", &ak::CombinationsIterator::offsets)
+      .def_property_readonly("at", &ak::CombinationsIterator::at)
+      .def_property_readonly("array", [](const ak::CombinationsIterator& self)
+                                      -> py::object {
+        return box(self.array());
+      })
+      .def("__next__", next)
+      .def("next", next)
+      .def("__iter__",
+           [](const py::object& self) -> py::object { return self; })
+  );
+}
+
 ////////// Content
 
 PersistentSharedPtr::PersistentSharedPtr(
@@ -1209,15 +1323,7 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
             self.caches(out1);
             py::list out2(out1.size());
             for (size_t i = 0;  i < out1.size();  i++) {
-              if (std::shared_ptr<PyArrayCache> ptr =
-                  std::dynamic_pointer_cast<PyArrayCache>(out1[i])) {
-                out2[i] = py::cast(ptr);
-              }
-              else {
-                throw std::runtime_error(
-                  std::string("VirtualArray's cache is not a PyArrayCache")
-                  + FILENAME(__LINE__));
-              }
+              out2[i] = box_cache(out1[i]);
             }
             return out2;
           })
@@ -2308,15 +2414,7 @@ make_Record(const py::handle& m, const std::string& name) {
         self.caches(out1);
         py::list out2(out1.size());
         for (size_t i = 0;  i < out1.size();  i++) {
-          if (std::shared_ptr<PyArrayCache> ptr =
-              std::dynamic_pointer_cast<PyArrayCache>(out1[i])) {
-            out2[i] = py::cast(ptr);
-          }
-          else {
-            throw std::runtime_error(
-              std::string("VirtualArray's cache is not a PyArrayCache")
-              + FILENAME(__LINE__));
-          }
+          out2[i] = box_cache(out1[i]);
         }
         return out2;
       })
@@ -2706,17 +2804,7 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
                           "SliceGenerator") + FILENAME(__LINE__));
           }
         }
-        std::shared_ptr<PyArrayCache> cppcache(nullptr);
-        if (!cache.is(py::none())) {
-          try {
-            cppcache = cache.cast<std::shared_ptr<PyArrayCache>>();
-          }
-          catch (py::cast_error err) {
-            throw std::invalid_argument(
-              std::string("VirtualArray 'cache' must be an ArrayCache or None")
-              + FILENAME(__LINE__));
-          }
-        }
+        ak::ArrayCachePtr cppcache = unbox_cache(cache);
         if (!cache_key.is(py::none())) {
           std::string cppcache_key;
           try {
@@ -2765,20 +2853,9 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
       })
       .def_property_readonly("cache", [](const ak::VirtualArray& self)
                                       -> py::object {
-        std::shared_ptr<ak::ArrayCache> cache = self.cache();
-        if (cache.get() == nullptr) {
-          return py::none();
-        }
-        if (std::shared_ptr<PyArrayCache> ptr =
-               std::dynamic_pointer_cast<PyArrayCache>(cache)) {
-          return py::cast(ptr);
-        }
-        else {
-          throw std::runtime_error(
-            std::string("VirtualArray's cache is not a PyArrayCache")
-            + FILENAME(__LINE__));
-        }
+        return box_cache(self.cache());
       })
+      .def("prefetch", &ak::VirtualArray::prefetch)
       .def_property_readonly("peek_array", [](const ak::VirtualArray& self)
                                            -> py::object {
         std::shared_ptr<ak::Content> out = self.peek_array();
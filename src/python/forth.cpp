@@ -2,10 +2,14 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/python/forth.cpp", line)
 
+#include <cstring>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include "awkward/kernel-parallel.h"
+
 #include "awkward/python/util.h"
 #include "awkward/python/content.h"
 #include "awkward/python/forth.h"
@@ -22,7 +26,8 @@ py::object maybe_throw(const ak::ForthMachineOf<T, I>& self,
                        bool raise_skip_beyond,
                        bool raise_rewind_beyond,
                        bool raise_division_by_zero,
-                       bool raise_varint_too_big) {
+                       bool raise_varint_too_big,
+                       bool raise_lookup_beyond) {
   std::set<ak::util::ForthError> ignore;
   if (!raise_user_halt) {
     ignore.insert(ak::util::ForthError::user_halt);
@@ -54,6 +59,9 @@ py::object maybe_throw(const ak::ForthMachineOf<T, I>& self,
   if (!raise_varint_too_big) {
     ignore.insert(ak::util::ForthError::varint_too_big);
   }
+  if (!raise_lookup_beyond) {
+    ignore.insert(ak::util::ForthError::lookup_beyond);
+  }
   self.maybe_throw(err, ignore);
 
   switch (err) {
@@ -83,6 +91,8 @@ py::object maybe_throw(const ak::ForthMachineOf<T, I>& self,
       return py::str("division by zero");
     case ak::util::ForthError::varint_too_big:
       return py::str("varint too big");
+    case ak::util::ForthError::lookup_beyond:
+      return py::str("lookup beyond");
     default:
       throw std::invalid_argument(
           std::string("unrecognized ForthError: ")
@@ -90,6 +100,100 @@ py::object maybe_throw(const ak::ForthMachineOf<T, I>& self,
   }
 }
 
+/// @brief Converts a dict of Python buffers or ForthInputBuffers (such as
+/// memory-mapped files) into named inputs; each ForthInputBuffer is read from
+/// its beginning without copying its data, except for streaming ones, which
+/// continue from where they are.
+template <typename T, typename I>
+std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>>
+inputs_from_dict(const ak::ForthMachineOf<T, I>& self, const py::dict& inputs) {
+  std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>> ins;
+  for (auto pair : inputs) {
+    std::string name = pair.first.cast<std::string>();
+    if (py::isinstance<ak::ForthInputBuffer>(pair.second)) {
+      std::shared_ptr<ak::ForthInputBuffer> input =
+          pair.second.cast<std::shared_ptr<ak::ForthInputBuffer>>();
+      if (!input.get()->is_streaming()) {
+        input = std::make_shared<ak::ForthInputBuffer>(*input.get());
+        ak::util::ForthError err = ak::util::ForthError::none;
+        input.get()->seek(0, err);
+      }
+      ins[name] = input;
+    }
+    else {
+      py::buffer obj = pair.second.cast<py::buffer>();
+      py::buffer_info info = obj.request(self.input_must_be_writable(name));
+      int64_t length = info.itemsize;
+      for (auto x : info.shape) {
+        length *= x;
+      }
+      std::shared_ptr<void> ptr = std::shared_ptr<uint8_t>(
+          reinterpret_cast<uint8_t*>(info.ptr), pyobject_deleter<uint8_t>(obj.ptr()));
+      ins[name] = std::make_shared<ak::ForthInputBuffer>(ptr, 0, length);
+    }
+  }
+  return ins;
+}
+
+py::class_<ak::ForthInputBuffer, std::shared_ptr<ak::ForthInputBuffer>>
+make_ForthInputBuffer(const py::handle& m, const std::string& name) {
+  return py::class_<ak::ForthInputBuffer,
+                    std::shared_ptr<ak::ForthInputBuffer>>(m, name.c_str())
+      .def(py::init([](const std::string& filename,
+                       int64_t offset,
+                       const py::object& length) -> ak::ForthInputBuffer {
+        int64_t intlength = -1;
+        if (!length.is(py::none())) {
+          intlength = length.cast<int64_t>();
+        }
+        return ak::ForthInputBuffer(filename, offset, intlength);
+      }), py::arg("filename"), py::arg("offset") = 0, py::arg("length") = py::none())
+      .def(py::init([](const py::object& source,
+                       int64_t chunk_size) -> ak::ForthInputBuffer {
+        // Either a file-like object or a function like its 'read' method.
+        py::object read = py::hasattr(source, "read") ? source.attr("read")
+                                                      : source;
+        std::shared_ptr<PyObject> reader(read.ptr(),
+                                         pyobject_deleter<PyObject>(read.ptr()));
+        return ak::ForthInputBuffer(
+          [reader](void* buffer, int64_t num_bytes) -> int64_t {
+            py::gil_scoped_acquire acquire;
+            py::object data =
+                py::reinterpret_borrow<py::object>(reader.get())(num_bytes);
+            if (data.is(py::none())) {
+              return 0;
+            }
+            py::buffer_info info = data.cast<py::buffer>().request();
+            int64_t length = info.itemsize;
+            for (auto x : info.shape) {
+              length *= x;
+            }
+            if (length > num_bytes) {
+              throw std::invalid_argument(
+                std::string("ForthInputBuffer source returned ")
+                + std::to_string(length) + std::string(" bytes when asked for ")
+                + std::to_string(num_bytes) + FILENAME(__LINE__));
+            }
+            std::memcpy(buffer, info.ptr, (size_t)length);
+            return length;
+          }, chunk_size);
+      }), py::arg("source"), py::arg("chunk_size") = 1048576)
+      .def("__len__", [](const ak::ForthInputBuffer& self) -> int64_t {
+        int64_t out = self.len();
+        if (out < 0) {
+          throw std::invalid_argument(
+            std::string("the length of a streaming ForthInputBuffer is not "
+                        "known until its source is exhausted")
+            + FILENAME(__LINE__));
+        }
+        return out;
+      })
+      .def_property_readonly("pos", &ak::ForthInputBuffer::pos)
+      .def_property_readonly("end", &ak::ForthInputBuffer::end)
+      .def_property_readonly("is_streaming", &ak::ForthInputBuffer::is_streaming)
+  ;
+}
+
 template <typename T, typename I>
 py::class_<ak::ForthMachineOf<T, I>, std::shared_ptr<ak::ForthMachineOf<T, I>>>
 make_ForthMachineOf(const py::handle& m, const std::string& name) {
@@ -99,19 +203,22 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                            int64_t stack_size,
                            int64_t recursion_depth,
                            int64_t output_initial_size,
-                           double output_resize_factor)
+                           double output_resize_factor,
+                           bool threaded)
                         -> std::shared_ptr<ak::ForthMachineOf<T, I>> {
             return std::make_shared<ak::ForthMachineOf<T, I>>(source,
                                                               stack_size,
                                                               recursion_depth,
                                                               output_initial_size,
-                                                              output_resize_factor);
+                                                              output_resize_factor,
+                                                              threaded);
           }),
                py::arg("source"),
                py::arg("stack_size") = 1024,
                py::arg("recursion_depth") = 1024,
                py::arg("output_initial_size") = 1024,
-               py::arg("output_resize_factor") = 1.5)
+               py::arg("output_resize_factor") = 1.5,
+               py::arg("threaded") = false)
           .def("__getitem__", [](const std::shared_ptr<ak::ForthMachineOf<T, I>>& self,
                                  const std::string& key)
                                  -> py::object {
@@ -155,6 +262,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
               &ak::ForthMachineOf<T, I>::output_initial_size)
           .def_property_readonly("output_resize_factor",
               &ak::ForthMachineOf<T, I>::output_resize_factor)
+          .def_property_readonly("threaded",
+              &ak::ForthMachineOf<T, I>::threaded)
           .def_property_readonly("stack",
               &ak::ForthMachineOf<T, I>::stack)
           .def("stack_push", [](ak::ForthMachineOf<T, I>& self, T value) -> void {
@@ -223,19 +332,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
           .def("reset", &ak::ForthMachineOf<T, I>::reset)
           .def("begin", [](ak::ForthMachineOf<T, I>& self,
                            const py::dict& inputs) -> void {
-              std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>> ins;
-              for (auto pair : inputs) {
-                std::string name = pair.first.cast<std::string>();
-                py::buffer obj = pair.second.cast<py::buffer>();
-                py::buffer_info info = obj.request(self.input_must_be_writable(name));
-                int64_t length = info.itemsize;
-                for (auto x : info.shape) {
-                  length *= x;
-                }
-                std::shared_ptr<void> ptr = std::shared_ptr<uint8_t>(
-                    reinterpret_cast<uint8_t*>(info.ptr), pyobject_deleter<uint8_t>(obj.ptr()));
-                ins[name] = std::make_shared<ak::ForthInputBuffer>(ptr, 0, length);
-              }
+              std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>> ins =
+                  inputs_from_dict(self, inputs);
               self.begin(ins);
           }, py::arg("inputs") = py::dict())
           .def("step", [](ak::ForthMachineOf<T, I>& self,
@@ -248,7 +346,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                           bool raise_skip_beyond,
                           bool raise_rewind_beyond,
                           bool raise_division_by_zero,
-                          bool raise_varint_too_big) -> py::object {
+                          bool raise_varint_too_big,
+                          bool raise_lookup_beyond) -> py::object {
               ak::util::ForthError err = self.step();
               return maybe_throw<T, I>(self,
                                        err,
@@ -261,7 +360,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                                        raise_skip_beyond,
                                        raise_rewind_beyond,
                                        raise_division_by_zero,
-                                       raise_varint_too_big);
+                                       raise_varint_too_big,
+                                       raise_lookup_beyond);
           }, py::arg("raise_user_halt") = true
            , py::arg("raise_recursion_depth_exceeded") = true
            , py::arg("raise_stack_underflow") = true
@@ -271,7 +371,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
            , py::arg("raise_skip_beyond") = true
            , py::arg("raise_rewind_beyond") = true
            , py::arg("raise_division_by_zero") = true
-           , py::arg("raise_varint_too_big") = true)
+           , py::arg("raise_varint_too_big") = true
+           , py::arg("raise_lookup_beyond") = true)
           .def("run", [](ak::ForthMachineOf<T, I>& self,
                          const py::dict& inputs,
                          bool raise_user_halt,
@@ -283,20 +384,10 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                          bool raise_skip_beyond,
                          bool raise_rewind_beyond,
                          bool raise_division_by_zero,
-                         bool raise_varint_too_big) -> py::object {
-              std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>> ins;
-              for (auto pair : inputs) {
-                std::string name = pair.first.cast<std::string>();
-                py::buffer obj = pair.second.cast<py::buffer>();
-                py::buffer_info info = obj.request(self.input_must_be_writable(name));
-                int64_t length = info.itemsize;
-                for (auto x : info.shape) {
-                  length *= x;
-                }
-                std::shared_ptr<void> ptr = std::shared_ptr<uint8_t>(
-                    reinterpret_cast<uint8_t*>(info.ptr), pyobject_deleter<uint8_t>(obj.ptr()));
-                ins[name] = std::make_shared<ak::ForthInputBuffer>(ptr, 0, length);
-              }
+                         bool raise_varint_too_big,
+                         bool raise_lookup_beyond) -> py::object {
+              std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>> ins =
+                  inputs_from_dict(self, inputs);
               self.begin(ins);
               py::gil_scoped_release release;
               ak::util::ForthError err = self.resume();
@@ -312,7 +403,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                                        raise_skip_beyond,
                                        raise_rewind_beyond,
                                        raise_division_by_zero,
-                                       raise_varint_too_big);
+                                       raise_varint_too_big,
+                                       raise_lookup_beyond);
           }, py::arg("inputs") = py::dict()
            , py::arg("raise_user_halt") = true
            , py::arg("raise_recursion_depth_exceeded") = true
@@ -323,7 +415,67 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
            , py::arg("raise_skip_beyond") = true
            , py::arg("raise_rewind_beyond") = true
            , py::arg("raise_division_by_zero") = true
-           , py::arg("raise_varint_too_big") = true)
+           , py::arg("raise_varint_too_big") = true
+           , py::arg("raise_lookup_beyond") = true)
+          .def("run_many", [](const ak::ForthMachineOf<T, I>& self,
+                              const py::list& inputs,
+                              const py::object& nthreads,
+                              bool raise_user_halt,
+                              bool raise_recursion_depth_exceeded,
+                              bool raise_stack_underflow,
+                              bool raise_stack_overflow,
+                              bool raise_read_beyond,
+                              bool raise_seek_beyond,
+                              bool raise_skip_beyond,
+                              bool raise_rewind_beyond,
+                              bool raise_division_by_zero,
+                              bool raise_varint_too_big,
+                              bool raise_lookup_beyond) -> py::list {
+              std::vector<std::map<std::string, std::shared_ptr<ak::ForthInputBuffer>>> ins;
+              for (auto x : inputs) {
+                ins.push_back(inputs_from_dict(self, x.cast<py::dict>()));
+              }
+              int64_t num_threads = ak::kernel::num_threads();
+              if (!nthreads.is(py::none())) {
+                num_threads = nthreads.cast<int64_t>();
+              }
+              std::vector<std::shared_ptr<ak::ForthMachineOf<T, I>>> machines;
+              {
+                py::gil_scoped_release release;
+                machines = self.run_many(ins, num_threads);
+              }
+              py::list out;
+              for (auto machine : machines) {
+                maybe_throw<T, I>(*machine.get(),
+                                  ak::util::ForthError::none,
+                                  raise_user_halt,
+                                  raise_recursion_depth_exceeded,
+                                  raise_stack_underflow,
+                                  raise_stack_overflow,
+                                  raise_read_beyond,
+                                  raise_seek_beyond,
+                                  raise_skip_beyond,
+                                  raise_rewind_beyond,
+                                  raise_division_by_zero,
+                                  raise_varint_too_big,
+                                  raise_lookup_beyond);
+                out.append(py::cast(machine));
+              }
+              return out;
+          }, py::arg("inputs")
+           , py::arg("nthreads") = py::none()
+           , py::arg("raise_user_halt") = true
+           , py::arg("raise_recursion_depth_exceeded") = true
+           , py::arg("raise_stack_underflow") = true
+           , py::arg("raise_stack_overflow") = true
+           , py::arg("raise_read_beyond") = true
+           , py::arg("raise_seek_beyond") = true
+           , py::arg("raise_skip_beyond") = true
+           , py::arg("raise_rewind_beyond") = true
+           , py::arg("raise_division_by_zero") = true
+           , py::arg("raise_varint_too_big") = true
+           , py::arg("raise_lookup_beyond") = true)
+          .def("copy_program", &ak::ForthMachineOf<T, I>::copy_program)
           .def("resume", [](ak::ForthMachineOf<T, I>& self,
                           bool raise_user_halt,
                           bool raise_recursion_depth_exceeded,
@@ -334,7 +486,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                           bool raise_skip_beyond,
                           bool raise_rewind_beyond,
                           bool raise_division_by_zero,
-                          bool raise_varint_too_big) -> py::object {
+                          bool raise_varint_too_big,
+                          bool raise_lookup_beyond) -> py::object {
               py::gil_scoped_release release;
               ak::util::ForthError err = self.resume();
               py::gil_scoped_acquire acquire;
@@ -349,7 +502,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                                        raise_skip_beyond,
                                        raise_rewind_beyond,
                                        raise_division_by_zero,
-                                       raise_varint_too_big);
+                                       raise_varint_too_big,
+                                       raise_lookup_beyond);
           }, py::arg("raise_user_halt") = true
            , py::arg("raise_recursion_depth_exceeded") = true
            , py::arg("raise_stack_underflow") = true
@@ -359,7 +513,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
            , py::arg("raise_skip_beyond") = true
            , py::arg("raise_rewind_beyond") = true
            , py::arg("raise_division_by_zero") = true
-           , py::arg("raise_varint_too_big") = true)
+           , py::arg("raise_varint_too_big") = true
+           , py::arg("raise_lookup_beyond") = true)
           .def("call", [](ak::ForthMachineOf<T, I>& self,
                           const std::string& name,
                           bool raise_user_halt,
@@ -371,7 +526,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                           bool raise_skip_beyond,
                           bool raise_rewind_beyond,
                           bool raise_division_by_zero,
-                          bool raise_varint_too_big) -> py::object {
+                          bool raise_varint_too_big,
+                          bool raise_lookup_beyond) -> py::object {
               py::gil_scoped_release release;
               ak::util::ForthError err = self.call(name);
               py::gil_scoped_acquire acquire;
@@ -386,7 +542,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
                                        raise_skip_beyond,
                                        raise_rewind_beyond,
                                        raise_division_by_zero,
-                                       raise_varint_too_big);
+                                       raise_varint_too_big,
+                                       raise_lookup_beyond);
           }, py::arg("name")
            , py::arg("raise_user_halt") = true
            , py::arg("raise_recursion_depth_exceeded") = true
@@ -397,7 +554,8 @@ make_ForthMachineOf(const py::handle& m, const std::string& name) {
            , py::arg("raise_skip_beyond") = true
            , py::arg("raise_rewind_beyond") = true
            , py::arg("raise_division_by_zero") = true
-           , py::arg("raise_varint_too_big") = true)
+           , py::arg("raise_varint_too_big") = true
+           , py::arg("raise_lookup_beyond") = true)
           .def_property_readonly("current_bytecode_position",
               &ak::ForthMachineOf<T, I>::current_bytecode_position)
           .def_property_readonly("current_recursion_depth",
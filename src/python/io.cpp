@@ -10,6 +10,8 @@
 #include "awkward/builder/ArrayBuilderOptions.h"
 #include "awkward/io/json.h"
 #include "awkward/io/uproot.h"
+#include "awkward/kernel-parallel.h"
+#include "awkward/partition/PartitionedArray.h"
 #include "awkward/python/content.h"
 
 #include "awkward/python/io.h"
@@ -27,12 +29,16 @@ make_fromjson(py::module& m, const std::string& name) {
            const char* minus_infinity_string,
            int64_t initial,
            double resize,
-           int64_t buffersize) -> py::object {
+           int64_t buffersize,
+           bool lines,
+           const std::shared_ptr<ak::Form>& form) -> py::object {
     ak::ContentPtr out = ak::FromJsonString(source.c_str(),
                                             ak::ArrayBuilderOptions(initial, resize),
                                             nan_string,
                                             infinity_string,
-                                            minus_infinity_string);
+                                            minus_infinity_string,
+                                            lines,
+                                            form);
     return box(out);
   }, py::arg("source"),
      py::arg("nan_string") = nullptr,
@@ -40,7 +46,9 @@ make_fromjson(py::module& m, const std::string& name) {
      py::arg("minus_infinity_string") = nullptr,
      py::arg("initial") = 1024,
      py::arg("resize") = 1.5,
-     py::arg("buffersize") = 65536);
+     py::arg("buffersize") = 65536,
+     py::arg("lines") = false,
+     py::arg("form") = nullptr);
 }
 
 void
@@ -52,7 +60,9 @@ make_fromjsonfile(py::module& m, const std::string& name) {
            const char* minus_infinity_string,
            int64_t initial,
            double resize,
-           int64_t buffersize) -> py::object {
+           int64_t buffersize,
+           bool lines,
+           const std::shared_ptr<ak::Form>& form) -> py::object {
 #ifdef _MSC_VER
       FILE* file;
       if (fopen_s(&file, source.c_str(), "rb") != 0) {
@@ -72,7 +82,9 @@ make_fromjsonfile(py::module& m, const std::string& name) {
                            buffersize,
                            nan_string,
                            infinity_string,
-                           minus_infinity_string);
+                           minus_infinity_string,
+                           lines,
+                           form);
       }
       catch (...) {
         fclose(file);
@@ -86,7 +98,105 @@ make_fromjsonfile(py::module& m, const std::string& name) {
      py::arg("minus_infinity_string") = nullptr,
      py::arg("initial") = 1024,
      py::arg("resize") = 1.5,
-     py::arg("buffersize") = 65536);
+     py::arg("buffersize") = 65536,
+     py::arg("lines") = false,
+     py::arg("form") = nullptr);
+}
+
+////////// fromjsonlines
+
+namespace {
+  int64_t
+  lines_num_threads(const py::object& num_threads) {
+    if (num_threads.is(py::none())) {
+      return ak::kernel::num_threads();
+    }
+    return num_threads.cast<int64_t>();
+  }
+}
+
+void
+make_fromjsonlines(py::module& m, const std::string& name) {
+  m.def(name.c_str(),
+        [](const std::string& source,
+           const char* nan_string,
+           const char* infinity_string,
+           const char* minus_infinity_string,
+           int64_t initial,
+           double resize,
+           const py::object& num_threads,
+           const std::shared_ptr<ak::Form>& form) -> ak::PartitionedArrayPtr {
+    int64_t threads = lines_num_threads(num_threads);
+    py::gil_scoped_release release;
+    return ak::FromJsonLinesString(source.c_str(),
+                                   ak::ArrayBuilderOptions(initial, resize),
+                                   threads,
+                                   nan_string,
+                                   infinity_string,
+                                   minus_infinity_string,
+                                   form);
+  }, py::arg("source"),
+     py::arg("nan_string") = nullptr,
+     py::arg("infinity_string") = nullptr,
+     py::arg("minus_infinity_string") = nullptr,
+     py::arg("initial") = 1024,
+     py::arg("resize") = 1.5,
+     py::arg("num_threads") = py::none(),
+     py::arg("form") = nullptr);
+}
+
+void
+make_fromjsonlinesfile(py::module& m, const std::string& name) {
+  m.def(name.c_str(),
+        [](const std::string& source,
+           const char* nan_string,
+           const char* infinity_string,
+           const char* minus_infinity_string,
+           int64_t initial,
+           double resize,
+           int64_t buffersize,
+           const py::object& num_threads,
+           const std::shared_ptr<ak::Form>& form) -> ak::PartitionedArrayPtr {
+    int64_t threads = lines_num_threads(num_threads);
+#ifdef _MSC_VER
+      FILE* file;
+      if (fopen_s(&file, source.c_str(), "rb") != 0) {
+#else
+      FILE* file = fopen(source.c_str(), "rb");
+      if (file == nullptr) {
+#endif
+        throw std::invalid_argument(
+          std::string("file \"") + source
+          + std::string("\" could not be opened for reading")
+          + FILENAME(__LINE__));
+      }
+      ak::PartitionedArrayPtr out(nullptr);
+      try {
+        py::gil_scoped_release release;
+        out = FromJsonLinesFile(file,
+                                ak::ArrayBuilderOptions(initial, resize),
+                                buffersize,
+                                threads,
+                                nan_string,
+                                infinity_string,
+                                minus_infinity_string,
+                                form);
+      }
+      catch (...) {
+        fclose(file);
+        throw;
+      }
+      fclose(file);
+      return out;
+  }, py::arg("source"),
+     py::arg("nan_string") = nullptr,
+     py::arg("infinity_string") = nullptr,
+     py::arg("minus_infinity_string") = nullptr,
+     py::arg("initial") = 1024,
+     py::arg("resize") = 1.5,
+     py::arg("buffersize") = 65536,
+     py::arg("num_threads") = py::none(),
+     py::arg("form") = nullptr);
 }
 
 ////////// Uproot connector
@@ -1,5 +1,7 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
 
+#include <pybind11/stl.h>
+
 #include "awkward/python/kernel_utils.h"
 
 namespace ak = awkward;
@@ -11,3 +13,80 @@ make_lib_enum(const py::handle& m, const std::string& name) {
     .value("cuda", ak::kernel::lib::cuda)
     .export_values());
 }
+
+void
+make_num_threads(py::module& m, const std::string& name) {
+  m.def(name.c_str(), []() -> int64_t {
+    return ak::kernel::num_threads();
+  });
+  m.def((std::string("set_") + name).c_str(), [](int64_t num_threads) -> void {
+    ak::kernel::set_num_threads(num_threads);
+  }, py::arg("num_threads"));
+}
+
+void
+make_num_background_threads(py::module& m, const std::string& name) {
+  m.def(name.c_str(), []() -> int64_t {
+    return ak::kernel::num_background_threads();
+  });
+  m.def((std::string("set_") + name).c_str(), [](int64_t num_threads) -> void {
+    ak::kernel::set_num_background_threads(num_threads);
+  }, py::arg("num_threads"));
+}
+
+void
+make_allocator(py::module& m, const std::string& name) {
+  m.def(name.c_str(), []() -> py::object {
+    const ak::kernel::AllocatorPtr& current = ak::kernel::thread_allocator();
+    if (current.get() != nullptr) {
+      for (auto const& x : ak::kernel::allocator_names()) {
+        if (ak::kernel::get_allocator(x).get() == current.get()) {
+          return py::str(x);
+        }
+      }
+    }
+    return py::none();
+  });
+  m.def((std::string("set_") + name).c_str(),
+        [](const py::object& allocator) -> void {
+    if (allocator.is(py::none())) {
+      ak::kernel::set_thread_allocator(std::string(""));
+    }
+    else {
+      ak::kernel::set_thread_allocator(allocator.cast<std::string>());
+    }
+  }, py::arg("allocator"));
+  m.def((name + "_names").c_str(), []() -> std::vector<std::string> {
+    return ak::kernel::allocator_names();
+  });
+  m.def((name + "_stats").c_str(), [](const std::string& allocator,
+                                      bool reset) -> py::dict {
+    ak::kernel::AllocatorPtr found = ak::kernel::get_allocator(allocator);
+    ak::kernel::AllocatorStats stats = found.get()->stats();
+    if (reset) {
+      found.get()->reset_stats();
+    }
+    py::dict out;
+    out["num_allocations"] = stats.num_allocations;
+    out["num_deallocations"] = stats.num_deallocations;
+    out["bytes_allocated"] = stats.bytes_allocated;
+    out["bytes_in_use"] = stats.bytes_in_use;
+    out["peak_bytes_in_use"] = stats.peak_bytes_in_use;
+    return out;
+  }, py::arg("allocator"), py::arg("reset") = false);
+}
+
+void
+install_background_wait() {
+  // Background tasks may need the GIL (to call Python generators), so it
+  // must not be held while waiting for them.
+  ak::kernel::set_background_wait([](const std::function<void()>& block) {
+    if (PyGILState_Check()) {
+      py::gil_scoped_release release;
+      block();
+    }
+    else {
+      block();
+    }
+  });
+}
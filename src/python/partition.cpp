@@ -2,6 +2,7 @@
 
 #define FILENAME(line) FILENAME_FOR_EXCEPTIONS("src/python/partition.cpp", line)
 
+#include "awkward/Reducer.h"
 #include "awkward/python/content.h"
 
 #include "awkward/python/partition.h"
@@ -17,8 +18,9 @@ std::string
 tojson_string(const T& self,
               bool pretty,
               const py::object& maxdecimals) {
-  return self.tojson(pretty,
-                     check_maxdecimals(maxdecimals));
+  int64_t intmaxdecimals = check_maxdecimals(maxdecimals);
+  py::gil_scoped_release release;
+  return self.tojson(pretty, intmaxdecimals);
 }
 
 template <typename T>
@@ -52,6 +54,66 @@ tojson_file(const T& self,
   fclose(file);
 }
 
+/// @brief Applies `function` to each partition with the GIL released, so
+/// that partitions can be processed on several threads.
+template <typename T>
+ak::PartitionedArrayPtr
+map_partitions(const T& self,
+               const std::function<const ak::ContentPtr(
+                   const ak::ContentPtr&)>& function) {
+  py::gil_scoped_release release;
+  return self.map_partitions(function);
+}
+
+std::shared_ptr<ak::Reducer>
+reducer_by_name(const std::string& name, const py::object& initial) {
+  if (name == "count") {
+    return std::make_shared<ak::ReducerCount>();
+  }
+  else if (name == "count_nonzero") {
+    return std::make_shared<ak::ReducerCountNonzero>();
+  }
+  else if (name == "sum") {
+    return std::make_shared<ak::ReducerSum>();
+  }
+  else if (name == "prod") {
+    return std::make_shared<ak::ReducerProd>();
+  }
+  else if (name == "any") {
+    return std::make_shared<ak::ReducerAny>();
+  }
+  else if (name == "all") {
+    return std::make_shared<ak::ReducerAll>();
+  }
+  else if (name == "min"  ||  name == "max") {
+    if (initial.is(py::none())) {
+      if (name == "min") {
+        return std::make_shared<ak::ReducerMin>();
+      }
+      return std::make_shared<ak::ReducerMax>();
+    }
+    double initial_f64 = initial.cast<double>();
+    uint64_t initial_u64 = (initial_f64 > 0 ? initial.cast<uint64_t>() : 0);
+    int64_t initial_i64 = initial.cast<int64_t>();
+    if (name == "min") {
+      return std::make_shared<ak::ReducerMin>(
+        initial_f64, initial_u64, initial_i64);
+    }
+    return std::make_shared<ak::ReducerMax>(
+      initial_f64, initial_u64, initial_i64);
+  }
+  else if (name == "argmin") {
+    return std::make_shared<ak::ReducerArgmin>();
+  }
+  else if (name == "argmax") {
+    return std::make_shared<ak::ReducerArgmax>();
+  }
+  else {
+    throw std::invalid_argument(
+      std::string("unrecognized reducer: ") + name + FILENAME(__LINE__));
+  }
+}
+
 template <typename T>
 py::class_<T, std::shared_ptr<T>, ak::PartitionedArray>
 partitionedarray_methods(py::class_<T, std::shared_ptr<T>,
@@ -116,6 +178,78 @@ partitionedarray_methods(py::class_<T, std::shared_ptr<T>,
             }
             return self.getitem_range(intstart, intstop, intstep);
           })
+          .def("map_getitem", [](const T& self, py::object where)
+                              -> ak::PartitionedArrayPtr {
+            ak::Slice slice = toslice(where);
+            return map_partitions(self, [&slice](const ak::ContentPtr& x) {
+              return x.get()->getitem(slice);
+            });
+          })
+          .def("map_reduce", [](const T& self,
+                                const std::string& name,
+                                int64_t axis,
+                                bool mask,
+                                bool keepdims,
+                                const py::object& initial)
+                             -> ak::PartitionedArrayPtr {
+            std::shared_ptr<ak::Reducer> reducer =
+              reducer_by_name(name, initial);
+            return map_partitions(self, [&](const ak::ContentPtr& x) {
+              return x.get()->reduce(*reducer.get(), axis, mask, keepdims);
+            });
+          }, py::arg("name"),
+             py::arg("axis"),
+             py::arg("mask"),
+             py::arg("keepdims"),
+             py::arg("initial") = py::none())
+          .def("map_sort", [](const T& self,
+                              int64_t axis,
+                              bool ascending,
+                              bool stable) -> ak::PartitionedArrayPtr {
+            return map_partitions(self, [&](const ak::ContentPtr& x) {
+              return x.get()->sort(axis, ascending, stable);
+            });
+          })
+          .def("map_argsort", [](const T& self,
+                                 int64_t axis,
+                                 bool ascending,
+                                 bool stable) -> ak::PartitionedArrayPtr {
+            return map_partitions(self, [&](const ak::ContentPtr& x) {
+              return x.get()->argsort(axis, ascending, stable);
+            });
+          })
+          .def("map_combinations", [](const T& self,
+                                      int64_t n,
+                                      bool replacement,
+                                      py::object keys,
+                                      py::object parameters,
+                                      int64_t axis) -> ak::PartitionedArrayPtr {
+            std::shared_ptr<ak::util::RecordLookup> recordlookup(nullptr);
+            if (!keys.is(py::none())) {
+              recordlookup = std::make_shared<ak::util::RecordLookup>();
+              for (auto x : keys.cast<py::iterable>()) {
+                recordlookup.get()->push_back(x.cast<std::string>());
+              }
+              if (n != recordlookup.get()->size()) {
+                throw std::invalid_argument(
+                  std::string("if provided, the length of 'keys' must be 'n'")
+                  + FILENAME(__LINE__));
+              }
+            }
+            ak::util::Parameters params = dict2parameters(parameters);
+            return map_partitions(self, [&](const ak::ContentPtr& x) {
+              return x.get()->combinations(n,
+                                           replacement,
+                                           recordlookup,
+                                           params,
+                                           axis,
+                                           0);
+            });
+          }, py::arg("n"),
+             py::arg("replacement") = false,
+             py::arg("keys") = py::none(),
+             py::arg("parameters") = py::none(),
+             py::arg("axis") = 1)
           .def("copy_to",
                [](const T& self, const std::string& ptr_lib) -> ak::PartitionedArrayPtr {
                if (ptr_lib == "cpu") {
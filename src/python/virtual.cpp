@@ -39,6 +39,8 @@ PyArrayGenerator::kwargs() const {
 
 const ak::ContentPtr
 PyArrayGenerator::generate() const {
+  // may be called from a thread without the GIL (see map_partitions)
+  py::gil_scoped_acquire acquire;
   py::object out = callable_(*args_, **kwargs_);
   py::object layout = py::module::import("awkward").attr("to_layout")(
                                         out, py::cast(false), py::cast(false));
@@ -49,7 +51,7 @@ void
 PyArrayGenerator::caches(std::vector<ak::ArrayCachePtr>& out) const {
   for (auto arg : args_) {
     try {
-      std::shared_ptr<PyArrayCache> ptr = arg.cast<std::shared_ptr<PyArrayCache>>();
+      ak::ArrayCachePtr ptr = unbox_cache(py::reinterpret_borrow<py::object>(arg));
       if (ptr != nullptr) {
         bool found = false;
         for (auto oldcache : out) {
@@ -63,7 +65,7 @@ PyArrayGenerator::caches(std::vector<ak::ArrayCachePtr>& out) const {
         }
       }
     }
-    catch (py::cast_error err) { }
+    catch (std::invalid_argument err) { }
   }
 }
 
@@ -198,6 +200,71 @@ PyArrayGenerator::referentially_equal(const ak::ArrayGeneratorPtr& other) const
   }
 }
 
+const std::shared_ptr<ak::ArrayGenerator>
+PyArrayGenerator::projected(const char* method,
+                            const py::object& arg1,
+                            const py::object& arg2,
+                            const ak::FormPtr& form,
+                            int64_t length) const {
+  if (!py::hasattr(callable_, method)) {
+    return ak::ArrayGeneratorPtr(nullptr);
+  }
+  py::object callable = arg2.is(py::none())
+                            ? callable_.attr(method)(arg1)
+                            : callable_.attr(method)(arg1, arg2);
+  if (callable.is(py::none())) {
+    return ak::ArrayGeneratorPtr(nullptr);
+  }
+  return std::make_shared<PyArrayGenerator>(form,
+                                            length,
+                                            callable,
+                                            args_,
+                                            kwargs_);
+}
+
+const std::shared_ptr<ak::ArrayGenerator>
+PyArrayGenerator::getitem_range(int64_t start, int64_t stop) const {
+  ak::FormPtr form = this->form();
+  if (form.get() != nullptr) {
+    form = form.get()->getitem_range();
+  }
+  // may be called from a thread without the GIL (see SliceGenerator)
+  py::gil_scoped_acquire acquire;
+  return projected("getitem_range",
+                   py::cast(start),
+                   py::cast(stop),
+                   form,
+                   stop - start);
+}
+
+const std::shared_ptr<ak::ArrayGenerator>
+PyArrayGenerator::getitem_field(const std::string& key) const {
+  ak::FormPtr form = this->form();
+  if (form.get() != nullptr) {
+    form = form.get()->getitem_field(key);
+  }
+  py::gil_scoped_acquire acquire;
+  return projected("getitem_field",
+                   py::cast(key),
+                   py::none(),
+                   form,
+                   length_);
+}
+
+const std::shared_ptr<ak::ArrayGenerator>
+PyArrayGenerator::getitem_fields(const std::vector<std::string>& keys) const {
+  ak::FormPtr form = this->form();
+  if (form.get() != nullptr) {
+    form = form.get()->getitem_fields(keys);
+  }
+  py::gil_scoped_acquire acquire;
+  return projected("getitem_fields",
+                   py::cast(keys),
+                   py::none(),
+                   form,
+                   length_);
+}
+
 py::class_<PyArrayGenerator, std::shared_ptr<PyArrayGenerator>>
 make_PyArrayGenerator(const py::handle& m, const std::string& name) {
   return (py::class_<PyArrayGenerator,
@@ -426,6 +493,7 @@ PyArrayCache::mutablemapping() const {
 
 ak::ContentPtr
 PyArrayCache::get(const std::string& key) const {
+  py::gil_scoped_acquire acquire;
   py::str pykey(PyUnicode_DecodeUTF8(key.data(),
                                      key.length(),
                                      "surrogateescape"));
@@ -441,6 +509,7 @@ PyArrayCache::get(const std::string& key) const {
 
 void
 PyArrayCache::set(const std::string& key, const ak::ContentPtr& value) {
+  py::gil_scoped_acquire acquire;
   py::str pykey(PyUnicode_DecodeUTF8(key.data(),
                                      key.length(),
                                      "surrogateescape"));
@@ -506,3 +575,105 @@ make_PyArrayCache(const py::handle& m, const std::string& name) {
 
   );
 }
+
+////////// LRUArrayCache
+
+py::class_<ak::LRUArrayCache, std::shared_ptr<ak::LRUArrayCache>>
+make_LRUArrayCache(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::LRUArrayCache,
+                     std::shared_ptr<ak::LRUArrayCache>>(m, name.c_str())
+      .def(py::init<int64_t, int64_t>(),
+           py::arg("max_bytes"), py::arg("num_stripes") = 16)
+      .def_property_readonly("is_broken", &ak::LRUArrayCache::is_broken)
+      .def_property_readonly("max_bytes", &ak::LRUArrayCache::max_bytes)
+      .def_property_readonly("num_stripes", &ak::LRUArrayCache::num_stripes)
+      .def_property_readonly("nbytes", &ak::LRUArrayCache::nbytes)
+      .def_property_readonly("hits", &ak::LRUArrayCache::hits)
+      .def_property_readonly("misses", &ak::LRUArrayCache::misses)
+      .def_property_readonly("evictions", &ak::LRUArrayCache::evictions)
+      .def("__repr__", [](const ak::LRUArrayCache& self) -> std::string {
+        return self.tostring_part("", "", "");
+      })
+      // The GIL is released while the cache is locked, so that Python
+      // threads can use it at the same time (arrays from Python take the
+      // GIL when they are released).
+      .def("__getitem__", [](const ak::LRUArrayCache& self,
+                             const std::string& key) -> py::object {
+        ak::ContentPtr out(nullptr);
+        {
+          py::gil_scoped_release release;
+          out = self.get(key);
+        }
+        if (out.get() == nullptr) {
+          throw py::key_error(key);
+        }
+        return box(out);
+      })
+      .def("__setitem__", [](ak::LRUArrayCache& self,
+                             const std::string& key,
+                             const py::object& value) -> void {
+        ak::ContentPtr content = unbox_content(value);
+        py::gil_scoped_release release;
+        self.set(key, content);
+      })
+      .def("__delitem__", [](ak::LRUArrayCache& self,
+                             const std::string& key) -> void {
+        bool erased;
+        {
+          py::gil_scoped_release release;
+          erased = self.erase(key);
+        }
+        if (!erased) {
+          throw py::key_error(key);
+        }
+      })
+      .def("__contains__", &ak::LRUArrayCache::contains,
+           py::call_guard<py::gil_scoped_release>())
+      .def("__len__", &ak::LRUArrayCache::length)
+      .def("clear", &ak::LRUArrayCache::clear,
+           py::call_guard<py::gil_scoped_release>())
+      .def("pin", &ak::LRUArrayCache::pin,
+           py::call_guard<py::gil_scoped_release>())
+      .def("unpin", &ak::LRUArrayCache::unpin,
+           py::call_guard<py::gil_scoped_release>())
+  );
+}
+
+py::object
+box_cache(const ak::ArrayCachePtr& cache) {
+  if (cache.get() == nullptr) {
+    return py::none();
+  }
+  else if (std::shared_ptr<PyArrayCache> ptr =
+               std::dynamic_pointer_cast<PyArrayCache>(cache)) {
+    return py::cast(ptr);
+  }
+  else if (std::shared_ptr<ak::LRUArrayCache> ptr =
+               std::dynamic_pointer_cast<ak::LRUArrayCache>(cache)) {
+    return py::cast(ptr);
+  }
+  else {
+    throw std::runtime_error(
+      std::string("VirtualArray's cache is not a PyArrayCache or an "
+                  "LRUArrayCache") + FILENAME(__LINE__));
+  }
+}
+
+ak::ArrayCachePtr
+unbox_cache(const py::object& cache) {
+  if (cache.is(py::none())) {
+    return ak::ArrayCachePtr(nullptr);
+  }
+  try {
+    return cache.cast<std::shared_ptr<PyArrayCache>>();
+  }
+  catch (py::cast_error err) { }
+  try {
+    return cache.cast<std::shared_ptr<ak::LRUArrayCache>>();
+  }
+  catch (py::cast_error err) {
+    throw std::invalid_argument(
+      std::string("VirtualArray 'cache' must be an ArrayCache, an "
+                  "LRUArrayCache, or None") + FILENAME(__LINE__));
+  }
+}
@@ -0,0 +1,57 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_numbers():
+    array = ak.Array([[1.1, 2.2, 3.3], [], [4.4, 5.5], [6.6]])
+    assert ak.to_list(ak.sum(array, axis=-1)) == pytest.approx([6.6, 0.0, 9.9, 6.6])
+    assert ak.to_list(ak.prod(array, axis=-1)) == pytest.approx(
+        [1.1 * 2.2 * 3.3, 1.0, 4.4 * 5.5, 6.6]
+    )
+    assert ak.to_list(ak.min(array, axis=-1)) == [1.1, None, 4.4, 6.6]
+    assert ak.to_list(ak.max(array, axis=-1)) == [3.3, None, 5.5, 6.6]
+    assert ak.to_list(ak.count(array, axis=-1)) == [3, 0, 2, 1]
+    assert ak.to_list(ak.count_nonzero(array, axis=-1)) == [3, 0, 2, 1]
+    assert ak.to_list(ak.min(array, axis=-1, mask_identity=False)) == [
+        1.1,
+        np.inf,
+        4.4,
+        6.6,
+    ]
+    assert ak.to_list(ak.sum(array, axis=-1, keepdims=True)) == pytest.approx(
+        [[6.6], [0.0], [9.9], [6.6]]
+    )
+
+
+def test_integers():
+    array = ak.Array([[1, 2, 3], [], [0, 5], [-6]])
+    assert ak.to_list(ak.sum(array, axis=-1)) == [6, 0, 5, -6]
+    assert ak.to_list(ak.prod(array, axis=-1)) == [6, 1, 0, -6]
+    assert ak.to_list(ak.min(array, axis=-1)) == [1, None, 0, -6]
+    assert ak.to_list(ak.max(array, axis=-1)) == [3, None, 5, -6]
+    assert ak.to_list(ak.count_nonzero(array, axis=-1)) == [3, 0, 1, 1]
+
+
+def test_offsets_not_starting_at_zero():
+    content = ak.layout.NumpyArray(np.arange(10, dtype=np.int64))
+    offsets = ak.layout.Index64(np.array([2, 5, 5, 7, 10], dtype=np.int64))
+    array = ak.Array(ak.layout.ListOffsetArray64(offsets, content))
+    assert ak.to_list(ak.sum(array, axis=-1)) == [9, 0, 11, 24]
+    assert ak.to_list(ak.max(array, axis=-1)) == [4, None, 6, 9]
+    assert ak.to_list(ak.sum(array[1:], axis=-1)) == [0, 11, 24]
+    assert ak.to_list(ak.argmax(array, axis=-1)) == [2, None, 1, 2]
+
+
+def test_nested():
+    array = ak.Array([[[1, 2], [3]], [], [[4, 5, 6], []]])
+    assert ak.to_list(ak.sum(array, axis=-1)) == [[3, 3], [], [15, 0]]
+    assert ak.to_list(ak.sum(array, axis=-1, keepdims=True)) == [
+        [[3], [3]],
+        [],
+        [[15], [0]],
+    ]
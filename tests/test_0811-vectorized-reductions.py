@@ -0,0 +1,44 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+@pytest.mark.parametrize("dtype", [np.int8, np.int32, np.uint64, np.float32, np.float64])
+def test_long_lists(dtype):
+    np.random.seed(12345)
+    counts = np.random.randint(0, 50, 100)
+    content = np.random.randint(0, 40, counts.sum()).astype(dtype)
+    array = ak.unflatten(content, counts)
+
+    starts = np.concatenate([[0], np.cumsum(counts)[:-1]])
+    expected_sum = [content[s : s + c].sum() for s, c in zip(starts, counts)]
+    expected_min = [
+        content[s : s + c].min() if c > 0 else None for s, c in zip(starts, counts)
+    ]
+    expected_max = [
+        content[s : s + c].max() if c > 0 else None for s, c in zip(starts, counts)
+    ]
+    expected_nonzero = [
+        np.count_nonzero(content[s : s + c]) for s, c in zip(starts, counts)
+    ]
+
+    assert ak.to_list(ak.sum(array, axis=-1)) == pytest.approx(expected_sum)
+    assert ak.to_list(ak.min(array, axis=-1)) == expected_min
+    assert ak.to_list(ak.max(array, axis=-1)) == expected_max
+    assert ak.to_list(ak.count_nonzero(array, axis=-1)) == expected_nonzero
+
+
+def test_flat():
+    content = np.arange(1, 101, dtype=np.float64)
+    array = ak.Array(content)
+    assert ak.sum(array, axis=None) == 5050
+    assert ak.sum(array, axis=0) == 5050
+    assert ak.min(array, axis=0) == 1
+    assert ak.max(array, axis=0) == 100
+    assert ak.count(array, axis=0) == 100
+    assert ak.argmax(array, axis=0) == 99
+    assert ak.min(ak.Array(np.array([], np.float64)), axis=0) is None
@@ -0,0 +1,76 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+@pytest.mark.parametrize(
+    "dtype", [np.int8, np.uint16, np.int32, np.int64, np.float32, np.float64]
+)
+@pytest.mark.parametrize("ascending", [True, False])
+def test_sublist_lengths(dtype, ascending):
+    # short, medium, and long sublists take different paths through the engine
+    np.random.seed(12345)
+    counts = np.array([0, 1, 5, 16, 17, 100, 255, 256, 1000])
+    content = (np.random.randint(-100, 100, counts.sum()) % 120).astype(dtype)
+    array = ak.unflatten(content, counts)
+
+    starts = np.concatenate([[0], np.cumsum(counts)[:-1]])
+    expected_sort = []
+    expected_argsort = []
+    for start, count in zip(starts, counts):
+        sublist = content[start : start + count]
+        if ascending:
+            index = np.argsort(sublist, kind="stable")
+        else:
+            index = np.argsort(-sublist.astype(np.float64), kind="stable")
+        expected_sort.append(sublist[index].tolist())
+        expected_argsort.append(index.tolist())
+
+    for stable in (True, False):
+        assert (
+            ak.to_list(ak.sort(array, ascending=ascending, stable=stable))
+            == expected_sort
+        )
+    assert (
+        ak.to_list(ak.argsort(array, ascending=ascending, stable=True))
+        == expected_argsort
+    )
+
+
+def test_negative_floats():
+    array = ak.Array([[3.3, -1.1, 0.0, -np.inf, 2.2, np.inf, -5.5] * 50])
+    expected = sorted(ak.to_list(array[0]))
+    assert ak.to_list(ak.sort(array, axis=-1))[0] == expected
+    assert ak.to_list(ak.sort(array, axis=-1, ascending=False))[0] == expected[::-1]
+
+
+def test_booleans():
+    array = ak.Array([[True, False, True, False] * 100, [False, True]])
+    assert ak.to_list(ak.sort(array, axis=-1)) == [
+        [False] * 200 + [True] * 200,
+        [False, True],
+    ]
+    assert ak.to_list(ak.argsort(array, axis=-1, stable=True))[1] == [0, 1]
+
+
+@pytest.mark.parametrize("ascending", [True, False])
+def test_zeros_and_nan(ascending):
+    # all sublist lengths order -0.0, +0.0, and NaN the same way
+    for count in (10, 100, 300):
+        sublist = np.array([0.0, -0.0, np.nan, 1.0, -1.0] * (count // 5))
+        array = ak.Array([sublist])
+        sign = 1 if ascending else -1
+        expected = sorted(
+            range(count),
+            key=lambda i: (np.isnan(sublist[i]), sign * np.nan_to_num(sublist[i])),
+        )
+        assert ak.to_list(ak.argsort(array, ascending=ascending, stable=True)) == [
+            expected
+        ]
+        result = np.asarray(ak.sort(array, ascending=ascending, stable=True)[0])
+        assert np.isnan(result[-(count // 5) :]).all()
+        assert np.signbit(result).tolist() == np.signbit(sublist[expected]).tolist()
@@ -0,0 +1,64 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+@pytest.fixture
+def threads():
+    original = ak.config.num_threads()
+    ak.config.set_num_threads(4)
+    yield
+    ak.config.set_num_threads(original)
+
+
+def test_num_threads():
+    original = ak.config.num_threads()
+    try:
+        ak.config.set_num_threads(3)
+        assert ak.config.num_threads() == 3
+        ak.config.set_num_threads(0)
+        assert ak.config.num_threads() >= 1
+        with pytest.raises(ValueError):
+            ak.config.set_num_threads(-1)
+    finally:
+        ak.config.set_num_threads(original)
+
+
+def test_large_array(threads):
+    np.random.seed(12345)
+    counts = np.random.randint(0, 5, 200000)
+    content = np.random.normal(0, 1, counts.sum())
+    array = ak.unflatten(content, counts)
+
+    starts = np.concatenate([[0], np.cumsum(counts)[:-1]])
+    assert ak.to_list(ak.num(array)) == counts.tolist()
+    assert ak.to_list(ak.sum(array, axis=-1)) == pytest.approx(
+        [content[s : s + c].sum() for s, c in zip(starts, counts)]
+    )
+
+    carry = np.random.randint(0, len(array), 100000)
+    as_list = ak.to_list(array)
+    assert ak.to_list(array[carry]) == [as_list[i] for i in carry]
+
+    x = array[::2]
+    assert ak.to_list(ak.num(x)) == counts[::2].tolist()
+    assert ak.to_list(x + array[::2]) == ak.to_list(array[::2] * 2)
+
+
+def test_error_position(threads):
+    starts = np.zeros(100000, np.int64)
+    stops = np.ones(100000, np.int64)
+    carry = np.arange(100000, dtype=np.int64)
+    carry[70000] = 999999
+    array = ak.layout.ListArray64(
+        ak.layout.Index64(starts),
+        ak.layout.Index64(stops),
+        ak.layout.NumpyArray(np.arange(1, dtype=np.float64)),
+    )
+    with pytest.raises(ValueError) as err:
+        array[carry]
+    assert "attempting to get 999999" in str(err.value)
@@ -0,0 +1,66 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import json
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+@pytest.fixture(params=[1, 4])
+def threads(request):
+    original = ak.config.num_threads()
+    ak.config.set_num_threads(request.param)
+    yield
+    ak.config.set_num_threads(original)
+
+
+def make_arrays():
+    data = [
+        [{"x": 3, "y": [1.1, 2.2]}, {"x": 1, "y": []}],
+        [],
+        [{"x": 2, "y": [3.3]}],
+        [{"x": 5, "y": [4.4, 5.5, 6.6]}, {"x": 4, "y": [7.7]}, {"x": 0, "y": []}],
+    ] * 10
+    partitioned = ak.partitioned([ak.Array(data[i : i + 7]) for i in range(0, 40, 7)])
+    return partitioned, ak.Array(data)
+
+
+def test_operations(threads):
+    partitioned, array = make_arrays()
+    assert isinstance(partitioned.layout, ak.partition.PartitionedArray)
+
+    assert ak.to_list(partitioned["x"]) == ak.to_list(array["x"])
+    assert ak.to_list(partitioned[:, :1]) == ak.to_list(array[:, :1])
+    assert ak.to_list(partitioned[5:20, :1, "y"]) == ak.to_list(array[5:20, :1, "y"])
+    assert ak.to_list(partitioned[..., "x"]) == ak.to_list(array[..., "x"])
+
+    assert ak.to_list(ak.sum(partitioned.y, axis=-1)) == ak.to_list(
+        ak.sum(array.y, axis=-1)
+    )
+    assert ak.to_list(ak.max(partitioned.x, axis=1)) == ak.to_list(
+        ak.max(array.x, axis=1)
+    )
+    assert ak.to_list(ak.sort(partitioned.x, axis=1)) == ak.to_list(
+        ak.sort(array.x, axis=1)
+    )
+    assert ak.to_list(ak.argsort(partitioned.x, axis=1)) == ak.to_list(
+        ak.argsort(array.x, axis=1)
+    )
+    assert ak.to_list(ak.combinations(partitioned.x, 2)) == ak.to_list(
+        ak.combinations(array.x, 2)
+    )
+
+
+def test_tojson(threads):
+    partitioned, array = make_arrays()
+    assert json.loads(partitioned.layout.tojson()) == ak.to_list(array)
+    assert json.loads(ak.to_json(partitioned)) == ak.to_list(array)
+
+
+def test_errors(threads):
+    partitioned, array = make_arrays()
+    with pytest.raises(ValueError):
+        partitioned[:, 10]
@@ -0,0 +1,48 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import os
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+import awkward.forth
+
+
+def test_whole_file(tmp_path):
+    filename = os.path.join(str(tmp_path), "data.bin")
+    np.arange(10000, dtype=np.int32).tofile(filename)
+
+    source = awkward.forth.ForthInputBuffer(filename)
+    assert len(source) == 40000
+
+    vm = awkward.forth.ForthMachine32("input x output y int32 10000 x #i-> y")
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == list(range(10000))
+
+    # each run starts from the beginning of the mapped file
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == list(range(10000))
+
+
+def test_byte_range(tmp_path):
+    filename = os.path.join(str(tmp_path), "data.bin")
+    np.arange(10000, dtype=np.int32).tofile(filename)
+
+    source = awkward.forth.ForthInputBuffer(filename, offset=4 * 5001, length=12)
+    assert len(source) == 12
+
+    vm = awkward.forth.ForthMachine32("input x output y int32 3 x #i-> y")
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == [5001, 5002, 5003]
+
+    vm = awkward.forth.ForthMachine32("input x output y int32 4 x #i-> y")
+    with pytest.raises(ValueError):
+        vm.run({"x": source})
+
+    with pytest.raises(ValueError):
+        awkward.forth.ForthInputBuffer(filename, offset=40000, length=1)
+    with pytest.raises(ValueError):
+        awkward.forth.ForthInputBuffer(os.path.join(str(tmp_path), "missing.bin"))
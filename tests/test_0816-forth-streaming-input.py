@@ -0,0 +1,84 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import io
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+import awkward.forth
+
+
+def test_file_object():
+    data = np.arange(1000, dtype=np.int32)
+    # 7-byte chunks: most int32 reads straddle two of them
+    source = awkward.forth.ForthInputBuffer(io.BytesIO(data.tobytes()), chunk_size=7)
+    assert source.is_streaming
+
+    vm = awkward.forth.ForthMachine32(
+        "input x output y int32 begin x end invert while x i-> y repeat"
+    )
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == list(range(1000))
+    assert len(source) == 4000
+
+
+def test_function():
+    data = np.arange(1000, dtype=np.int32).tobytes()
+    position = [0]
+
+    def read(num_bytes):
+        num_bytes = min(num_bytes, 3)
+        out = data[position[0] : position[0] + num_bytes]
+        position[0] += len(out)
+        return out
+
+    source = awkward.forth.ForthInputBuffer(read, chunk_size=16)
+    with pytest.raises(ValueError):
+        len(source)
+
+    # reads larger than the window, skips, and seeks backward within it
+    vm = awkward.forth.ForthMachine32(
+        "input x output y int32 100 x #i-> y 400 x skip -4 x skip 2 x #i-> y "
+        "3600 x seek x i-> y"
+    )
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == list(range(100)) + [199, 200, 900]
+
+    # a streaming input continues where it stopped
+    vm = awkward.forth.ForthMachine32("input x output y int32 2 x #i-> y")
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == [901, 902]
+
+    vm = awkward.forth.ForthMachine32("input x output y int32 0 x seek")
+    with pytest.raises(ValueError):
+        vm.run({"x": source})
+
+
+def test_beyond_the_end():
+    data = np.arange(10, dtype=np.int32)
+    source = awkward.forth.ForthInputBuffer(io.BytesIO(data.tobytes()), chunk_size=7)
+
+    # a failed skip or seek does not move the position
+    vm = awkward.forth.ForthMachine32("input x output y int32 x i-> y 100 x skip")
+    with pytest.raises(ValueError):
+        vm.run({"x": source})
+    vm = awkward.forth.ForthMachine32("input x output y int32 100 x seek")
+    with pytest.raises(ValueError):
+        vm.run({"x": source})
+
+    vm = awkward.forth.ForthMachine32("input x output y int32 9 x #i-> y")
+    vm.run({"x": source})
+    assert np.asarray(vm["y"]).tolist() == list(range(1, 10))
+
+
+def test_source_error():
+    def read(num_bytes):
+        raise ZeroDivisionError("source failed")
+
+    source = awkward.forth.ForthInputBuffer(read)
+    vm = awkward.forth.ForthMachine32("input x output y int32 x i-> y")
+    with pytest.raises(ZeroDivisionError):
+        vm.run({"x": source})
@@ -0,0 +1,80 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+import awkward.forth
+
+
+programs = [
+    "input x output y int32 10 0 do x i-> y loop",
+    "input x output y int32 200 0 do x i-> y loop",
+    "input x output y int32 10 0 do x !i-> y loop",
+    "input x output y int32 10 5 do x B-> y loop 3 3 do x q-> y loop",
+    "input x output y float64 20 0 do x d-> y loop",
+    "input x output y int32 1 0 do x i-> y +loop",
+    "input x output y int32 begin x i-> stack y <- stack again",
+    "input x output y int32 5 0 do x varint-> stack y <- stack "
+    "x zigzag-> stack y <- stack loop",
+    "input x output y int32 20 0 do x !h-> stack y <- stack "
+    "x d-> stack y <- stack loop",
+    "input x output y int32 : f 3 0 do x b-> y loop ; f f 4 0 do f i y <- stack loop",
+    "input x output y int32 5 0 do 2 0 do x i-> y i j + y <- stack loop loop",
+    "input x output y int32 5 0 do 2 0 do x i-> y loop i y <- stack loop",
+    "input x output y int32 x i-> stack 4 + y <- stack x #I-> y",
+    "input x output y int32 10 0 do x i-> y loop x i-> stack 1 if y <- stack then",
+    "input x output y int32 variable v 5 0 do x i-> y v @ 1+ v ! loop halt",
+    "input x output y int32 begin x b-> stack dup y <- stack 200 > until",
+    "input x output y int32 : g x b-> stack dup 50 > if drop exit then "
+    "y <- stack ; 30 0 do g loop",
+    "input x output y int32 begin x B-> stack dup 100 < while y <- stack repeat",
+    "input x output y int32 10 0 do i 2 mod if x b-> y else x i-> y then loop",
+    "input x output y int32 : fact dup 1 > if dup 1- recurse * then ; "
+    "6 fact y <- stack",
+    "input x output y int32 : f 2 0 do x b-> y loop ; 3 0 do f loop",
+    "input x output y int32 : f recurse ; f",
+]
+
+
+@pytest.mark.parametrize("source", programs)
+@pytest.mark.parametrize("machine", [awkward.forth.ForthMachine32, awkward.forth.ForthMachine64])
+def test_same_as_bytecode(source, machine):
+    data = (np.arange(400) * 7 + 1).astype(np.uint8)
+
+    results = []
+    for threaded in [False, True]:
+        vm = machine(source, threaded=threaded)
+        assert vm.threaded is threaded
+        err = vm.run(
+            {"x": data.copy()},
+            raise_user_halt=False,
+            raise_read_beyond=False,
+        )
+        results.append(
+            (
+                err,
+                vm.stack,
+                vm.variables,
+                vm.count_instructions,
+                vm.count_reads,
+                vm.count_writes,
+                {k: ak.to_list(v) for k, v in vm.outputs.items()},
+            )
+        )
+
+    assert results[0] == results[1]
+
+
+def test_step_is_unchanged():
+    vm = awkward.forth.ForthMachine32(
+        "input x output y int32 3 0 do x i-> y loop", threaded=True
+    )
+    vm.begin({"x": np.arange(3, dtype=np.int32)})
+    while not vm.is_done:
+        vm.step()
+    # as a loop, one instruction at a time, not as a bulk read
+    assert vm.count_instructions == 9
+    assert ak.to_list(vm["y"]) == [0, 1, 2]
@@ -0,0 +1,84 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+import awkward.forth
+
+
+source = """
+input data
+output offsets int32
+output content float32
+variable total
+
+0 offsets <- stack
+begin
+  data i-> stack
+  dup offsets +<- stack
+  dup total +!
+  data #f-> content
+again
+"""
+
+
+def basket(counts, seed):
+    np.random.seed(seed)
+    out = []
+    contents = []
+    for count in counts:
+        content = np.random.normal(0, 1, count).astype(np.float32)
+        out.append(np.array([count], np.int32).tobytes())
+        out.append(content.tobytes())
+        contents.append(content)
+    return np.frombuffer(b"".join(out), np.uint8), contents
+
+
+@pytest.mark.parametrize("threaded", [False, True])
+@pytest.mark.parametrize("nthreads", [None, 1, 4])
+def test_run_many(threaded, nthreads):
+    program = awkward.forth.ForthMachine32(source, threaded=threaded)
+
+    baskets = [basket(range(i % 7 + 1), i) for i in range(20)]
+    machines = program.run_many(
+        [{"data": data} for data, _ in baskets],
+        nthreads=nthreads,
+        raise_read_beyond=False,
+    )
+
+    assert len(machines) == 20
+    for machine, (_, contents) in zip(machines, baskets):
+        counts = [len(x) for x in contents]
+        assert machine["total"] == sum(counts)
+        assert ak.to_list(machine["offsets"]) == [0] + np.cumsum(counts).tolist()
+        assert (
+            ak.to_list(machine["content"]) == np.concatenate(contents).tolist()
+        )
+
+    # the program itself has not been run
+    assert not program.is_ready
+    assert program["total"] == 0
+
+
+def test_run_many_errors():
+    program = awkward.forth.ForthMachine32("input x output y int32 x i-> y")
+    with pytest.raises(ValueError):
+        program.run_many([{"x": np.array([1], np.int32)}, {"x": np.array([], np.int32)}])
+
+    machines = program.run_many(
+        [{"x": np.array([1], np.int32)}, {"x": np.array([], np.int32)}],
+        raise_read_beyond=False,
+    )
+    assert ak.to_list(machines[0]["y"]) == [1]
+    assert ak.to_list(machines[1]["y"]) == []
+
+
+def test_copy_program():
+    program = awkward.forth.ForthMachine64("input x output y int64 x q-> stack 2 * y <- stack")
+    vm = program.copy_program()
+    vm.run({"x": np.array([21], np.int64)})
+    assert ak.to_list(vm["y"]) == [42]
+    assert vm.source == program.source
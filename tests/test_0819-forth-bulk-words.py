@@ -0,0 +1,134 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+import awkward.forth
+
+
+def test_counts_to_offsets():
+    counts = np.array([3, 0, 2, 5], np.int32)
+    vm = awkward.forth.ForthMachine32(
+        "input x output offsets int64 0 offsets <- stack 4 x #+i-> offsets"
+    )
+    vm.run({"x": counts})
+    assert ak.to_list(vm["offsets"]) == [0, 3, 3, 5, 10]
+    assert vm.stack == []
+    assert vm.input_position("x") == 16
+
+
+def test_delta_decoding():
+    np.random.seed(12345)
+    values = np.cumsum(np.random.randint(-100, 100, 3000)).astype(np.int64)
+    deltas = np.diff(values, prepend=0)
+
+    vm = awkward.forth.ForthMachine64("input x output y int64 3000 x #+q-> y")
+    vm.run({"x": deltas})
+    assert ak.to_list(vm["y"]) == values.tolist()
+
+    vm = awkward.forth.ForthMachine64("input x output y int64 3000 x #!+q-> y")
+    vm.run({"x": deltas.astype(">i8")})
+    assert ak.to_list(vm["y"]) == values.tolist()
+
+    # zigzag varints: 10, -1, 1, -2, 72
+    data = np.array([20, 1, 2, 3, 0x90, 0x01], np.uint8)
+    vm = awkward.forth.ForthMachine32("input x output y int64 5 x #+zigzag-> y")
+    vm.run({"x": data})
+    assert ak.to_list(vm["y"]) == [10, 9, 10, 8, 80]
+
+
+@pytest.mark.parametrize("dtype", [np.float32, np.float64, np.int32, np.int64])
+def test_byte_stream_split(dtype):
+    values = (np.arange(2500) * 1.5 - 3).astype(dtype)
+    split = values.view(np.uint8).reshape(-1, values.itemsize).T.copy()
+    code = {np.float32: "f", np.float64: "d", np.int32: "i", np.int64: "q"}[dtype]
+    output = {np.float32: "float32", np.float64: "float64", np.int32: "int32", np.int64: "int64"}[dtype]
+
+    vm = awkward.forth.ForthMachine32(
+        "input x output y {0} 2500 x #%{1}-> y".format(output, code)
+    )
+    vm.run({"x": split})
+    assert ak.to_list(vm["y"]) == values.tolist()
+    assert vm.input_position("x") == values.nbytes
+
+    bigendian = values.astype(values.dtype.newbyteorder(">"))
+    split = bigendian.view(np.uint8).reshape(-1, values.itemsize).T.copy()
+    vm = awkward.forth.ForthMachine32(
+        "input x output y {0} 2500 x #!%{1}-> y".format(output, code)
+    )
+    vm.run({"x": split})
+    assert ak.to_list(vm["y"]) == values.tolist()
+
+
+def test_dictionary_lookup():
+    dictionary = np.array([0.5, 1.5, 2.5], np.float32)
+    index = np.array([2, 0, 0, 1, 2], np.uint8)
+    vm = awkward.forth.ForthMachine32(
+        """input dict input x
+        output values float32 output y float32
+        3 dict #f-> values
+        5 x #@B-> y values"""
+    )
+    vm.run({"dict": dictionary, "x": index})
+    assert ak.to_list(vm["y"]) == [2.5, 0.5, 0.5, 1.5, 2.5]
+
+    index = np.array([2, 0, 3], np.uint8)
+    vm = awkward.forth.ForthMachine32(
+        """input dict input x
+        output values float32 output y float32
+        3 dict #f-> values
+        3 x #@B-> y values"""
+    )
+    with pytest.raises(ValueError, match="lookup beyond"):
+        vm.run({"dict": dictionary, "x": index})
+    assert (
+        vm.run({"dict": dictionary, "x": index}, raise_lookup_beyond=False)
+        == "lookup beyond"
+    )
+    assert ak.to_list(vm["y"]) == []
+
+
+def test_decompiled():
+    source = """input x
+output y int32
+output z int32
+
+10
+x #+i-> y
+10
+x #!%I-> z
+10
+x #@varint-> y z
+"""
+    assert awkward.forth.ForthMachine32(source).decompiled == source
+
+
+@pytest.mark.parametrize(
+    "source",
+    [
+        "input x output y float32 3 x #+f-> y",
+        "input x output y int32 3 x #%b-> y",
+        "input x output y int32 3 x #@zigzag-> y y",
+        "input x output y int32 3 x #+i-> stack",
+        "input x output y int32 3 x #@i-> y",
+        "input x output y int32 output z float32 3 x #@i-> y z",
+        "input x output y int32 x +i-> y",
+    ],
+)
+def test_errors(source):
+    with pytest.raises(ValueError):
+        awkward.forth.ForthMachine32(source)
+
+
+def test_threaded():
+    data = np.arange(40, dtype=np.int32)
+    source = "input x output y int64 0 y <- stack 4 0 do 10 x #+i-> y loop"
+    results = []
+    for threaded in [False, True]:
+        vm = awkward.forth.ForthMachine32(source, threaded=threaded)
+        vm.run({"x": data})
+        results.append(ak.to_list(vm["y"]))
+    assert results[0] == results[1] == [0] + np.cumsum(data).tolist()
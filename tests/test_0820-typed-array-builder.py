@@ -0,0 +1,188 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+form = ak.forms.Form.fromjson(
+    """{
+    "class": "ListOffsetArray64",
+    "offsets": "i64",
+    "content": {
+        "class": "RecordArray",
+        "contents": {
+            "x": "float64",
+            "y": {
+                "class": "ListOffsetArray64",
+                "offsets": "i64",
+                "content": {
+                    "class": "IndexedOptionArray64",
+                    "index": "i64",
+                    "content": "int64"
+                }
+            }
+        }
+    }
+}"""
+)
+
+
+def fill(builder):
+    for i in range(3):
+        builder.beginlist()
+        for j in range(i):
+            builder.beginrecord()
+            builder.field(0)
+            builder.real(j + 0.5)
+            builder.field(1)
+            builder.beginlist()
+            for k in range(j + 1):
+                if k == 1:
+                    builder.null()
+                else:
+                    builder.integer(k)
+            builder.endlist()
+            builder.endrecord()
+        builder.endlist()
+
+
+expected = [
+    [],
+    [{"x": 0.5, "y": [0]}],
+    [{"x": 0.5, "y": [0]}, {"x": 1.5, "y": [0, None]}],
+]
+
+
+def test_fill():
+    builder = ak.layout.TypedArrayBuilder(form, initial=2)
+    fill(builder)
+    assert len(builder) == 3
+    assert ak.to_list(builder.snapshot()) == expected
+    assert builder.snapshot().form == form
+
+    builder.clear()
+    assert len(builder) == 0
+    assert ak.to_list(builder.snapshot()) == []
+
+
+def test_field_by_name():
+    builder = ak.layout.TypedArrayBuilder(form)
+    builder.beginlist()
+    builder.beginrecord()
+    builder.field("y")
+    builder.beginlist()
+    builder.endlist()
+    builder.field("x")
+    builder.real(1.1)
+    builder.endrecord()
+    builder.endlist()
+    assert ak.to_list(builder.snapshot()) == [[{"x": 1.1, "y": []}]]
+
+
+def test_regular_strings_and_tuples():
+    tupleform = ak.forms.Form.fromjson(
+        """{
+        "class": "RecordArray",
+        "contents": [
+            {"class": "RegularArray", "size": 2, "content": "int32"},
+            {
+                "class": "ListOffsetArray64",
+                "offsets": "i64",
+                "content": {"class": "NumpyArray", "primitive": "uint8",
+                            "parameters": {"__array__": "char"}},
+                "parameters": {"__array__": "string"}
+            }
+        ]
+    }"""
+    )
+    builder = ak.layout.TypedArrayBuilder(tupleform)
+    for i, word in enumerate(["one", "two"]):
+        builder.begintuple(2)
+        builder.index(0)
+        builder.beginlist()
+        builder.integer(i)
+        builder.integer(i + 1)
+        builder.endlist()
+        builder.index(1)
+        builder.string(word)
+        builder.endtuple()
+    assert ak.to_list(builder.snapshot()) == [([0, 1], "one"), ([1, 2], "two")]
+
+
+def test_errors():
+    builder = ak.layout.TypedArrayBuilder(form)
+    with pytest.raises(ValueError):
+        builder.integer(1)
+    builder.beginlist()
+    with pytest.raises(ValueError):
+        builder.beginlist()
+    builder.beginrecord()
+    with pytest.raises(ValueError):
+        builder.real(1.1)
+    with pytest.raises(ValueError):
+        builder.field(2)
+    builder.field(0)
+    builder.real(1.1)
+    with pytest.raises(ValueError):
+        builder.real(2.2)
+    with pytest.raises(ValueError):
+        builder.endrecord()
+    builder.field(1)
+    builder.beginlist()
+    builder.endlist()
+    builder.endrecord()
+    builder.endlist()
+    assert ak.to_list(builder.snapshot()) == [[{"x": 1.1, "y": []}]]
+
+    with pytest.raises(ValueError):
+        ak.layout.TypedArrayBuilder(ak.forms.Form.fromjson('"complex128"'))
+
+
+def test_rejected_command_leaves_builder_unchanged():
+    builder = ak.layout.TypedArrayBuilder(form)
+    builder.beginlist()
+    builder.beginrecord()
+    builder.field(0)
+    builder.real(1.1)
+    builder.field(1)
+    builder.beginlist()
+    with pytest.raises(ValueError):
+        builder.string("not an int64")
+    with pytest.raises(ValueError):
+        builder.real(2.2)
+    builder.integer(1)
+    builder.null()
+    builder.endlist()
+    builder.endrecord()
+    builder.endlist()
+    assert ak.to_list(builder.snapshot()) == [[{"x": 1.1, "y": [1, None]}]]
+
+
+def test_numba():
+    numba = pytest.importorskip("numba")
+
+    @numba.njit
+    def fill_numba(builder):
+        for i in range(3):
+            builder.beginlist()
+            for j in range(i):
+                builder.beginrecord()
+                builder.field(0)
+                builder.real(j + 0.5)
+                builder.field(1)
+                builder.beginlist()
+                for k in range(j + 1):
+                    if k == 1:
+                        builder.null()
+                    else:
+                        builder.integer(k)
+                builder.endlist()
+                builder.endrecord()
+            builder.endlist()
+        return len(builder)
+
+    builder = ak.layout.TypedArrayBuilder(form)
+    assert fill_numba(builder) == 3
+    assert ak.to_list(builder.snapshot()) == expected
@@ -0,0 +1,132 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import threading
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def array(n):
+    return ak.layout.NumpyArray(np.arange(n, dtype=np.int64))
+
+
+def test_budget():
+    cache = ak.layout.LRUArrayCache(1000, num_stripes=1)
+    cache["a"] = array(50)
+    cache["b"] = array(50)
+    assert len(cache) == 2
+    assert cache.nbytes == 800
+
+    assert ak.to_list(cache["a"]) == list(range(50))
+    cache["c"] = array(50)
+    assert "a" in cache
+    assert "b" not in cache
+    assert "c" in cache
+    assert cache.nbytes == 800
+    assert (cache.hits, cache.misses, cache.evictions) == (1, 0, 1)
+
+    with pytest.raises(KeyError):
+        cache["b"]
+    assert cache.misses == 1
+
+    cache["big"] = array(200)
+    assert "big" not in cache
+
+    del cache["a"]
+    assert len(cache) == 1
+    with pytest.raises(KeyError):
+        del cache["a"]
+
+    cache.clear()
+    assert len(cache) == 0
+    assert cache.nbytes == 0
+
+
+def test_pin():
+    cache = ak.layout.LRUArrayCache(1000, num_stripes=1)
+    cache.pin("a")
+    cache["a"] = array(50)
+    cache["b"] = array(50)
+    cache["c"] = array(50)
+    cache["d"] = array(50)
+    assert "a" in cache
+    assert "d" in cache
+    assert len(cache) == 2
+
+    cache.unpin("a")
+    with pytest.raises(ValueError):
+        cache.unpin("a")
+
+    cache.pin("d")
+    cache.pin("e")
+    cache["e"] = array(100)
+    assert cache.nbytes == 1200
+    cache.unpin("d")
+    assert "d" not in cache
+    assert cache.nbytes == 800
+
+
+def test_virtual():
+    calls = []
+
+    def generate():
+        calls.append(None)
+        return ak.Array([1, 2, 3])
+
+    cache = ak.layout.LRUArrayCache(1 << 20)
+    virtual = ak.virtual(generate, length=3, form="int64", cache=cache)
+    assert ak.to_list(virtual) == [1, 2, 3]
+    assert ak.to_list(virtual) == [1, 2, 3]
+    assert len(calls) == 1
+    assert len(cache) == 1
+    assert virtual.layout.cache is cache
+    assert cache.hits >= 1
+
+
+def test_virtual_pins():
+    cache = ak.layout.LRUArrayCache(1 << 20)
+    pinned = []
+
+    def generate():
+        # the key is pinned while its array is being generated
+        try:
+            cache.unpin("x")
+        except ValueError:
+            pinned.append(False)
+        else:
+            pinned.append(True)
+            cache.pin("x")
+        return ak.Array([1, 2, 3])
+
+    virtual = ak.virtual(generate, length=3, form="int64", cache=cache, cache_key="x")
+    assert ak.to_list(virtual) == [1, 2, 3]
+    assert pinned == [True]
+    with pytest.raises(ValueError):
+        cache.unpin("x")
+
+
+def test_threads():
+    cache = ak.layout.LRUArrayCache(100000, num_stripes=8)
+
+    def work(t):
+        for i in range(2000):
+            key = str((i * 7 + t) % 300)
+            if key not in cache:
+                cache[key] = array(10 + i % 50)
+            try:
+                cache[key]
+            except KeyError:
+                pass
+
+    threads = [threading.Thread(target=work, args=(t,)) for t in range(4)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    assert cache.nbytes <= 100000
+    keys = [str(i) for i in range(300) if str(i) in cache]
+    assert cache.nbytes == sum(cache[key].nbytes for key in keys)
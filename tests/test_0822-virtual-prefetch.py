@@ -0,0 +1,87 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import threading
+import time
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_prefetch():
+    calls = []
+    lock = threading.Lock()
+
+    def generate(i):
+        time.sleep(0.05)
+        with lock:
+            calls.append(i)
+        return ak.Array([i, i, i])
+
+    cache = ak.layout.LRUArrayCache(1 << 20)
+    contents = [
+        ak.virtual(generate, args=(i,), length=3, form="int64", cache=cache).layout
+        for i in range(4)
+    ]
+    array = ak.Array(ak.layout.RecordArray(contents, ["0", "1", "2", "3"]))
+    ak.prefetch(array)
+    ak.prefetch(array)
+    assert ak.to_list(array["2"]) == [2, 2, 2]
+    assert ak.to_list(array) == [{"0": 0, "1": 1, "2": 2, "3": 3}] * 3
+    assert sorted(calls) == [0, 1, 2, 3]
+    assert len(cache) == 4
+
+
+def test_errors():
+    calls = []
+
+    def generate():
+        calls.append(None)
+        raise ZeroDivisionError("oops")
+
+    cache = ak.layout.LRUArrayCache(1 << 20)
+    virtual = ak.virtual(generate, length=3, form="int64", cache=cache)
+    ak.prefetch(virtual)
+    # an access generates a failed prefetch again, which raises its error
+    with pytest.raises(ZeroDivisionError):
+        virtual.layout.array
+    assert len(calls) == 2
+    with pytest.raises(ZeroDivisionError):
+        virtual.layout.array
+    assert len(calls) == 3
+
+    # a failed prefetch leaves nothing behind, so it can be started again
+    ak.prefetch(virtual)
+    with pytest.raises(ZeroDivisionError):
+        virtual.layout.array
+    assert len(calls) == 5
+    ak.prefetch(virtual)
+    for _ in range(100):
+        if len(calls) == 6:
+            break
+        time.sleep(0.01)
+    assert len(calls) == 6
+
+
+def test_without_cache():
+    calls = []
+
+    def generate():
+        calls.append(None)
+        return ak.Array([1, 2, 3])
+
+    virtual = ak.virtual(generate, length=3, form="int64", cache=None)
+    ak.prefetch(virtual)
+    assert calls == []
+    assert ak.to_list(virtual) == [1, 2, 3]
+
+
+def test_num_background_threads():
+    original = ak.config.num_background_threads()
+    try:
+        ak.config.set_num_background_threads(2)
+        assert ak.config.num_background_threads() == 2
+    finally:
+        ak.config.set_num_background_threads(original)
@@ -0,0 +1,87 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+class Columns(object):
+    def __init__(self, requests, start=0, stop=100000, fields=("x", "y")):
+        self.requests = requests
+        self.start = start
+        self.stop = stop
+        self.fields = fields
+
+    def __call__(self):
+        self.requests.append((self.start, self.stop, self.fields))
+        index = np.arange(self.start, self.stop, dtype=np.int64)
+        columns = {"x": index, "y": index * 10}
+        if len(self.fields) == 1 and not isinstance(self.fields, list):
+            return columns[self.fields[0]]
+        else:
+            return ak.zip({x: columns[x] for x in self.fields})
+
+    def getitem_range(self, start, stop):
+        return Columns(
+            self.requests, self.start + start, self.start + stop, self.fields
+        )
+
+    def getitem_field(self, key):
+        return Columns(self.requests, self.start, self.stop, (key,))
+
+    def getitem_fields(self, keys):
+        return Columns(self.requests, self.start, self.stop, list(keys))
+
+
+form = ak.forms.Form.fromjson(
+    '{"class": "RecordArray", "contents": {"x": "int64", "y": "int64"}}'
+)
+
+
+def test_range_then_field():
+    requests = []
+    array = ak.virtual(Columns(requests), length=100000, form=form, cache=None)
+    assert ak.to_list(array[1000:1003]["y"]) == [10000, 10010, 10020]
+    assert requests == [(1000, 1003, ("y",))]
+
+
+def test_field_then_range():
+    requests = []
+    array = ak.virtual(Columns(requests), length=100000, form=form, cache=None)
+    assert ak.to_list(array["x"][-3:]) == [99997, 99998, 99999]
+    assert requests == [(99997, 100000, ("x",))]
+
+
+def test_chained_ranges():
+    requests = []
+    array = ak.virtual(Columns(requests), length=100000, form=form, cache=None)
+    sliced = array[1000:2000][10:20][["x"]][5:7]
+    assert ak.to_list(sliced) == [{"x": 1015}, {"x": 1016}]
+    assert requests == [(1015, 1017, ["x"])]
+
+
+def test_unsupported():
+    requests = []
+
+    def generate():
+        requests.append(None)
+        return ak.zip({"x": np.arange(10), "y": np.arange(10) * 10})
+
+    array = ak.virtual(generate, length=10, cache=None)
+    assert ak.to_list(array[2:4]["y"]) == [20, 30]
+    assert len(requests) == 1
+
+
+def test_parent_generated_first():
+    requests = []
+    array = ak.virtual(Columns(requests), length=100000, form=form, cache={})
+    sliced = array[1000:1003]["y"]
+    fields = array[["x"]]
+    array.layout.array
+    assert requests == [(0, 100000, ("x", "y"))]
+    # the slices are taken from the cached parent, not generated again
+    assert ak.to_list(sliced) == [10000, 10010, 10020]
+    assert ak.to_list(fields[:2]) == [{"x": 0}, {"x": 1}]
+    assert requests == [(0, 100000, ("x", "y"))]
@@ -0,0 +1,105 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import locale
+import os
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_string():
+    array = ak.from_json(
+        '{"x": 1, "y": [1.1]}\n{"x": 2, "y": []}\n\n{"x": 3, "y": [3.3, 4]}\n',
+        lines=True,
+    )
+    assert ak.to_list(array) == [
+        {"x": 1, "y": [1.1]},
+        {"x": 2, "y": []},
+        {"x": 3, "y": [3.3, 4.0]},
+    ]
+
+    assert ak.to_list(ak.from_json("[1, 2, 3]", lines=True)) == [[1, 2, 3]]
+    assert ak.to_list(ak.from_json("[1, 2, 3]")) == [1, 2, 3]
+    assert ak.to_list(ak.from_json("1 2 3")) == [1, 2, 3]
+
+    with pytest.raises(ValueError):
+        ak.from_json("[1, 2] [3]", lines=True)
+    with pytest.raises(ValueError):
+        ak.from_json('{"x": 1', lines=True)
+
+
+def test_escapes_and_numbers():
+    array = ak.from_json('"a\\"b"\n"\\u00e9\\n"\n"\\ud83d\\ude00"\n', lines=True)
+    assert ak.to_list(array) == ['a"b', u"é\n", u"\U0001F600"]
+
+    array = ak.from_json("[0, -1, 1e3, -2.5E-1]")
+    assert ak.to_list(array) == [0, -1, 1000.0, -0.25]
+    array = ak.from_json("[-9223372036854775808, 9223372036854775807]")
+    assert ak.to_list(array) == [-9223372036854775808, 9223372036854775807]
+
+    with pytest.raises(ValueError):
+        ak.from_json("[01]")
+    with pytest.raises(ValueError):
+        ak.from_json("[1.]")
+
+
+def test_slow_path_numbers():
+    source = "[1.5e-30, 1234567890.123456789012345, 2.5e300]"
+    expected = [1.5e-30, 1234567890.123456789012345, 2.5e300]
+    assert ak.to_list(ak.from_json(source)) == expected
+
+    old = locale.setlocale(locale.LC_NUMERIC)
+    for name in ["de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"]:
+        try:
+            locale.setlocale(locale.LC_NUMERIC, name)
+        except locale.Error:
+            continue
+        try:
+            # the decimal separator of this locale is ','
+            assert ak.to_list(ak.from_json(source)) == expected
+        finally:
+            locale.setlocale(locale.LC_NUMERIC, old)
+        break
+
+
+def test_control_characters_and_newlines():
+    assert ak.to_list(ak.from_json('["a\\tb"]')) == ["a\tb"]
+    with pytest.raises(ValueError):
+        ak.from_json('["a\tb"]')
+    with pytest.raises(ValueError):
+        ak.from_json('"abcdefghij\x01klmnop"\n', lines=True)
+
+    assert ak.to_list(ak.from_json("[1, 2]\n[3]", lines=True)) == [[1, 2], [3]]
+    assert ak.to_list(ak.from_json("[1,\n 2]\n[3]")) == [[1, 2], [3]]
+    with pytest.raises(ValueError):
+        ak.from_json("[1,\n 2]\n[3]\n", lines=True)
+
+
+def test_file(tmp_path):
+    filename = os.path.join(str(tmp_path), "tmp1.jsonl")
+    with open(filename, "w") as f:
+        for i in range(1000):
+            f.write('{"i": %d, "s": "%s"}\n' % (i, "x" * (i % 7)))
+
+    array = ak.from_json(filename, lines=True, buffersize=100)
+    assert len(array) == 1000
+    assert ak.to_list(array["i"]) == list(range(1000))
+    assert ak.to_list(array["s"][:8]) == [
+        "",
+        "x",
+        "xx",
+        "xxx",
+        "xxxx",
+        "xxxxx",
+        "xxxxxx",
+        "",
+    ]
+
+    filename = os.path.join(str(tmp_path), "tmp2.jsonl")
+    with open(filename, "w") as f:
+        f.write('{"i": 0}\n')
+    assert ak.to_list(ak.from_json(filename, lines=True)) == [{"i": 0}]
+    assert ak.to_list(ak.from_json(filename)) == {"i": 0}
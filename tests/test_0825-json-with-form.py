@@ -0,0 +1,79 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import json
+import os
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+form = {
+    "class": "RecordArray",
+    "contents": {
+        "x": {"class": "IndexedOptionArray64", "content": "int64"},
+        "y": {"class": "ListOffsetArray64", "content": "float64"},
+        "s": {
+            "class": "ListOffsetArray64",
+            "content": {
+                "class": "NumpyArray",
+                "primitive": "uint8",
+                "parameters": {"__array__": "char"},
+            },
+            "parameters": {"__array__": "string"},
+        },
+    },
+}
+
+
+def test_string():
+    array = ak.from_json(
+        '[{"y": [1, 2.5], "x": 1, "s": "hi"}, {"s": "", "x": null, "y": []}]',
+        form=form,
+    )
+    assert ak.to_list(array) == [
+        {"x": 1, "y": [1.0, 2.5], "s": "hi"},
+        {"x": None, "y": [], "s": ""},
+    ]
+    assert (
+        str(ak.type(array)) == '2 * {"x": ?int64, "y": var * float64, "s": string}'
+    )
+
+    array = ak.from_json("[1, 2, 3]", form='"float64"')
+    assert ak.to_list(array) == [1.0, 2.0, 3.0]
+    assert str(ak.type(array)) == "3 * float64"
+
+    assert len(ak.from_json("", form='"int64"')) == 0
+
+
+def test_lines(tmp_path):
+    filename = os.path.join(str(tmp_path), "tmp1.jsonl")
+    with open(filename, "w") as f:
+        for i in range(1000):
+            f.write('{"x": %d, "y": [%d.5], "s": "%s"}\n' % (i, i, "x" * (i % 3)))
+
+    array = ak.from_json(
+        filename, lines=True, form=ak.forms.Form.fromjson(json.dumps(form))
+    )
+    assert len(array) == 1000
+    assert ak.to_list(array[998:]) == [
+        {"x": 998, "y": [998.5], "s": "xx"},
+        {"x": 999, "y": [999.5], "s": ""},
+    ]
+
+
+def test_errors():
+    with pytest.raises(ValueError):
+        ak.from_json("[1, 2.5, 3]", form='"int64"')
+    with pytest.raises(ValueError):
+        ak.from_json('[{"x": 1, "y": []}]', form=form)
+    with pytest.raises(ValueError):
+        ak.from_json('[{"x": 1, "y": [], "s": "", "z": 1}]', form=form)
+    with pytest.raises(ValueError):
+        ak.from_json("[1, 2] [3]", form='"int64"')
+    with pytest.raises(ValueError):
+        ak.from_json("1\n2\n3", form='"int64"')
+    array = ak.from_json("1\n2\n3", lines=True, form='"int64"')
+    assert ak.to_list(array) == [1, 2, 3]
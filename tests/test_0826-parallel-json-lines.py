@@ -0,0 +1,56 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import os
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+form = '{"class": "RecordArray", "contents": {"x": "int64", "y": "float64"}}'
+
+# more than one chunk (each at least 4 MiB)
+source = "".join('{"x": %d, "y": %d.5}\n' % (i, i) for i in range(500000))
+
+
+def test_string():
+    expected = ak.from_json(source, lines=True)
+    assert len(expected) == 500000
+
+    array = ak.from_json(source, lines=True, num_threads=4)
+    assert isinstance(array.layout, ak.layout.Content)
+    assert ak.to_list(array[::49999]) == ak.to_list(expected[::49999])
+
+    array = ak.from_json(source, lines=True, num_threads=4, form=form)
+    assert isinstance(array.layout, ak.partition.PartitionedArray)
+    assert array.layout.numpartitions > 1
+    assert len(array) == 500000
+    assert ak.to_list(array[::49999]) == ak.to_list(expected[::49999])
+    assert ak.to_list(array[-1]) == {"x": 499999, "y": 499999.5}
+
+    assert ak.to_list(ak.from_json("1\n2\n3", lines=True, num_threads=0)) == [1, 2, 3]
+    assert len(ak.from_json("", lines=True, num_threads=2, form='"int64"')) == 0
+
+
+def test_file(tmp_path):
+    filename = os.path.join(str(tmp_path), "tmp1.jsonl")
+    with open(filename, "w") as f:
+        f.write(source)
+
+    array = ak.from_json(filename, lines=True, num_threads=3, form=form)
+    assert len(array) == 500000
+    assert ak.to_list(array[123456]) == {"x": 123456, "y": 123456.5}
+    assert ak.to_list(array["x"][-3:]) == [499997, 499998, 499999]
+
+
+def test_errors():
+    with pytest.raises(ValueError):
+        ak.from_json("[1, 2, 3]", num_threads=2)
+    with pytest.raises(ValueError):
+        ak.from_json(source + "[1, 2] [3]\n", lines=True, num_threads=2)
+    with pytest.raises(ValueError):
+        ak.from_json(
+            source + '{"x": 1.5, "y": 2}\n', lines=True, num_threads=2, form=form
+        )
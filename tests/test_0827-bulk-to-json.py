@@ -0,0 +1,39 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import json
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_integers():
+    for dtype in (np.int64, np.int32, np.uint8):
+        array = np.arange(10000).astype(dtype)
+        assert json.loads(ak.to_json(array)) == array.tolist()
+        assert json.loads(ak.to_json(array[::3])) == array[::3].tolist()
+
+    array = np.array([-(2 ** 63), 2 ** 63 - 1, 0, -1], np.int64)
+    assert json.loads(ak.to_json(array)) == array.tolist()
+
+
+def test_reals():
+    array = np.random.normal(size=10000) * 1e10
+    assert json.loads(ak.to_json(array)) == array.tolist()
+    assert json.loads(ak.to_json(array[::-1])) == array[::-1].tolist()
+    assert ak.to_json(np.array([1.5, 2, 0.1])) == "[1.5,2.0,0.1]"
+    assert ak.to_json(np.array([1.25, 2.5], np.float32)) == "[1.25,2.5]"
+    assert ak.to_json(np.array([1.123456, 2.5]), maxdecimals=2) == "[1.12,2.5]"
+
+    array = ak.Array([[1.5, np.nan, 2.5], [np.inf, -np.inf]])
+    assert (
+        ak.to_json(
+            array,
+            nan_string="NaN",
+            infinity_string="inf",
+            minus_infinity_string="-inf",
+        )
+        == '[[1.5,"NaN",2.5],["inf","-inf"]]'
+    )
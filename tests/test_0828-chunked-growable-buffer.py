@@ -0,0 +1,34 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_snapshots_while_growing():
+    # 3 million int64 values pass the size at which buffers grow in chunks
+    builder = ak.layout.ArrayBuilder()
+    for i in range(3000000):
+        builder.integer(i)
+        if i == 1000000:
+            early = builder.snapshot()
+    late = builder.snapshot()
+    for i in range(3000000, 3000010):
+        builder.integer(i)
+
+    assert np.asarray(early).tolist() == list(range(1000001))
+    assert np.asarray(late).tolist() == list(range(3000000))
+    assert np.asarray(builder.snapshot()).tolist() == list(range(3000010))
+
+
+def test_lists_and_strings():
+    data = [[i, i + 1] for i in range(0, 5000000, 2)]
+    assert ak.to_list(ak.from_iter(data)) == data
+
+    strings = ["x" * (i % 100) for i in range(500000)]
+    form = """{"class": "ListOffsetArray64", "offsets": "i64", "content": "uint8",
+               "parameters": {"__array__": "string"}}"""
+    source = "\n".join('"{0}"'.format(x) for x in strings)
+    assert ak.from_json(source, lines=True, form=form).tolist() == strings
@@ -0,0 +1,40 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_names():
+    assert set(["malloc", "arena", "hugepage"]).issubset(ak.config.allocator_names())
+    assert ak.config.allocator() is None
+    with pytest.raises(ValueError):
+        ak.config.set_allocator("no-such-allocator")
+    assert ak.config.allocator() is None
+
+
+@pytest.mark.parametrize("name", ["malloc", "arena", "hugepage"])
+def test_slicing_chain(name):
+    array = ak.Array([[1.1, 2.2, 3.3], [], [4.4, 5.5], [6.6]] * 100000)
+    expected = ak.to_list(ak.sum(array[array > 2][1:-1], axis=1))
+
+    ak.config.allocator_stats(name, reset=True)
+    ak.config.set_allocator(name)
+    try:
+        assert ak.config.allocator() == name
+        result = ak.sum(array[array > 2][1:-1], axis=1)
+    finally:
+        ak.config.set_allocator(None)
+
+    assert ak.to_list(result) == expected
+    stats = ak.config.allocator_stats(name)
+    assert stats["num_allocations"] > 0
+    assert stats["bytes_in_use"] > 0
+    assert stats["peak_bytes_in_use"] >= stats["bytes_in_use"]
+
+    del result
+    stats = ak.config.allocator_stats(name)
+    assert stats["num_allocations"] == stats["num_deallocations"]
+    assert stats["bytes_in_use"] == 0
@@ -0,0 +1,81 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def pairs():
+    np.random.seed(830)
+    for length in (0, 5, 64, 200, 1000):
+        for lsb_order in (False, True):
+            for valid_when in (False, True):
+                bits = np.random.randint(0, 256, length // 8 + 1).astype(np.uint8)
+                if length == 200:
+                    # whole 64-bit words of missing and of valid values
+                    bits[:8] = 0
+                    bits[8:16] = 255
+                mask = ak.layout.IndexU8(bits)
+                content = ak.layout.NumpyArray(np.arange(length, dtype=np.int64))
+                bitmasked = ak.layout.BitMaskedArray(
+                    mask, content, valid_when, length, lsb_order
+                )
+                yield bitmasked, bitmasked.toByteMaskedArray()
+
+
+def test_slicing():
+    for bitmasked, bytemasked in pairs():
+        for start, stop in [(0, None), (3, -2), (8, None), (13, 150)]:
+            sliced = bitmasked[start:stop]
+            assert isinstance(sliced, ak.layout.BitMaskedArray)
+            assert ak.to_list(sliced) == ak.to_list(bytemasked[start:stop])
+
+        if len(bitmasked) > 0:
+            carry = np.random.randint(0, len(bitmasked), 100)
+            assert ak.to_list(bitmasked[carry]) == ak.to_list(bytemasked[carry])
+
+        assert ak.to_list(bitmasked.project()) == ak.to_list(bytemasked.project())
+
+
+def test_reducing():
+    for bitmasked, bytemasked in pairs():
+        offsets = ak.layout.Index64(
+            np.append(np.arange(0, len(bitmasked), 7), len(bitmasked))
+        )
+        lists1 = ak.Array(ak.layout.ListOffsetArray64(offsets, bitmasked))
+        lists2 = ak.Array(ak.layout.ListOffsetArray64(offsets, bytemasked))
+        for axis in (0, 1):
+            assert ak.to_list(ak.sum(lists1, axis=axis)) == ak.to_list(
+                ak.sum(lists2, axis=axis)
+            )
+            assert ak.to_list(ak.max(lists1, axis=axis)) == ak.to_list(
+                ak.max(lists2, axis=axis)
+            )
+            assert ak.to_list(ak.argmax(lists1, axis=axis)) == ak.to_list(
+                ak.argmax(lists2, axis=axis)
+            )
+        assert ak.to_list(lists1[:, 1:]) == ak.to_list(lists2[:, 1:])
+        assert ak.count(lists1, axis=None) == ak.count(lists2, axis=None)
+
+
+def test_nested_masks():
+    content = ak.layout.NumpyArray(np.arange(10, dtype=np.int64))
+    inner = ak.layout.BitMaskedArray(
+        ak.layout.IndexU8(np.array([0b10110111, 0b11], np.uint8)),
+        content,
+        True,
+        10,
+        True,
+    )
+    outer = ak.layout.BitMaskedArray(
+        ak.layout.IndexU8(np.array([0b00001000, 0b10], np.uint8)),
+        inner,
+        False,
+        10,
+        True,
+    )
+    simplified = outer.simplify()
+    assert isinstance(simplified, ak.layout.BitMaskedArray)
+    assert ak.to_list(simplified) == [0, 1, 2, None, 4, 5, None, 7, 8, None]
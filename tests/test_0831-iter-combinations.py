@@ -0,0 +1,91 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def chunked(array, n, chunksize, **kwargs):
+    parents, chunks = [], []
+    for p, chunk in ak.iter_combinations(array, n, chunksize=chunksize, **kwargs):
+        assert 0 < len(chunk) <= chunksize
+        assert len(p) == len(chunk)
+        parents.extend(p.tolist())
+        chunks.extend(ak.to_list(chunk))
+    return parents, chunks
+
+
+def expected(array, n, **kwargs):
+    full = ak.combinations(array, n, **kwargs)
+    parents = np.repeat(np.arange(len(full)), ak.num(full)).tolist()
+    return parents, ak.to_list(ak.flatten(full))
+
+
+def test_same_as_combinations():
+    array = ak.Array([[1, 2, 3, 4], [], [5], [6, 7, 8], [9, 10, 11, 12, 13]])
+    for n in (1, 2, 3, 4):
+        for replacement in (False, True):
+            for chunksize in (1, 2, 5, 100):
+                assert chunked(
+                    array, n, chunksize, replacement=replacement
+                ) == expected(array, n, replacement=replacement)
+
+
+def test_layouts():
+    content = ak.layout.NumpyArray(np.arange(10) * 1.1)
+    starts = ak.layout.Index64(np.array([5, 0, 3, 3], np.int64))
+    stops = ak.layout.Index64(np.array([9, 3, 3, 6], np.int64))
+    listarray = ak.layout.ListArray64(starts, stops, content)
+    regulararray = ak.layout.RegularArray(content, 5)
+    for layout in (listarray, regulararray):
+        assert chunked(layout, 2, 3) == expected(layout, 2)
+
+
+def test_records():
+    array = ak.Array([[1, 2, 3], [4, 5]])
+    parents, chunks = chunked(array, 2, 2, fields=["x", "y"], with_name="pair")
+    assert parents == [0, 0, 0, 1]
+    assert chunks == [
+        {"x": 1, "y": 2},
+        {"x": 1, "y": 3},
+        {"x": 2, "y": 3},
+        {"x": 4, "y": 5},
+    ]
+    first = next(ak.iter_combinations(array, 2, fields=["x", "y"], with_name="pair"))
+    assert ak.parameters(first[1])["__record__"] == "pair"
+
+
+def test_partitioned():
+    array = ak.partitioned(
+        [ak.Array([[1, 2, 3], []]), ak.Array([[4, 5], [6, 7, 8]])], highlevel=False
+    )
+    assert chunked(array, 2, 3) == (
+        [0, 0, 0, 2, 3, 3, 3],
+        [(1, 2), (1, 3), (2, 3), (4, 5), (6, 7), (6, 8), (7, 8)],
+    )
+
+
+def test_iterator():
+    array = ak.Array([[1, 2, 3, 4], [], [5, 6]]).layout
+    iterator = ak.layout.CombinationsIterator(array, 2, chunksize=4)
+    assert len(iterator) == 7
+    assert np.asarray(iterator.offsets).tolist() == [0, 6, 6, 7]
+    parents, chunk = next(iterator)
+    assert np.asarray(parents).tolist() == [0, 0, 0, 0]
+    assert iterator.at == 4
+    parents, chunk = next(iterator)
+    assert np.asarray(parents).tolist() == [0, 0, 2]
+    assert ak.to_list(chunk) == [(2, 4), (3, 4), (5, 6)]
+    with pytest.raises(StopIteration):
+        next(iterator)
+
+
+def test_errors():
+    with pytest.raises(ValueError):
+        next(ak.iter_combinations(ak.Array([1, 2, 3]), 2))
+    with pytest.raises(ValueError):
+        next(ak.iter_combinations(ak.Array([[1, 2, 3]]), 0))
+    with pytest.raises(ValueError):
+        next(ak.iter_combinations(ak.Array([[1, 2, 3]]), 2, chunksize=0))
@@ -0,0 +1,120 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def add(inputs, depth):
+    if all(
+        isinstance(x, ak.layout.NumpyArray) or not isinstance(x, ak.layout.Content)
+        for x in inputs
+    ):
+        return (ak.layout.NumpyArray(np.asarray(inputs[0]) + np.asarray(inputs[1])),)
+    else:
+        return None
+
+
+def ext_add(left, right, **kwargs):
+    (out,) = ak._ext.broadcast_and_apply([left, right], add, **kwargs)
+    return ak.to_list(out)
+
+
+def test_jagged():
+    one = ak.Array([[1, 2, 3], [], [4, 5]]).layout
+    two = ak.Array([100, 200, 300]).layout
+    assert ext_add(one, two) == [[101, 102, 103], [], [304, 305]]
+    assert ext_add(one, one) == [[2, 4, 6], [], [8, 10]]
+    assert ext_add(one, 10) == [[11, 12, 13], [], [14, 15]]
+
+    content = ak.layout.NumpyArray(np.arange(10))
+    starts = ak.layout.Index64(np.array([6, 0, 3], np.int64))
+    stops = ak.layout.Index64(np.array([9, 0, 5], np.int64))
+    listarray = ak.layout.ListArray64(starts, stops, content)
+    assert ext_add(listarray, one) == [[7, 9, 11], [], [7, 9]]
+
+    with pytest.raises(ValueError):
+        ext_add(one, ak.Array([[1, 2], [], [3, 4]]).layout)
+    with pytest.raises(ValueError):
+        ext_add(one, ak.Array([1, 2]).layout)
+
+
+def test_option_union_indexed():
+    one = ak.Array([[1, None, 3], None, [4, 5]]).layout
+    two = ak.Array([1, 2, None]).layout
+    assert ext_add(one, two) == [[2, None, 4], None, None]
+
+    union = ak.Array([1, [2, 3], 4]).layout
+    assert ext_add(union, 10) == [11, [12, 13], 14]
+
+    index = ak.layout.Index64(np.array([2, 2, 0], np.int64))
+    indexed = ak.layout.IndexedArray64(index, ak.Array([1, 2, 3]).layout)
+    assert ext_add(indexed, two) == [4, 5, None]
+
+
+def test_records():
+    records = ak.Array([{"x": 1, "y": [1, 2]}, {"x": 2, "y": []}]).layout
+    assert ext_add(records, 10) == [{"x": 11, "y": [11, 12]}, {"x": 12, "y": []}]
+    with pytest.raises(ValueError):
+        ext_add(records, 10, allow_records=False)
+
+
+def test_regular():
+    one = ak.layout.RegularArray(ak.layout.NumpyArray(np.arange(6)), 3)
+    two = ak.layout.NumpyArray(np.array([100, 200, 300]))
+    assert ext_add(one, two) == [[100, 201, 302], [103, 204, 305]]
+    with pytest.raises(ValueError):
+        ext_add(one, two, right_broadcast=False)
+
+
+def test_leaves_only():
+    depths = []
+
+    def function(inputs, depth):
+        depths.append(depth)
+        return add(inputs, depth)
+
+    one = ak.Array([[[1, 2], []], [[3]]]).layout
+    ak._ext.broadcast_and_apply([one, 1], function)
+    assert depths == [0, 1, 2]
+    del depths[:]
+    ak._ext.broadcast_and_apply([one, 1], function, leaves_only=True)
+    assert depths == [2]
+
+
+def test_same_as_ufuncs():
+    array = ak.Array([[1.5, None, 3.5], [], None, [[4], 5.5]])
+    assert ak.to_list(array + 1) == [[2.5, None, 4.5], [], None, [[5], 6.5]]
+    nested = ak.Array([[[1, 2], []], [[3]]])
+    assert ak.to_list(nested * ak.Array([10, 100])) == [[[10, 20], []], [[300]]]
+    assert ak.to_list(np.sqrt(ak.Array([[4, 9], [16]]))) == [[2, 3], [4]]
+    strings = ak.Array(["one", "two"])
+    assert ak.to_list(strings == "one") == [True, False]
+
+
+def test_ufuncs_take_cpp_path(monkeypatch):
+    calls = []
+    original = ak._ext.broadcast_and_apply
+
+    def spy(*args, **kwargs):
+        calls.append(len(args[0]))
+        return original(*args, **kwargs)
+
+    monkeypatch.setattr(ak._ext, "broadcast_and_apply", spy)
+
+    one = ak.Array([[1, 2, 3], [], [4, 5]])
+    assert ak.to_list(one + ak.Array([100, 200, 300])) == [
+        [101, 102, 103],
+        [],
+        [304, 305],
+    ]
+    assert calls == [2]
+
+    # strings have a custom "__broadcast__" rule, applied from C++
+    del calls[:]
+    strings = ak.Array(["one", "three"])
+    nested = ak.Array([["one", "two"], ["three", "three", "four"]])
+    assert ak.to_list(strings == nested) == [[True, False], [True, True, False]]
+    assert calls == [2]
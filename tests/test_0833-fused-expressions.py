@@ -0,0 +1,104 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_fused():
+    px = ak.Array([[3.0, 6.0, 5.0], [], [8.0, 0.0]])
+    py = ak.Array([[4.0, 8.0, 12.0], [], [15.0, 1.0]])
+    dpx, dpy = ak.fused.defer(px, py)
+    expression = np.sqrt(dpx ** 2 + dpy ** 2)
+    assert isinstance(expression, ak.fused.Deferred)
+    assert repr(expression) == "<Deferred sqrt(add(power(#0, 2), power(#1, 2)))>"
+    layout = ak.fused.evaluate(expression, highlevel=False)
+    assert isinstance(layout, ak.layout.ListOffsetArray64)
+    assert ak.to_list(layout) == [[5, 10, 13], [], [17, 1]]
+    assert ak.to_list(ak.fused.evaluate(expression)) == ak.to_list(
+        np.sqrt(px ** 2 + py ** 2)
+    )
+
+
+def test_same_as_eager():
+    one = ak.Array([[1.1, 2.2, 3.3], [], [4.4, 5.5], [6.6]])
+    two = ak.Array([[1, 2, 3], [], [4, 5], [6]])
+    regular = ak.Array(np.arange(12, dtype=np.float64).reshape(4, 3))
+    for left, right in [(one, two), (two, one), (regular, regular + 1)]:
+        dleft, dright = ak.fused.defer(left, right)
+        for function in [
+            lambda x, y: x + y * 2.5 - 1,
+            lambda x, y: np.maximum(x, y) / np.hypot(x, y),
+            lambda x, y: -np.arctan2(x, y) ** 3,
+            lambda x, y: np.exp(np.sin(x)) * np.log1p(y),
+        ]:
+            expected = function(left, right)
+            fused = ak.fused.evaluate(function(dleft, dright))
+            assert ak.type(fused) == ak.type(expected)
+            assert np.allclose(
+                ak.to_numpy(ak.flatten(fused, axis=None)),
+                ak.to_numpy(ak.flatten(expected, axis=None)),
+            )
+
+
+def test_not_fusable():
+    one = ak.Array([[1, 2, 3], [], [4, 5]])
+    two = ak.Array([10, 20, 30])
+    options = ak.Array([[1.1, None], [], [3.3]])
+    records = ak.Array([{"x": 1.1}, {"x": 2.2}])
+
+    # different structures are broadcasted, as usual
+    done, dtwo = ak.fused.defer(one, two)
+    assert ak.to_list(ak.fused.evaluate(done * 1.5 + dtwo)) == [
+        [11.5, 13.0, 14.5],
+        [],
+        [36.0, 37.5],
+    ]
+
+    # integer results stay integers
+    assert ak.to_list(ak.fused.evaluate(done * 2 + 1)) == [[3, 5, 7], [], [9, 11]]
+    assert str(ak.type(ak.fused.evaluate(done * 2))) == "3 * var * int64"
+
+    # comparisons are not float64
+    assert ak.to_list(ak.fused.evaluate(done > 2)) == [
+        [False, False, True],
+        [],
+        [True, True],
+    ]
+
+    doptions = ak.fused.defer(options)
+    assert ak.to_list(ak.fused.evaluate(np.sqrt(doptions + 1))) == ak.to_list(
+        np.sqrt(options + 1)
+    )
+
+    drecords = ak.fused.defer(records)
+    with pytest.raises(ValueError):
+        ak.fused.evaluate(drecords + 1)
+
+
+def test_mixed_with_arrays():
+    one = ak.Array([[1.0, 4.0], [9.0]])
+    done = ak.fused.defer(one)
+    assert ak.to_list(ak.fused.evaluate(one + np.sqrt(done))) == [[2, 6], [12]]
+    assert ak.to_list((np.sqrt(done) - one).evaluate()) == [[0, -2], [-6]]
+
+
+def test_kernel():
+    program = [
+        ("input", 0),
+        ("constant", 0),
+        ("multiply", 0),
+        ("input", 1),
+        ("add", 0),
+    ]
+    one = ak.layout.NumpyArray(np.arange(3000, dtype=np.float64))
+    two = ak.layout.NumpyArray(np.arange(3000, dtype=np.int32))
+    out = ak._ext.fused_elementwise([one, two], program, [0.5])
+    assert np.asarray(out).tolist() == (np.arange(3000) * 1.5).tolist()
+    with pytest.raises(ValueError):
+        ak._ext.fused_elementwise([one], [("input", 0), ("add", 0)], [])
+    with pytest.raises(ValueError):
+        ak._ext.fused_elementwise([one], [("input", 0), ("floor_divide", 0)], [])
+    assert "sqrt" in ak._ext.fused_operations()
@@ -0,0 +1,88 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/main/LICENSE
+
+from __future__ import absolute_import
+
+import pytest  # noqa: F401
+import numpy as np  # noqa: F401
+import awkward as ak  # noqa: F401
+
+
+def test_nested_selections():
+    array = ak.Array(
+        [
+            {"x": i, "y": i * 1.1, "z": {"a": i * 10, "b": [i] * (i % 3)}}
+            for i in range(100)
+        ]
+    )
+    mask1 = array.x % 2 == 0
+    mask2 = array[mask1].x % 3 != 0
+    index = np.array([5, 0, 3, 3, 1])
+    selected = array[mask1][mask2][index]
+    expected = [x for x in ak.to_list(array) if x["x"] % 2 == 0]
+    expected = [x for x in expected if x["x"] % 3 != 0]
+    expected = [expected[i] for i in index]
+    assert ak.to_list(selected) == expected
+
+
+def test_carry_fields():
+    content = ak.layout.RecordArray(
+        [
+            ak.layout.NumpyArray(np.arange(5000, dtype=np.int64)),
+            ak.layout.NumpyArray(np.arange(5000, dtype=np.float32) * 0.5),
+            ak.layout.RecordArray(
+                [
+                    ak.layout.NumpyArray(
+                        np.arange(10000, dtype=np.int16).reshape(5000, 2)
+                    ),
+                    ak.layout.NumpyArray(np.arange(5000, dtype=np.uint8)),
+                ],
+                ["c", "d"],
+            ),
+        ],
+        ["a", "b", "cd"],
+    )
+    carry = np.random.RandomState(12345).randint(0, 5000, 7000).astype(np.int64)
+    indexed = ak.layout.IndexedArray64(ak.layout.Index64(carry), content)
+    projected = indexed.project()
+    assert np.asarray(projected["a"]).tolist() == carry.tolist()
+    assert np.asarray(projected["b"]).tolist() == (carry * 0.5).tolist()
+    assert (
+        np.asarray(projected["cd"]["c"]).tolist()
+        == np.arange(10000, dtype=np.int16).reshape(5000, 2)[carry].tolist()
+    )
+    assert (
+        np.asarray(projected["cd"]["d"]).tolist() == carry.astype(np.uint8).tolist()
+    )
+
+
+def test_indexed_chains():
+    content = ak.layout.NumpyArray(np.array([10, 11, 12, 13, 14]))
+    inner = ak.layout.IndexedArray64(
+        ak.layout.Index64(np.array([4, 3, 2, 1, 0], np.int64)), content
+    )
+    outer = ak.layout.IndexedArray64(
+        ak.layout.Index64(np.array([0, 2, 4], np.int64)), inner
+    )
+    carried = outer[[2, 1]]
+    assert ak.to_list(carried) == [10, 12]
+    assert isinstance(carried, ak.layout.IndexedArray64)
+    assert isinstance(carried.content, ak.layout.NumpyArray)
+    assert np.asarray(carried.index).tolist() == [0, 2]
+
+    categorical = ak.layout.IndexedArray64(
+        ak.layout.Index64(np.array([0, 2, 4], np.int64)),
+        inner,
+        parameters={"__array__": "categorical"},
+    )
+    carried = categorical[[2, 1]]
+    assert ak.to_list(carried) == [10, 12]
+    assert carried.parameters == {"__array__": "categorical"}
+
+    with pytest.raises(ValueError):
+        ak.layout.IndexedArray64(
+            ak.layout.Index64(np.array([0, 9], np.int64)), inner
+        )[[1, 0]]
+    with pytest.raises(ValueError):
+        ak.layout.IndexedArray64(
+            ak.layout.Index64(np.array([-1, 0], np.int64)), inner
+        )[[1, 0]]